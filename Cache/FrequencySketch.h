@@ -0,0 +1,105 @@
+/**
+ * @file FrequencySketch.h
+ * @author Kofi Boateng
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ *
+ */
+
+#pragma once
+#include <cstdint> // for uint64_t
+#include <vector>  // backing array of counters
+
+// This is an implementation of the approximate frequency counter used by the TinyLFU admission
+// policy (see TinyLFUCache.h). It is a Count-Min sketch with four rows of 4-bit saturating
+// counters packed sixteen to a 64-bit word. An item's estimated frequency is the minimum of its
+// four counters, which can over-count because of collisions but never under-counts.
+// To keep the estimates about recent history rather than all time, every counter is halved
+// once sampleSize increments have been recorded ("aging").
+
+class FrequencySketch
+{
+private:
+    // Sixteen 4-bit counters per word.
+    std::vector<uint64_t> table_;
+
+    // table_.size() - 1; the size is always a power of two.
+    uint64_t tableMask_;
+
+    // Number of increments after which all counters are halved.
+    int sampleSize_;
+
+    // Number of increments since the last halving.
+    int additions_;
+
+    // Mixes the hash with a per-row seed so each row picks an independent counter.
+    static uint64_t _rehash(uint64_t hash, int row)
+    {
+        static const uint64_t seeds[4] = {0xc3a5c85c97cb3127ULL, 0xb492b66fbe98f273ULL,
+                                          0x9ae16a3b2f90404fULL, 0xcbf29ce484222325ULL};
+        uint64_t h = (hash + seeds[row]) * 0x9e3779b97f4a7c15ULL;
+        return h ^ (h >> 29);
+    }
+
+    // Halves every counter. Masking with 0x77.. drops the bit shifted in from
+    // the neighbouring counter.
+    void _reset()
+    {
+        for (uint64_t &word : table_)
+        {
+            word = (word >> 1) & 0x7777777777777777ULL;
+        }
+        additions_ /= 2;
+    }
+
+public:
+    // Returns the estimated number of times hash was recorded (0-15).
+    int frequency(uint64_t hash) const
+    {
+        int estimate = 15;
+        for (int row = 0; row < 4; row++)
+        {
+            uint64_t h = _rehash(hash, row);
+            int shift = (int)((h >> 32) & 15) * 4;
+            int count = (int)((table_[h & tableMask_] >> shift) & 0xF);
+            estimate = count < estimate ? count : estimate;
+        }
+        return estimate;
+    }
+
+    // Records one occurrence of hash.
+    void increment(uint64_t hash)
+    {
+        bool added = false;
+        for (int row = 0; row < 4; row++)
+        {
+            uint64_t h = _rehash(hash, row);
+            int shift = (int)((h >> 32) & 15) * 4;
+            uint64_t &word = table_[h & tableMask_];
+            if (((word >> shift) & 0xF) != 0xF)
+            {
+                word += 1ULL << shift;
+                added = true;
+            }
+        }
+
+        if (added && ++additions_ >= sampleSize_)
+        {
+            _reset();
+        }
+    }
+
+    // Sizes the sketch for a cache holding about capacity entries.
+    explicit FrequencySketch(int capacity) : additions_(0)
+    {
+        uint64_t words = 1;
+        while (words < (uint64_t)(capacity > 0 ? capacity : 1))
+        {
+            words <<= 1;
+        }
+        table_.assign(words, 0);
+        tableMask_ = words - 1;
+        sampleSize_ = 10 * (capacity > 0 ? capacity : 1);
+    }
+};
@@ -0,0 +1,178 @@
+/**
+ * @file LRUCache.h
+ * @author Kofi Boateng
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ *
+ */
+
+#pragma once
+#include <stdexcept>  // for runtime_error
+#include <functional> // for std::hash
+#include "../LinkedList/LinkedList.h"
+#include "../Hashing/SeparateChainingHashTable/SeparateChainingHashTable.h"
+
+// This is an implementation of a bounded Least-Recently-Used (LRU) cache. The cache composes
+// two structures from this repo: a HashTable that maps each key to its node in a LinkedList,
+// and the LinkedList itself, which keeps the entries ordered from least recently used (front)
+// to most recently used (back). Since the table hands us the node directly, we never walk the
+// list, and get, put, and evict all run in O(1).
+
+template <typename K, typename V, typename Hash = std::hash<K>>
+class LRUCache
+{
+public:
+    // The data held by every node of the recency list. We keep the key next to
+    // the value so that evicting the front node tells us which key to drop from
+    // the table.
+    struct Entry
+    {
+        K key;
+        V value;
+
+        Entry(const K &keyArg, const V &valueArg) : key(keyArg), value(valueArg) {}
+    };
+
+    typedef typename LinkedList<Entry>::Node Node;
+
+private:
+    // Maximum number of entries the cache can hold.
+    int capacity_;
+
+    // Entries ordered from least (front) to most (back) recently used.
+    LinkedList<Entry> recency_;
+
+    // Maps a key to its node in the recency list.
+    HashTable<K, Node *, Hash> index_;
+
+    // Counters so callers can measure the hit rate of a workload.
+    long long hits_;
+    long long misses_;
+
+    // Removes the least recently used entry.
+    void _evict();
+
+public:
+    // Returns how many entries are in the cache.
+    int size() const { return recency_.size(); }
+
+    // Returns the maximum number of entries the cache can hold.
+    int capacity() const { return capacity_; }
+
+    // Returns a boolean signifying if the cache is empty or not.
+    bool isEmpty() const { return recency_.isEmpty(); }
+
+    // Looks up key. On a hit, the value is copied into value, the entry becomes
+    // the most recently used one, and true is returned. O(1).
+    bool get(const K &key, V &value);
+
+    // Inserts or updates key. If the cache is full, the least recently used
+    // entry is evicted first. O(1).
+    void put(const K &key, const V &value);
+
+    // Returns whether key is cached, without touching its recency.
+    bool contains(const K &key) const { return index_.find(key) != nullptr; }
+
+    // Removes key from the cache if it exists.
+    void remove(const K &key);
+
+    // Removes every entry and resets the hit/miss counters.
+    void clear();
+
+    // Hit and miss counters for the lifetime of the cache (or since clear()).
+    long long hits() const { return hits_; }
+    long long misses() const { return misses_; }
+    double hitRate() const { return hits_ + misses_ == 0 ? 0.0 : (double)hits_ / (double)(hits_ + misses_); }
+
+    // Creates an empty cache that holds at most capacity entries. hasher hashes
+    // the keys of the index.
+    explicit LRUCache(int capacity, const Hash &hasher = Hash())
+        : capacity_(capacity), recency_(), index_(capacity, hasher), hits_(0), misses_(0)
+    {
+        if (capacity < 1)
+        {
+            throw std::runtime_error("Error: LRUCache capacity must be at least 1.");
+        }
+    }
+
+    // The table stores addresses of list nodes, so a member-wise copy would
+    // point into the other cache. Caches are therefore not copyable.
+    LRUCache(const LRUCache &other) = delete;
+    LRUCache &operator=(const LRUCache &other) = delete;
+};
+
+// ===================================================================================
+// Implementation Section
+// ===================================================================================
+
+template <typename K, typename V, typename Hash>
+void LRUCache<K, V, Hash>::_evict()
+{
+    Node *victim = recency_.getHeadPtr();
+    if (!victim)
+    {
+        return;
+    }
+    index_.remove(victim->data.key);
+    recency_.erase(victim);
+}
+
+template <typename K, typename V, typename Hash>
+bool LRUCache<K, V, Hash>::get(const K &key, V &value)
+{
+    Node **found = index_.find(key);
+    if (!found)
+    {
+        misses_++;
+        return false;
+    }
+
+    hits_++;
+    recency_.moveToBack(*found);
+    value = (*found)->data.value;
+    return true;
+}
+
+template <typename K, typename V, typename Hash>
+void LRUCache<K, V, Hash>::put(const K &key, const V &value)
+{
+    Node **found = index_.find(key);
+    if (found)
+    {
+        (*found)->data.value = value;
+        recency_.moveToBack(*found);
+        return;
+    }
+
+    if (recency_.size() >= capacity_)
+    {
+        _evict();
+    }
+
+    Node *node = recency_.pushBack(Entry(key, value));
+    index_.add(key, node);
+}
+
+template <typename K, typename V, typename Hash>
+void LRUCache<K, V, Hash>::remove(const K &key)
+{
+    Node **found = index_.find(key);
+    if (!found)
+    {
+        return;
+    }
+
+    Node *node = *found;
+    index_.remove(key);
+    recency_.erase(node);
+}
+
+template <typename K, typename V, typename Hash>
+void LRUCache<K, V, Hash>::clear()
+{
+    recency_.clear();
+    index_ = HashTable<K, Node *, Hash>(capacity_);
+    hits_ = 0;
+    misses_ = 0;
+}
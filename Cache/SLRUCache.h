@@ -0,0 +1,220 @@
+/**
+ * @file SLRUCache.h
+ * @author Kofi Boateng
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ *
+ */
+
+#pragma once
+#include <stdexcept>  // for runtime_error
+#include <functional> // for std::hash
+#include "../LinkedList/LinkedList.h"
+#include "../Hashing/SeparateChainingHashTable/SeparateChainingHashTable.h"
+
+// This is an implementation of a Segmented LRU (SLRU) cache. The cache is split into two LRU
+// lists: a probationary segment, where every new entry lands, and a protected segment, which
+// only holds entries that were hit at least once after insertion. A hit in the probationary
+// segment promotes the entry; when the protected segment overflows, its least recently used
+// entry is demoted back to the probationary segment instead of being evicted. Evictions always
+// come from the probationary segment, so a burst of one-time keys (e.g. a scan) cannot flush
+// the entries that are actually being reused.
+// Like LRUCache.h, the HashTable maps keys straight to their LinkedList nodes, so nodes move
+// between the segments without being reallocated and every operation is O(1).
+
+template <typename K, typename V, typename Hash = std::hash<K>>
+class SLRUCache
+{
+public:
+    // The data held by every node. isProtected records which segment the node
+    // is currently linked into.
+    struct Entry
+    {
+        K key;
+        V value;
+        bool isProtected;
+
+        Entry(const K &keyArg, const V &valueArg) : key(keyArg), value(valueArg), isProtected(false) {}
+    };
+
+    typedef typename LinkedList<Entry>::Node Node;
+
+private:
+    // Maximum number of entries across both segments.
+    int capacity_;
+
+    // Maximum number of entries in the protected segment.
+    int protectedCapacity_;
+
+    // Both segments are ordered from least (front) to most (back) recently used.
+    LinkedList<Entry> probation_;
+    LinkedList<Entry> protected_;
+
+    // Maps a key to its node in whichever segment holds it.
+    HashTable<K, Node *, Hash> index_;
+
+    long long hits_;
+    long long misses_;
+
+    // Moves a probationary node into the protected segment, demoting the
+    // protected segment's least recently used node if it is full.
+    void _promote(Node *node);
+
+    // Removes the least recently used probationary entry (or the least recently
+    // used protected entry if the probationary segment is empty).
+    void _evict();
+
+public:
+    // Returns how many entries are in the cache.
+    int size() const { return probation_.size() + protected_.size(); }
+
+    // Returns the maximum number of entries the cache can hold.
+    int capacity() const { return capacity_; }
+
+    // Returns a boolean signifying if the cache is empty or not.
+    bool isEmpty() const { return size() == 0; }
+
+    // Looks up key. On a hit, the value is copied into value and the entry is
+    // promoted (or refreshed if it is already protected). O(1).
+    bool get(const K &key, V &value);
+
+    // Inserts or updates key. New keys enter the probationary segment. O(1).
+    void put(const K &key, const V &value);
+
+    // Returns whether key is cached, without touching its recency.
+    bool contains(const K &key) const { return index_.find(key) != nullptr; }
+
+    // Removes key from the cache if it exists.
+    void remove(const K &key);
+
+    long long hits() const { return hits_; }
+    long long misses() const { return misses_; }
+    double hitRate() const { return hits_ + misses_ == 0 ? 0.0 : (double)hits_ / (double)(hits_ + misses_); }
+
+    // Creates an empty cache that holds at most capacity entries. protectedRatio
+    // is the share of the capacity reserved for the protected segment; the
+    // commonly used split is 80%. hasher hashes the keys of the index.
+    explicit SLRUCache(int capacity, double protectedRatio = 0.8, const Hash &hasher = Hash())
+        : capacity_(capacity), protectedCapacity_((int)(capacity * protectedRatio)), index_(capacity, hasher), hits_(0), misses_(0)
+    {
+        if (capacity < 1)
+        {
+            throw std::runtime_error("Error: SLRUCache capacity must be at least 1.");
+        }
+    }
+
+    // The same with the default split, so that every cache in this directory
+    // can be built from a capacity and a hasher (Refer to ShardedCache.h).
+    SLRUCache(int capacity, const Hash &hasher) : SLRUCache(capacity, 0.8, hasher) {}
+
+    // Refer to the note in LRUCache.h.
+    SLRUCache(const SLRUCache &other) = delete;
+    SLRUCache &operator=(const SLRUCache &other) = delete;
+};
+
+// ===================================================================================
+// Implementation Section
+// ===================================================================================
+
+template <typename K, typename V, typename Hash>
+void SLRUCache<K, V, Hash>::_promote(Node *node)
+{
+    probation_.unlink(node);
+    node->data.isProtected = true;
+    protected_.linkBack(node);
+
+    if (protected_.size() > protectedCapacity_)
+    {
+        Node *demoted = protected_.getHeadPtr();
+        protected_.unlink(demoted);
+        demoted->data.isProtected = false;
+        probation_.linkBack(demoted);
+    }
+}
+
+template <typename K, typename V, typename Hash>
+void SLRUCache<K, V, Hash>::_evict()
+{
+    LinkedList<Entry> &segment = probation_.isEmpty() ? protected_ : probation_;
+    Node *victim = segment.getHeadPtr();
+    if (!victim)
+    {
+        return;
+    }
+    index_.remove(victim->data.key);
+    segment.erase(victim);
+}
+
+template <typename K, typename V, typename Hash>
+bool SLRUCache<K, V, Hash>::get(const K &key, V &value)
+{
+    Node **found = index_.find(key);
+    if (!found)
+    {
+        misses_++;
+        return false;
+    }
+
+    hits_++;
+    Node *node = *found;
+    if (node->data.isProtected)
+    {
+        protected_.moveToBack(node);
+    }
+    else
+    {
+        _promote(node);
+    }
+    value = node->data.value;
+    return true;
+}
+
+template <typename K, typename V, typename Hash>
+void SLRUCache<K, V, Hash>::put(const K &key, const V &value)
+{
+    Node **found = index_.find(key);
+    if (found)
+    {
+        Node *node = *found;
+        node->data.value = value;
+        if (node->data.isProtected)
+        {
+            protected_.moveToBack(node);
+        }
+        else
+        {
+            _promote(node);
+        }
+        return;
+    }
+
+    if (size() >= capacity_)
+    {
+        _evict();
+    }
+
+    Node *node = probation_.pushBack(Entry(key, value));
+    index_.add(key, node);
+}
+
+template <typename K, typename V, typename Hash>
+void SLRUCache<K, V, Hash>::remove(const K &key)
+{
+    Node **found = index_.find(key);
+    if (!found)
+    {
+        return;
+    }
+
+    Node *node = *found;
+    index_.remove(key);
+    if (node->data.isProtected)
+    {
+        protected_.erase(node);
+    }
+    else
+    {
+        probation_.erase(node);
+    }
+}
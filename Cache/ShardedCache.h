@@ -0,0 +1,141 @@
+/**
+ * @file ShardedCache.h
+ * @author Kofi Boateng
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ *
+ */
+
+#pragma once
+#include <stdexcept>  // for runtime_error
+#include <functional> // for std::hash
+#include <mutex>      // one lock per shard
+#include <memory>     // for unique_ptr
+#include <vector>     // holds the shards
+#include "LRUCache.h"
+
+// This is a thread-safe wrapper around any of the caches in this directory (LRUCache, SLRUCache,
+// TinyLFUCache). A single cache guarded by one mutex serializes every thread on that mutex,
+// because even a get() has to reorder the recency list. Instead, the key space is split into
+// independent shards, each with its own cache and its own lock, and a key's hash picks its shard.
+// Threads touching different shards never contend. The trade-off is that the eviction policy is
+// applied per shard instead of globally, which is close enough once each shard holds a few
+// thousand entries.
+// Hash picks the shard and is handed to every shard's cache, so a custom hasher only has to be given
+// once. Cache must therefore be constructible from a capacity and a Hash, which all three caches are.
+
+template <typename K, typename V, typename Hash = std::hash<K>, typename Cache = LRUCache<K, V, Hash>>
+class ShardedCache
+{
+private:
+    // A cache and the lock that guards it. Shards are aligned to a cache line so
+    // two locks never share one.
+    struct alignas(64) Shard
+    {
+        std::mutex lock;
+        Cache cache;
+
+        Shard(int capacity, const Hash &hasher) : cache(capacity, hasher) {}
+    };
+
+    std::vector<std::unique_ptr<Shard>> shards_;
+    Hash hasher_;
+
+    // Picks the shard for a key. The hash is mixed first since std::hash is the
+    // identity for integers and sequential keys would otherwise stripe badly.
+    Shard &_shardFor(const K &key) const
+    {
+        unsigned long long h = (unsigned long long)hasher_(key) * 0x9e3779b97f4a7c15ULL;
+        return *shards_[(h >> 32) % shards_.size()];
+    }
+
+public:
+    // Looks up key in its shard. Refer to the shard's cache for semantics.
+    bool get(const K &key, V &value)
+    {
+        Shard &shard = _shardFor(key);
+        std::lock_guard<std::mutex> guard(shard.lock);
+        return shard.cache.get(key, value);
+    }
+
+    // Inserts or updates key in its shard.
+    void put(const K &key, const V &value)
+    {
+        Shard &shard = _shardFor(key);
+        std::lock_guard<std::mutex> guard(shard.lock);
+        shard.cache.put(key, value);
+    }
+
+    // Returns whether key is cached.
+    bool contains(const K &key) const
+    {
+        Shard &shard = _shardFor(key);
+        std::lock_guard<std::mutex> guard(shard.lock);
+        return shard.cache.contains(key);
+    }
+
+    // Removes key from its shard if it exists.
+    void remove(const K &key)
+    {
+        Shard &shard = _shardFor(key);
+        std::lock_guard<std::mutex> guard(shard.lock);
+        shard.cache.remove(key);
+    }
+
+    // Returns the total number of entries. Shards are locked one at a time, so
+    // under concurrent writes this is a snapshot, not an exact count.
+    int size() const
+    {
+        int total = 0;
+        for (auto &shard : shards_)
+        {
+            std::lock_guard<std::mutex> guard(shard->lock);
+            total += shard->cache.size();
+        }
+        return total;
+    }
+
+    // Returns the number of shards.
+    int shardCount() const { return (int)shards_.size(); }
+
+    // Hit and miss counters summed over every shard.
+    long long hits() const
+    {
+        long long total = 0;
+        for (auto &shard : shards_)
+        {
+            std::lock_guard<std::mutex> guard(shard->lock);
+            total += shard->cache.hits();
+        }
+        return total;
+    }
+
+    long long misses() const
+    {
+        long long total = 0;
+        for (auto &shard : shards_)
+        {
+            std::lock_guard<std::mutex> guard(shard->lock);
+            total += shard->cache.misses();
+        }
+        return total;
+    }
+
+    // Creates shardCount shards that share capacity evenly (rounded up).
+    explicit ShardedCache(int capacity, int shardCount = 16, const Hash &hasher = Hash()) : hasher_(hasher)
+    {
+        if (capacity < 1 || shardCount < 1)
+        {
+            throw std::runtime_error("Error: ShardedCache needs a positive capacity and shard count.");
+        }
+        int perShard = (capacity + shardCount - 1) / shardCount;
+        for (int i = 0; i < shardCount; i++)
+        {
+            shards_.push_back(std::unique_ptr<Shard>(new Shard(perShard, hasher_)));
+        }
+    }
+
+    ShardedCache(const ShardedCache &other) = delete;
+    ShardedCache &operator=(const ShardedCache &other) = delete;
+};
@@ -0,0 +1,258 @@
+/**
+ * @file TinyLFUCache.h
+ * @author Kofi Boateng
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ *
+ */
+
+#pragma once
+#include <stdexcept>  // for runtime_error
+#include <functional> // for std::hash
+#include "FrequencySketch.h"
+#include "../LinkedList/LinkedList.h"
+#include "../Hashing/SeparateChainingHashTable/SeparateChainingHashTable.h"
+
+// This is an implementation of a W-TinyLFU cache. New entries land in a small LRU "window"
+// (about 1% of the capacity) that absorbs bursts. When an entry falls out of the window, it
+// becomes a candidate for the main cache, which is a segmented LRU (Refer to SLRUCache.h).
+// The candidate is only admitted if a FrequencySketch says it has been seen more often than
+// the entry the main cache would have to evict; otherwise the candidate itself is dropped.
+// That way rarely used keys never push out popular ones, while the window still gives new
+// keys a chance to build up a history.
+// All three segments are LinkedLists indexed by one HashTable of node pointers, so nodes move
+// between segments without reallocation and every operation is O(1).
+
+template <typename K, typename V, typename Hash = std::hash<K>>
+class TinyLFUCache
+{
+public:
+    // Which segment a node is currently linked into.
+    enum Segment
+    {
+        WINDOW,
+        PROBATION,
+        PROTECTED
+    };
+
+    // The data held by every node.
+    struct Entry
+    {
+        K key;
+        V value;
+        Segment segment;
+
+        Entry(const K &keyArg, const V &valueArg) : key(keyArg), value(valueArg), segment(WINDOW) {}
+    };
+
+    typedef typename LinkedList<Entry>::Node Node;
+
+private:
+    int capacity_;
+    int windowCapacity_;
+    int mainCapacity_;
+    int protectedCapacity_;
+
+    // All segments are ordered from least (front) to most (back) recently used.
+    LinkedList<Entry> window_;
+    LinkedList<Entry> probation_;
+    LinkedList<Entry> protected_;
+
+    // Maps a key to its node in whichever segment holds it.
+    HashTable<K, Node *, Hash> index_;
+
+    // Approximate access history used to make admission decisions.
+    FrequencySketch sketch_;
+
+    long long hits_;
+    long long misses_;
+
+    // Returns the list that a node in the given segment is linked into.
+    LinkedList<Entry> &_segment(Segment segment)
+    {
+        return segment == WINDOW ? window_ : (segment == PROBATION ? probation_ : protected_);
+    }
+
+    // Returns the hash used for the frequency sketch.
+    uint64_t _hash(const K &key) const { return (uint64_t)index_.hasher()(key); }
+
+    // Refreshes a node after a hit, promoting it out of probation if needed.
+    void _onHit(Node *node);
+
+    // Moves the window's least recently used entry into the main cache if the
+    // admission policy allows it, or drops it otherwise.
+    void _evictFromWindow();
+
+    // Unlinks node from its segment, removes it from the index, and frees it.
+    void _drop(Node *node);
+
+public:
+    // Returns how many entries are in the cache.
+    int size() const { return window_.size() + probation_.size() + protected_.size(); }
+
+    // Returns the maximum number of entries the cache can hold.
+    int capacity() const { return capacity_; }
+
+    // Returns a boolean signifying if the cache is empty or not.
+    bool isEmpty() const { return size() == 0; }
+
+    // Looks up key. On a hit, the value is copied into value and true is returned.
+    // Every lookup, hit or miss, is recorded in the frequency sketch. O(1).
+    bool get(const K &key, V &value);
+
+    // Inserts or updates key. New keys enter the window segment. O(1).
+    void put(const K &key, const V &value);
+
+    // Returns whether key is cached, without touching its recency.
+    bool contains(const K &key) const { return index_.find(key) != nullptr; }
+
+    // Removes key from the cache if it exists.
+    void remove(const K &key);
+
+    long long hits() const { return hits_; }
+    long long misses() const { return misses_; }
+    double hitRate() const { return hits_ + misses_ == 0 ? 0.0 : (double)hits_ / (double)(hits_ + misses_); }
+
+    // Creates an empty cache that holds at most capacity entries. 1% of the
+    // capacity (at least one entry) goes to the window and 80% of the rest to the
+    // protected segment. hasher hashes the keys of the index and the sketch.
+    explicit TinyLFUCache(int capacity, const Hash &hasher = Hash())
+        : capacity_(capacity), index_(capacity, hasher), sketch_(capacity), hits_(0), misses_(0)
+    {
+        if (capacity < 1)
+        {
+            throw std::runtime_error("Error: TinyLFUCache capacity must be at least 1.");
+        }
+        windowCapacity_ = capacity / 100 > 0 ? capacity / 100 : 1;
+        mainCapacity_ = capacity - windowCapacity_;
+        protectedCapacity_ = (int)(mainCapacity_ * 0.8);
+    }
+
+    // Refer to the note in LRUCache.h.
+    TinyLFUCache(const TinyLFUCache &other) = delete;
+    TinyLFUCache &operator=(const TinyLFUCache &other) = delete;
+};
+
+// ===================================================================================
+// Implementation Section
+// ===================================================================================
+
+template <typename K, typename V, typename Hash>
+void TinyLFUCache<K, V, Hash>::_drop(Node *node)
+{
+    index_.remove(node->data.key);
+    _segment(node->data.segment).erase(node);
+}
+
+template <typename K, typename V, typename Hash>
+void TinyLFUCache<K, V, Hash>::_onHit(Node *node)
+{
+    if (node->data.segment != PROBATION)
+    {
+        _segment(node->data.segment).moveToBack(node);
+        return;
+    }
+
+    // Second hit while in the main cache: promote to the protected segment and
+    // demote its least recently used entry if it overflowed.
+    probation_.unlink(node);
+    node->data.segment = PROTECTED;
+    protected_.linkBack(node);
+
+    if (protected_.size() > protectedCapacity_)
+    {
+        Node *demoted = protected_.getHeadPtr();
+        protected_.unlink(demoted);
+        demoted->data.segment = PROBATION;
+        probation_.linkBack(demoted);
+    }
+}
+
+template <typename K, typename V, typename Hash>
+void TinyLFUCache<K, V, Hash>::_evictFromWindow()
+{
+    Node *candidate = window_.getHeadPtr();
+
+    // Room left in the main cache: admit without a contest.
+    if (probation_.size() + protected_.size() < mainCapacity_)
+    {
+        window_.unlink(candidate);
+        candidate->data.segment = PROBATION;
+        probation_.linkBack(candidate);
+        return;
+    }
+
+    Node *victim = probation_.isEmpty() ? protected_.getHeadPtr() : probation_.getHeadPtr();
+    if (!victim)
+    {
+        // The main cache has no room at all (capacity of one).
+        _drop(candidate);
+        return;
+    }
+
+    // Admission: the candidate must be strictly more popular than the victim.
+    if (sketch_.frequency(_hash(candidate->data.key)) > sketch_.frequency(_hash(victim->data.key)))
+    {
+        _drop(victim);
+        window_.unlink(candidate);
+        candidate->data.segment = PROBATION;
+        probation_.linkBack(candidate);
+    }
+    else
+    {
+        _drop(candidate);
+    }
+}
+
+template <typename K, typename V, typename Hash>
+bool TinyLFUCache<K, V, Hash>::get(const K &key, V &value)
+{
+    sketch_.increment(_hash(key));
+
+    Node **found = index_.find(key);
+    if (!found)
+    {
+        misses_++;
+        return false;
+    }
+
+    hits_++;
+    Node *node = *found;
+    _onHit(node);
+    value = node->data.value;
+    return true;
+}
+
+template <typename K, typename V, typename Hash>
+void TinyLFUCache<K, V, Hash>::put(const K &key, const V &value)
+{
+    Node **found = index_.find(key);
+    if (found)
+    {
+        (*found)->data.value = value;
+        _onHit(*found);
+        return;
+    }
+
+    sketch_.increment(_hash(key));
+
+    Node *node = window_.pushBack(Entry(key, value));
+    index_.add(key, node);
+
+    if (window_.size() > windowCapacity_)
+    {
+        _evictFromWindow();
+    }
+}
+
+template <typename K, typename V, typename Hash>
+void TinyLFUCache<K, V, Hash>::remove(const K &key)
+{
+    Node **found = index_.find(key);
+    if (!found)
+    {
+        return;
+    }
+    _drop(*found);
+}
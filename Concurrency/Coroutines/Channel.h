@@ -0,0 +1,183 @@
+/**
+ * @file Channel.h
+ * @author Kofi Boateng
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ *
+ */
+
+#pragma once
+#include <coroutine> // for coroutine_handle
+#include <cstddef>   // for size_t
+#include <deque>     // waiting senders and receivers
+#include <mutex>     // for the channel state
+#include <optional>  // for dequeue results
+#include <utility>   // for move
+#include "Task.h"
+#include "../../Queue/RingBuffer.h"
+
+// This is an implementation of an asynchronous Channel, the coroutine counterpart of QueueADT for
+// connecting pipeline stages. co_await channel.enqueue(value) and co_await channel.dequeue() behave
+// like QueueADT's enqueue and dequeue, except that instead of blocking the thread when the channel is
+// full or empty they suspend the calling Task, which is resumed on its own executor when space or a
+// value becomes available.
+// A bounded channel holds at most capacity values, so a fast producer is slowed down to the pace of its
+// consumer (backpressure). A channel created with capacity 0 is unbounded and enqueue never suspends.
+// Values are buffered in a RingBuffer. When a receiver is already waiting, enqueue hands the value
+// straight to it, and when a sender is waiting on a full channel, dequeue moves the sender's value into
+// the freed slot, so a value is copied at most twice.
+// close() ends the stream: enqueue then returns false, and dequeue returns the remaining values and
+// then an empty optional. All operations are thread-safe, so a channel can connect tasks running on
+// different executors.
+
+template <typename T>
+class Channel
+{
+private:
+    // A suspended sender or receiver; it lives in the awaiting coroutine's frame.
+    struct Waiter
+    {
+        std::coroutine_handle<> handle;
+        Executor *executor;
+    };
+
+    std::mutex lock_;
+    RingBuffer<T> buffer_;
+    size_t capacity_;
+    bool closed_;
+
+    struct SendAwaiter;
+    struct ReceiveAwaiter;
+    std::deque<SendAwaiter *> senders_;
+    std::deque<ReceiveAwaiter *> receivers_;
+
+    static void _wake(const Waiter &waiter) { waiter.executor->schedule(waiter.handle); }
+
+    struct SendAwaiter
+    {
+        Channel &channel;
+        T value;
+        Waiter waiter;
+        bool sent = false;
+
+        bool await_ready() { return false; }
+
+        // Returns false (do not suspend) if the value could be delivered now.
+        template <typename Promise>
+        bool await_suspend(std::coroutine_handle<Promise> handle)
+        {
+            std::lock_guard<std::mutex> lock(channel.lock_);
+            if (channel.closed_)
+            {
+                return false;
+            }
+            sent = true;
+            if (!channel.receivers_.empty())
+            {
+                ReceiveAwaiter *receiver = channel.receivers_.front();
+                channel.receivers_.pop_front();
+                receiver->value.emplace(std::move(value));
+                _wake(receiver->waiter);
+                return false;
+            }
+            if (channel.capacity_ == 0 || channel.buffer_.size() < channel.capacity_)
+            {
+                channel.buffer_.pushBack(std::move(value));
+                return false;
+            }
+            waiter = Waiter{handle, handle.promise().executor};
+            channel.senders_.push_back(this);
+            return true;
+        }
+
+        // Returns false if the channel was closed before the value was taken.
+        bool await_resume() { return sent; }
+    };
+
+    struct ReceiveAwaiter
+    {
+        Channel &channel;
+        std::optional<T> value;
+        Waiter waiter;
+
+        bool await_ready() { return false; }
+
+        template <typename Promise>
+        bool await_suspend(std::coroutine_handle<Promise> handle)
+        {
+            std::lock_guard<std::mutex> lock(channel.lock_);
+            if (!channel.buffer_.isEmpty())
+            {
+                value.emplace(std::move(channel.buffer_.front()));
+                channel.buffer_.popFront();
+                // A slot opened up for the first waiting sender.
+                if (!channel.senders_.empty())
+                {
+                    SendAwaiter *sender = channel.senders_.front();
+                    channel.senders_.pop_front();
+                    channel.buffer_.pushBack(std::move(sender->value));
+                    _wake(sender->waiter);
+                }
+                return false;
+            }
+            if (channel.closed_)
+            {
+                return false;
+            }
+            waiter = Waiter{handle, handle.promise().executor};
+            channel.receivers_.push_back(this);
+            return true;
+        }
+
+        // Returns the value, or nothing if the channel is closed and drained.
+        std::optional<T> await_resume() { return std::move(value); }
+    };
+
+public:
+    // Awaitable: sends value, suspending while the channel is full. Resumes
+    // with false if the channel is closed.
+    SendAwaiter enqueue(T value) { return SendAwaiter{*this, std::move(value), Waiter{}}; }
+
+    // Awaitable: receives the oldest value, suspending while the channel is
+    // empty. Resumes with an empty optional once it is closed and drained.
+    ReceiveAwaiter dequeue() { return ReceiveAwaiter{*this, std::nullopt, Waiter{}}; }
+
+    // Closes the channel and wakes every waiting sender and receiver.
+    void close()
+    {
+        std::lock_guard<std::mutex> lock(lock_);
+        closed_ = true;
+        for (SendAwaiter *sender : senders_)
+        {
+            sender->sent = false;
+            _wake(sender->waiter);
+        }
+        senders_.clear();
+        for (ReceiveAwaiter *receiver : receivers_)
+        {
+            _wake(receiver->waiter);
+        }
+        receivers_.clear();
+    }
+
+    // Returns the number of buffered values.
+    size_t size()
+    {
+        std::lock_guard<std::mutex> lock(lock_);
+        return buffer_.size();
+    }
+
+    // Returns whether close() has been called.
+    bool isClosed()
+    {
+        std::lock_guard<std::mutex> lock(lock_);
+        return closed_;
+    }
+
+    // Creates a channel holding at most capacity values, or unbounded if 0.
+    explicit Channel(size_t capacity = 0) : buffer_(capacity == 0 ? 16 : capacity), capacity_(capacity), closed_(false) {}
+
+    Channel(const Channel &) = delete;
+    Channel &operator=(const Channel &) = delete;
+};
@@ -0,0 +1,103 @@
+/**
+ * @file Executors.h
+ * @author Kofi Boateng
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ *
+ */
+
+#pragma once
+#include <condition_variable> // for join()
+#include <coroutine>          // for coroutine_handle
+#include <mutex>              // for the ready queue
+#include "Task.h"
+#include "../ThreadPool.h"
+#include "../../Queue/RingBuffer.h"
+
+// These are the two executors that run Tasks.
+// SingleThreadExecutor keeps ready tasks in a RingBuffer and resumes them one after another on the
+// thread that calls run(). Everything happens on that one thread, so stages need no synchronization of
+// their own, and switching from one task to the next costs a queue pop and an indirect call. Other
+// threads may still schedule onto it (for example through a Channel shared with a ThreadPoolExecutor);
+// the queue is guarded by a mutex that is uncontended in the single-threaded case.
+// ThreadPoolExecutor resumes each ready task as a task on a ThreadPool, so stages run in parallel on
+// the pool's workers and a stage may continue on a different worker after each suspension.
+
+class SingleThreadExecutor : public Executor
+{
+private:
+    std::mutex lock_;
+    RingBuffer<std::coroutine_handle<>> ready_;
+
+public:
+    void schedule(std::coroutine_handle<> handle) override
+    {
+        std::lock_guard<std::mutex> lock(lock_);
+        ready_.pushBack(handle);
+    }
+
+    // Resumes ready tasks until none is left, then returns the number of
+    // spawned tasks still suspended. Rethrows the first exception a spawned
+    // task threw.
+    size_t run()
+    {
+        while (true)
+        {
+            std::coroutine_handle<> handle;
+            {
+                std::lock_guard<std::mutex> lock(lock_);
+                if (ready_.isEmpty())
+                {
+                    break;
+                }
+                handle = ready_.front();
+                ready_.popFront();
+            }
+            handle.resume();
+        }
+        _rethrow();
+        return liveTasks();
+    }
+
+    SingleThreadExecutor() : ready_(256) {}
+};
+
+class ThreadPoolExecutor : public Executor
+{
+private:
+    ThreadPool &pool_;
+    std::mutex doneLock_;
+    std::condition_variable done_;
+
+protected:
+    // The count drops under the lock, so join() cannot return (and the
+    // executor be destroyed) before the notification is finished.
+    void _taskFinished(std::exception_ptr error) override
+    {
+        std::lock_guard<std::mutex> lock(doneLock_);
+        Executor::_taskFinished(error);
+        done_.notify_all();
+    }
+
+public:
+    void schedule(std::coroutine_handle<> handle) override
+    {
+        pool_.submit([handle]()
+                     { handle.resume(); });
+    }
+
+    // Blocks until every spawned task has finished, then rethrows the first
+    // exception any of them threw.
+    void join()
+    {
+        std::unique_lock<std::mutex> lock(doneLock_);
+        done_.wait(lock, [this]()
+                   { return liveTasks() == 0; });
+        lock.unlock();
+        _rethrow();
+    }
+
+    // Runs tasks on pool, by default the shared one.
+    explicit ThreadPoolExecutor(ThreadPool &pool = ThreadPool::global()) : pool_(pool) {}
+};
@@ -0,0 +1,281 @@
+/**
+ * @file Task.h
+ * @author Kofi Boateng
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ *
+ */
+
+#pragma once
+#if !defined(__cpp_impl_coroutine)
+#error "The coroutine headers require C++20 (-std=c++20)."
+#endif
+#include <atomic>    // for the live task count
+#include <coroutine> // for coroutine_handle and suspend_always
+#include <exception> // for exception_ptr
+#include <mutex>     // for the first error
+#include <optional>  // for task results
+#include <utility>   // for exchange and move
+
+// This is the coroutine type for container pipelines. A pipeline stage written as a coroutine returning
+// Task<> suspends instead of blocking when it waits on a Channel (Channel.h), so thousands of stages can
+// share a few threads: a suspended stage is a heap frame of a few hundred bytes, not an OS thread with
+// its own stack, and switching stages is a function call rather than a context switch in the kernel.
+// A Task is lazy and does nothing until it is either spawned on an Executor, which runs it detached and
+// frees it when it finishes, or awaited by another Task, which then runs it on its own executor and
+// resumes when it returns. Awaiting uses symmetric transfer (await_suspend returns the next coroutine
+// to run), so long chains of awaits do not grow the stack.
+// Every running task knows its executor, and anything that wakes a suspended task (a channel, or
+// yieldNow()) hands it back to that executor instead of resuming it on the waking thread.
+
+class Executor;
+
+namespace coroutine_detail
+{
+    // State shared by every Task promise.
+    struct PromiseBase
+    {
+        Executor *executor = nullptr;
+        std::coroutine_handle<> continuation;
+        std::exception_ptr error;
+        bool detached = false;
+
+        std::suspend_always initial_suspend() noexcept { return {}; }
+        void unhandled_exception() noexcept { error = std::current_exception(); }
+    };
+
+    // At the end of a task, resume whoever awaited it, or free a detached task.
+    template <typename Promise>
+    struct FinalAwaiter
+    {
+        bool await_ready() noexcept { return false; }
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> handle) noexcept;
+        void await_resume() noexcept {}
+    };
+}
+
+// An executor runs tasks that are ready to continue.
+class Executor
+{
+private:
+    std::atomic<size_t> live_;
+    std::mutex errorLock_;
+    std::exception_ptr error_;
+
+    template <typename Promise>
+    friend struct coroutine_detail::FinalAwaiter;
+
+protected:
+    // Called when a spawned task finishes, with the exception it threw, if any.
+    virtual void _taskFinished(std::exception_ptr error)
+    {
+        if (error)
+        {
+            std::lock_guard<std::mutex> lock(errorLock_);
+            if (!error_)
+            {
+                error_ = error;
+            }
+        }
+        live_.fetch_sub(1, std::memory_order_acq_rel);
+    }
+
+    // Rethrows the first exception a spawned task threw.
+    void _rethrow()
+    {
+        std::exception_ptr error;
+        {
+            std::lock_guard<std::mutex> lock(errorLock_);
+            error = std::exchange(error_, nullptr);
+        }
+        if (error)
+        {
+            std::rethrow_exception(error);
+        }
+    }
+
+public:
+    // Queues handle to be resumed. Safe to call from any thread.
+    virtual void schedule(std::coroutine_handle<> handle) = 0;
+
+    // Starts task detached on this executor.
+    template <typename TaskType>
+    void spawn(TaskType task)
+    {
+        auto handle = task._release();
+        handle.promise().executor = this;
+        handle.promise().detached = true;
+        live_.fetch_add(1, std::memory_order_relaxed);
+        schedule(handle);
+    }
+
+    // Returns the number of spawned tasks that have not finished.
+    size_t liveTasks() const { return live_.load(std::memory_order_acquire); }
+
+    Executor() : live_(0) {}
+    Executor(const Executor &) = delete;
+    Executor &operator=(const Executor &) = delete;
+    virtual ~Executor() {}
+};
+
+template <typename T = void>
+class Task
+{
+public:
+    struct promise_type : coroutine_detail::PromiseBase
+    {
+        std::optional<T> value;
+
+        Task get_return_object() { return Task(std::coroutine_handle<promise_type>::from_promise(*this)); }
+        coroutine_detail::FinalAwaiter<promise_type> final_suspend() noexcept { return {}; }
+        void return_value(T result) { value.emplace(std::move(result)); }
+    };
+
+private:
+    std::coroutine_handle<promise_type> handle_;
+
+    explicit Task(std::coroutine_handle<promise_type> handle) : handle_(handle) {}
+
+    friend class Executor;
+
+    std::coroutine_handle<promise_type> _release() { return std::exchange(handle_, nullptr); }
+
+public:
+    // Awaiting a task runs it on the awaiting task's executor.
+    struct Awaiter
+    {
+        std::coroutine_handle<promise_type> handle;
+
+        bool await_ready() { return false; }
+
+        template <typename Promise>
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> awaiting)
+        {
+            handle.promise().executor = awaiting.promise().executor;
+            handle.promise().continuation = awaiting;
+            return handle;
+        }
+
+        T await_resume()
+        {
+            if (handle.promise().error)
+            {
+                std::rethrow_exception(handle.promise().error);
+            }
+            return std::move(*handle.promise().value);
+        }
+    };
+
+    Awaiter operator co_await() && { return Awaiter{handle_}; }
+
+    Task(Task &&other) noexcept : handle_(std::exchange(other.handle_, nullptr)) {}
+    Task(const Task &) = delete;
+    Task &operator=(const Task &) = delete;
+
+    ~Task()
+    {
+        if (handle_)
+        {
+            handle_.destroy();
+        }
+    }
+};
+
+template <>
+class Task<void>
+{
+public:
+    struct promise_type : coroutine_detail::PromiseBase
+    {
+        Task get_return_object() { return Task(std::coroutine_handle<promise_type>::from_promise(*this)); }
+        coroutine_detail::FinalAwaiter<promise_type> final_suspend() noexcept { return {}; }
+        void return_void() {}
+    };
+
+private:
+    std::coroutine_handle<promise_type> handle_;
+
+    explicit Task(std::coroutine_handle<promise_type> handle) : handle_(handle) {}
+
+    friend class Executor;
+
+    std::coroutine_handle<promise_type> _release() { return std::exchange(handle_, nullptr); }
+
+public:
+    struct Awaiter
+    {
+        std::coroutine_handle<promise_type> handle;
+
+        bool await_ready() { return false; }
+
+        template <typename Promise>
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> awaiting)
+        {
+            handle.promise().executor = awaiting.promise().executor;
+            handle.promise().continuation = awaiting;
+            return handle;
+        }
+
+        void await_resume()
+        {
+            if (handle.promise().error)
+            {
+                std::rethrow_exception(handle.promise().error);
+            }
+        }
+    };
+
+    Awaiter operator co_await() && { return Awaiter{handle_}; }
+
+    Task(Task &&other) noexcept : handle_(std::exchange(other.handle_, nullptr)) {}
+    Task(const Task &) = delete;
+    Task &operator=(const Task &) = delete;
+
+    ~Task()
+    {
+        if (handle_)
+        {
+            handle_.destroy();
+        }
+    }
+};
+
+// Suspends the current task and queues it at the back of its executor, so
+// other ready tasks run first.
+struct YieldAwaiter
+{
+    bool await_ready() { return false; }
+
+    template <typename Promise>
+    void await_suspend(std::coroutine_handle<Promise> handle)
+    {
+        handle.promise().executor->schedule(handle);
+    }
+
+    void await_resume() {}
+};
+
+inline YieldAwaiter yieldNow() { return YieldAwaiter{}; }
+
+// ===================================================================================
+// Implementation Section
+// ===================================================================================
+
+template <typename Promise>
+std::coroutine_handle<> coroutine_detail::FinalAwaiter<Promise>::await_suspend(std::coroutine_handle<Promise> handle) noexcept
+{
+    Promise &promise = handle.promise();
+    if (promise.continuation)
+    {
+        return promise.continuation;
+    }
+    if (promise.detached)
+    {
+        Executor *executor = promise.executor;
+        std::exception_ptr error = promise.error;
+        handle.destroy();
+        executor->_taskFinished(error);
+    }
+    return std::noop_coroutine();
+}
@@ -0,0 +1,292 @@
+/**
+ * @file EpochReclamation.h
+ * @author Kofi Boateng
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ *
+ */
+
+#pragma once
+#include <stdexcept> // for runtime_error
+#include <cstdint>   // for fixed width integers
+#include <atomic>    // for the global epoch and thread states
+#include <memory>    // for unique_ptr
+#include <mutex>     // for the orphan list
+#include <vector>    // orphaned nodes
+#include "RetiredPointer.h"
+#include "../Queue/RingBuffer.h"
+
+// This is an implementation of epoch-based memory reclamation (EBR), which lets lock-free structures
+// free the nodes they unlink. A thread that pops a node from a lock-free Stack cannot delete it right
+// away, because another thread may have loaded a pointer to it a moment earlier and be about to read it.
+// EBR delays the delete until every such thread is known to be finished.
+// The domain keeps a global epoch counter. A thread enters a critical section by pinning itself: it
+// publishes the current global epoch in its slot, and only then reads shared pointers. A node that has
+// been unlinked is retired with the global epoch at that time, t. The epoch can only advance from e to
+// e + 1 once every pinned thread has announced e, so by the time it reaches t + 2, every thread that was
+// pinned when the node was unlinked has since unpinned, and the node can be freed.
+// Retired nodes wait in a per-thread RingBuffer ordered by epoch. Every 64 retirements the thread tries
+// to advance the epoch and frees the nodes at the front that are old enough. Reads cost one store and
+// one fence per critical section, not per pointer, which is why EBR is the fastest scheme for read-mostly
+// structures. Its weakness is that one thread stalled inside a critical section stops all reclamation
+// (HazardPointers.h bounds the garbage instead).
+// QSBR (quiescent-state-based reclamation) is available as a mode of the same domain. A thread calls
+// online() once and then quiescent() whenever it holds no shared pointers, for example between requests;
+// each call counts as an unpin followed by a pin. Reads then need no pinning at all, at the cost of
+// having to report quiescent states regularly. offline() stops the thread from holding back the epoch.
+//
+// Usage: every thread creates an EpochDomain::Handle on the domain, opens an EpochDomain::Guard around
+// each operation, and passes unlinked nodes to handle.retire(node).
+
+class EpochDomain
+{
+private:
+    // Slot states are (epoch << 1) | pinned.
+    struct alignas(64) Slot
+    {
+        std::atomic<uint64_t> state;
+        std::atomic<bool> claimed;
+
+        Slot() : state(0), claimed(false) {}
+    };
+
+    // Retirements between attempts to advance the epoch.
+    static const size_t collectInterval = 64;
+
+    std::atomic<uint64_t> epoch_;
+    std::unique_ptr<Slot[]> slots_;
+    int slotCount_;
+
+    // Nodes left behind by handles that were destroyed before they could be freed.
+    std::mutex orphanLock_;
+    std::vector<RetiredPointer> orphans_;
+
+    // Advances the global epoch if every pinned thread has reached it, and
+    // returns the (possibly new) epoch.
+    uint64_t _tryAdvance()
+    {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        uint64_t epoch = epoch_.load(std::memory_order_seq_cst);
+        for (int i = 0; i < slotCount_; i++)
+        {
+            uint64_t state = slots_[i].state.load(std::memory_order_seq_cst);
+            if ((state & 1) && (state >> 1) != epoch)
+            {
+                return epoch;
+            }
+        }
+        if (epoch_.compare_exchange_strong(epoch, epoch + 1, std::memory_order_seq_cst))
+        {
+            return epoch + 1;
+        }
+        return epoch;
+    }
+
+    // Frees the orphaned nodes that are old enough.
+    void _collectOrphans(uint64_t epoch)
+    {
+        std::unique_lock<std::mutex> lock(orphanLock_, std::try_to_lock);
+        if (!lock.owns_lock())
+        {
+            return;
+        }
+        size_t kept = 0;
+        for (size_t i = 0; i < orphans_.size(); i++)
+        {
+            if (orphans_[i].epoch + 2 <= epoch)
+            {
+                orphans_[i].reclaim();
+            }
+            else
+            {
+                orphans_[kept++] = orphans_[i];
+            }
+        }
+        orphans_.resize(kept);
+    }
+
+public:
+    // A thread's registration with the domain. Create one per thread and keep
+    // it for as long as the thread uses the structures the domain protects.
+    class Handle
+    {
+    private:
+        EpochDomain &domain_;
+        Slot *slot_;
+        int depth_;
+        bool online_;
+        RingBuffer<RetiredPointer> retired_;
+
+        void _announce()
+        {
+            uint64_t epoch = domain_.epoch_.load(std::memory_order_relaxed);
+            // In QSBR mode this also ends the previous critical section, so
+            // the reads made in it must not move below the announcement.
+            slot_->state.store((epoch << 1) | 1, std::memory_order_release);
+            // Readers' loads must not move above the announcement.
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+        }
+
+        void _unannounce() { slot_->state.store(0, std::memory_order_release); }
+
+    public:
+        // Pins the thread. Guard calls this; pins nest.
+        void pin()
+        {
+            if (depth_++ == 0 && !online_)
+            {
+                _announce();
+            }
+        }
+
+        // Unpins the thread once every pin has been matched.
+        void unpin()
+        {
+            if (--depth_ == 0 && !online_)
+            {
+                _unannounce();
+            }
+        }
+
+        // QSBR mode: keeps the thread announced until offline().
+        void online()
+        {
+            online_ = true;
+            _announce();
+        }
+
+        // QSBR mode: reports that the thread holds no shared pointers.
+        void quiescent()
+        {
+            if (!online_)
+            {
+                throw std::runtime_error("Error: quiescent() called on a thread that is not online.");
+            }
+            _announce();
+            collect();
+        }
+
+        // QSBR mode: stops holding back the epoch while the thread is idle.
+        void offline()
+        {
+            online_ = false;
+            if (depth_ == 0)
+            {
+                _unannounce();
+            }
+        }
+
+        // Schedules pointer to be destroyed with deleter once no thread can be
+        // reading it. pointer must already be unreachable for new readers.
+        void retire(void *pointer, void (*deleter)(void *))
+        {
+            // The epoch must be read after the node was unlinked.
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            retired_.pushBack(RetiredPointer{pointer, deleter, domain_.epoch_.load(std::memory_order_seq_cst)});
+            if (retired_.size() % collectInterval == 0)
+            {
+                collect();
+            }
+        }
+
+        template <typename T>
+        void retire(T *pointer) { retire(pointer, &deleteRetired<T>); }
+
+        // Tries to advance the epoch and frees every retired node old enough.
+        void collect()
+        {
+            uint64_t epoch = domain_._tryAdvance();
+            while (!retired_.isEmpty() && retired_.front().epoch + 2 <= epoch)
+            {
+                retired_.front().reclaim();
+                retired_.popFront();
+            }
+            domain_._collectOrphans(epoch);
+        }
+
+        // Returns the number of nodes waiting to be freed by this thread.
+        size_t pending() const { return retired_.size(); }
+
+        explicit Handle(EpochDomain &domain) : domain_(domain), slot_(nullptr), depth_(0), online_(false)
+        {
+            for (int i = 0; i < domain.slotCount_ && !slot_; i++)
+            {
+                bool expected = false;
+                if (domain.slots_[i].claimed.compare_exchange_strong(expected, true))
+                {
+                    slot_ = &domain.slots_[i];
+                }
+            }
+            if (!slot_)
+            {
+                throw std::runtime_error("Error: EpochDomain has no free thread slots.");
+            }
+        }
+
+        Handle(const Handle &) = delete;
+        Handle &operator=(const Handle &) = delete;
+
+        // Frees what it can and hands the rest to the domain.
+        ~Handle()
+        {
+            _unannounce();
+            collect();
+            {
+                std::lock_guard<std::mutex> lock(domain_.orphanLock_);
+                while (!retired_.isEmpty())
+                {
+                    domain_.orphans_.push_back(retired_.front());
+                    retired_.popFront();
+                }
+            }
+            slot_->claimed.store(false, std::memory_order_release);
+        }
+    };
+
+    // Pins a handle for the lifetime of the guard.
+    class Guard
+    {
+    private:
+        Handle &handle_;
+
+    public:
+        explicit Guard(Handle &handle) : handle_(handle) { handle_.pin(); }
+        ~Guard() { handle_.unpin(); }
+
+        Guard(const Guard &) = delete;
+        Guard &operator=(const Guard &) = delete;
+    };
+
+    // Returns the current global epoch.
+    uint64_t epoch() const { return epoch_.load(std::memory_order_acquire); }
+
+    // Returns the number of orphaned nodes not yet freed.
+    size_t orphanCount()
+    {
+        std::lock_guard<std::mutex> lock(orphanLock_);
+        return orphans_.size();
+    }
+
+    // Creates a domain for up to maxThreads handles at a time.
+    explicit EpochDomain(int maxThreads = 128)
+        : epoch_(2), slots_(new Slot[maxThreads > 0 ? maxThreads : 1]), slotCount_(maxThreads)
+    {
+        if (maxThreads <= 0)
+        {
+            throw std::runtime_error("Error: EpochDomain needs at least one thread slot.");
+        }
+    }
+
+    EpochDomain(const EpochDomain &) = delete;
+    EpochDomain &operator=(const EpochDomain &) = delete;
+
+    // Every handle must be gone, so all the remaining nodes can be freed.
+    ~EpochDomain()
+    {
+        for (const RetiredPointer &retired : orphans_)
+        {
+            retired.reclaim();
+        }
+    }
+};
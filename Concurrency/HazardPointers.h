@@ -0,0 +1,265 @@
+/**
+ * @file HazardPointers.h
+ * @author Kofi Boateng
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ *
+ */
+
+#pragma once
+#include <stdexcept> // for runtime_error
+#include <cstdint>   // for fixed width integers
+#include <atomic>    // for the published hazards
+#include <memory>    // for unique_ptr
+#include <mutex>     // for the orphan list
+#include <vector>    // retired nodes and scans
+#include <algorithm> // for sort and binary_search
+#include "RetiredPointer.h"
+
+// This is an implementation of hazard pointers (Michael, 2004), a memory reclamation scheme for lock-free
+// structures that, unlike EpochReclamation.h, keeps working when a thread stalls. Before a thread
+// dereferences a shared node, it publishes the node's address in one of its hazard slots, then re-reads
+// the source to make sure the node was not unlinked in between. A retired node is only freed once no
+// slot of any thread holds its address.
+// Retired nodes collect in a per-thread list. When the list reaches twice the total number of hazard
+// slots, the thread scans: it copies every published hazard into a sorted array and frees each retired
+// node that is not in it. At least half the list is freed by every scan, so reclamation is amortized
+// O(1) per node, and no more than that many nodes per thread are ever waiting, however slow other
+// threads are. The price is a store and a full fence for every protected pointer rather than once per
+// operation, so reads are slower than under EBR.
+//
+// Usage: every thread creates a HazardPointerDomain::Handle, protects each pointer it follows with a
+// HazardPointerDomain::Guard (one guard per pointer held at the same time) and retires unlinked nodes
+// with handle.retire(node).
+
+class HazardPointerDomain
+{
+private:
+    struct alignas(64) Record
+    {
+        std::unique_ptr<std::atomic<void *>[]> hazards;
+        std::atomic<bool> claimed;
+
+        Record() : claimed(false) {}
+    };
+
+    std::unique_ptr<Record[]> records_;
+    int recordCount_;
+    int hazardsPerThread_;
+
+    std::mutex orphanLock_;
+    std::vector<RetiredPointer> orphans_;
+
+    // Returns every non-null published hazard, sorted.
+    std::vector<void *> _hazards() const
+    {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        std::vector<void *> hazards;
+        for (int r = 0; r < recordCount_; r++)
+        {
+            for (int h = 0; h < hazardsPerThread_; h++)
+            {
+                void *hazard = records_[r].hazards[h].load(std::memory_order_seq_cst);
+                if (hazard)
+                {
+                    hazards.push_back(hazard);
+                }
+            }
+        }
+        std::sort(hazards.begin(), hazards.end());
+        return hazards;
+    }
+
+    // Frees every node in retired that no hazard protects, keeping the rest.
+    static void _free(std::vector<RetiredPointer> &retired, const std::vector<void *> &hazards)
+    {
+        size_t kept = 0;
+        for (size_t i = 0; i < retired.size(); i++)
+        {
+            if (std::binary_search(hazards.begin(), hazards.end(), retired[i].pointer))
+            {
+                retired[kept++] = retired[i];
+            }
+            else
+            {
+                retired[i].reclaim();
+            }
+        }
+        retired.resize(kept);
+    }
+
+public:
+    class Guard;
+
+    // A thread's registration with the domain and its hazard slots.
+    class Handle
+    {
+    private:
+        HazardPointerDomain &domain_;
+        Record *record_;
+        std::vector<RetiredPointer> retired_;
+
+        // Hazard slots not held by a guard.
+        std::vector<int> freeSlots_;
+
+        friend class Guard;
+
+    public:
+        // Schedules pointer to be destroyed with deleter once no hazard
+        // protects it. pointer must already be unreachable for new readers.
+        void retire(void *pointer, void (*deleter)(void *))
+        {
+            retired_.push_back(RetiredPointer{pointer, deleter, 0});
+            if (retired_.size() >= (size_t)(2 * domain_.recordCount_ * domain_.hazardsPerThread_))
+            {
+                collect();
+            }
+        }
+
+        template <typename T>
+        void retire(T *pointer) { retire(pointer, &deleteRetired<T>); }
+
+        // Frees every retired node that no thread protects.
+        void collect()
+        {
+            std::vector<void *> hazards = domain_._hazards();
+            _free(retired_, hazards);
+            std::unique_lock<std::mutex> lock(domain_.orphanLock_, std::try_to_lock);
+            if (lock.owns_lock())
+            {
+                _free(domain_.orphans_, hazards);
+            }
+        }
+
+        // Returns the number of nodes waiting to be freed by this thread.
+        size_t pending() const { return retired_.size(); }
+
+        explicit Handle(HazardPointerDomain &domain) : domain_(domain), record_(nullptr)
+        {
+            for (int i = 0; i < domain.recordCount_ && !record_; i++)
+            {
+                bool expected = false;
+                if (domain.records_[i].claimed.compare_exchange_strong(expected, true))
+                {
+                    record_ = &domain.records_[i];
+                }
+            }
+            if (!record_)
+            {
+                throw std::runtime_error("Error: HazardPointerDomain has no free thread slots.");
+            }
+            for (int h = domain.hazardsPerThread_ - 1; h >= 0; h--)
+            {
+                freeSlots_.push_back(h);
+            }
+        }
+
+        Handle(const Handle &) = delete;
+        Handle &operator=(const Handle &) = delete;
+
+        // Frees what it can and hands the rest to the domain.
+        ~Handle()
+        {
+            for (int h = 0; h < domain_.hazardsPerThread_; h++)
+            {
+                record_->hazards[h].store(nullptr, std::memory_order_release);
+            }
+            collect();
+            {
+                std::lock_guard<std::mutex> lock(domain_.orphanLock_);
+                domain_.orphans_.insert(domain_.orphans_.end(), retired_.begin(), retired_.end());
+            }
+            record_->claimed.store(false, std::memory_order_release);
+        }
+    };
+
+    // Holds one hazard slot of a handle for its lifetime.
+    class Guard
+    {
+    private:
+        Handle &handle_;
+        int slot_;
+
+        std::atomic<void *> &_hazard() { return handle_.record_->hazards[slot_]; }
+
+    public:
+        // Loads source and protects the result, retrying until the value is
+        // published before it could have been retired.
+        template <typename T>
+        T *protect(const std::atomic<T *> &source)
+        {
+            T *pointer = source.load(std::memory_order_relaxed);
+            while (true)
+            {
+                _hazard().store(pointer, std::memory_order_seq_cst);
+                T *current = source.load(std::memory_order_seq_cst);
+                if (current == pointer)
+                {
+                    return pointer;
+                }
+                pointer = current;
+            }
+        }
+
+        // Stops protecting the current pointer.
+        void clear() { _hazard().store(nullptr, std::memory_order_release); }
+
+        explicit Guard(Handle &handle) : handle_(handle)
+        {
+            if (handle.freeSlots_.empty())
+            {
+                throw std::runtime_error("Error: All hazard slots of this thread are in use.");
+            }
+            slot_ = handle.freeSlots_.back();
+            handle.freeSlots_.pop_back();
+        }
+
+        Guard(const Guard &) = delete;
+        Guard &operator=(const Guard &) = delete;
+
+        ~Guard()
+        {
+            clear();
+            handle_.freeSlots_.push_back(slot_);
+        }
+    };
+
+    // Returns the number of orphaned nodes not yet freed.
+    size_t orphanCount()
+    {
+        std::lock_guard<std::mutex> lock(orphanLock_);
+        return orphans_.size();
+    }
+
+    // Creates a domain for up to maxThreads handles with hazardsPerThread slots each.
+    explicit HazardPointerDomain(int maxThreads = 128, int hazardsPerThread = 2)
+        : records_(new Record[maxThreads > 0 ? maxThreads : 1]), recordCount_(maxThreads),
+          hazardsPerThread_(hazardsPerThread)
+    {
+        if (maxThreads <= 0 || hazardsPerThread <= 0)
+        {
+            throw std::runtime_error("Error: HazardPointerDomain needs at least one thread and one hazard slot.");
+        }
+        for (int r = 0; r < maxThreads; r++)
+        {
+            records_[r].hazards.reset(new std::atomic<void *>[hazardsPerThread]);
+            for (int h = 0; h < hazardsPerThread; h++)
+            {
+                records_[r].hazards[h].store(nullptr, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    HazardPointerDomain(const HazardPointerDomain &) = delete;
+    HazardPointerDomain &operator=(const HazardPointerDomain &) = delete;
+
+    // Every handle must be gone, so all the remaining nodes can be freed.
+    ~HazardPointerDomain()
+    {
+        for (const RetiredPointer &retired : orphans_)
+        {
+            retired.reclaim();
+        }
+    }
+};
@@ -0,0 +1,154 @@
+/**
+ * @file NumaTopology.h
+ * @author Kofi Boateng
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ *
+ */
+
+#pragma once
+#include <fstream> // for reading sysfs
+#include <sstream> // for parsing cpu lists
+#include <string>  // for sysfs paths
+#include <thread>  // for hardware_concurrency
+#include <vector>  // for the cpu lists
+#if defined(__linux__)
+#include <sched.h> // for sched_getcpu
+#endif
+
+// This is the NUMA layout of the machine as Linux reports it in /sys/devices/system/node: which memory
+// nodes are online and which CPUs belong to each. ThreadPool uses it to pin workers and to steal from its
+// own node first, and the NUMA-partitioned containers use it to decide how many shards to keep and where
+// the calling thread is running. On a machine without NUMA (or without sysfs) every CPU is reported on
+// node 0. The layout is read once, on first use.
+// Node ids are the kernel's and need not be dense: after a hot-remove, or on machines that number their
+// sockets sparsely, the online nodes can be 0, 2 and 3. Every function that takes or returns a node uses
+// those ids, so they can be passed straight to mbind (Refer to HugePageArena.h).
+
+class NumaTopology
+{
+private:
+    // The online nodes, in increasing order.
+    std::vector<int> nodes_;
+    // The CPUs of each node, indexed by node id.
+    std::vector<std::vector<int>> nodeCpus_;
+    // The node of each CPU, or -1 for CPUs no node lists.
+    std::vector<int> cpuNode_;
+
+    NumaTopology();
+
+    static const NumaTopology &_instance()
+    {
+        static NumaTopology topology;
+        return topology;
+    }
+
+    // Returns the first line of a sysfs file, or an empty string if it cannot be read.
+    static std::string _readLine(const std::string &path)
+    {
+        std::ifstream file(path);
+        std::string line;
+        std::getline(file, line);
+        return line;
+    }
+
+public:
+    // Parses a sysfs list such as "0-3,8-11" into its numbers, in the order listed.
+    static std::vector<int> parseList(const std::string &list);
+
+    // Returns the ids of the online nodes, in increasing order.
+    static const std::vector<int> &nodes() { return _instance().nodes_; }
+
+    // Returns the number of NUMA nodes. A memory-only node has no CPUs.
+    static int nodeCount() { return (int)_instance().nodes_.size(); }
+
+    // Returns the CPUs of node, in increasing order. Empty for an unknown node.
+    static const std::vector<int> &cpus(int node)
+    {
+        static const std::vector<int> none;
+        const std::vector<std::vector<int>> &nodeCpus = _instance().nodeCpus_;
+        return node >= 0 && (size_t)node < nodeCpus.size() ? nodeCpus[node] : none;
+    }
+
+    // Returns the node of cpu, or the first node if it is unknown.
+    static int nodeOf(int cpu)
+    {
+        const NumaTopology &topology = _instance();
+        int node = cpu >= 0 && (size_t)cpu < topology.cpuNode_.size() ? topology.cpuNode_[cpu] : -1;
+        return node >= 0 ? node : topology.nodes_[0];
+    }
+
+    // Returns the node the calling thread is running on right now.
+    static int currentNode()
+    {
+#if defined(__linux__)
+        return nodeOf(sched_getcpu());
+#else
+        return nodes()[0];
+#endif
+    }
+};
+
+// ===================================================================================
+// Implementation Section
+// ===================================================================================
+
+inline std::vector<int> NumaTopology::parseList(const std::string &list)
+{
+    std::vector<int> numbers;
+    std::stringstream ranges(list);
+    std::string range;
+    while (std::getline(ranges, range, ','))
+    {
+        if (range.find_first_of("0123456789") == std::string::npos)
+        {
+            continue;
+        }
+        size_t dash = range.find('-');
+        int first = std::stoi(range.substr(0, dash));
+        int last = dash == std::string::npos ? first : std::stoi(range.substr(dash + 1));
+        for (int number = first; number <= last; number++)
+        {
+            numbers.push_back(number);
+        }
+    }
+    return numbers;
+}
+
+inline NumaTopology::NumaTopology()
+{
+    const std::string root = "/sys/devices/system/node/";
+    bool anyCpu = false;
+    for (int node : parseList(_readLine(root + "online")))
+    {
+        if ((size_t)node >= nodeCpus_.size())
+        {
+            nodeCpus_.resize(node + 1);
+        }
+        std::vector<int> cpus = parseList(_readLine(root + "node" + std::to_string(node) + "/cpulist"));
+        for (int cpu : cpus)
+        {
+            if ((size_t)cpu >= cpuNode_.size())
+            {
+                cpuNode_.resize(cpu + 1, -1);
+            }
+            cpuNode_[cpu] = node;
+        }
+        anyCpu = anyCpu || !cpus.empty();
+        nodeCpus_[node] = cpus;
+        nodes_.push_back(node);
+    }
+    if (!anyCpu)
+    {
+        unsigned threads = std::thread::hardware_concurrency();
+        std::vector<int> cpus;
+        for (unsigned cpu = 0; cpu < (threads == 0 ? 1 : threads); cpu++)
+        {
+            cpus.push_back((int)cpu);
+        }
+        nodes_.assign(1, 0);
+        nodeCpus_.assign(1, cpus);
+        cpuNode_.assign(cpus.size(), 0);
+    }
+}
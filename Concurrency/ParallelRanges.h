@@ -0,0 +1,44 @@
+/**
+ * @file ParallelRanges.h
+ * @author Kofi Boateng
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ *
+ */
+
+#pragma once
+#include <cstddef> // for size_t
+#include "ThreadPool.h"
+
+// These are the simplest building blocks for data-parallel loops: split an index range into one
+// contiguous chunk per thread and run every chunk as a task on the shared ThreadPool::global(), which
+// returns when all are done. Unlike ThreadPool::parallelFor, the chunks are fixed and each one gets its
+// own index, so callers can keep one partial result or buffer per chunk. Chunks are static, so it works
+// best when every element costs about the same.
+
+// Splits [0, count) into one contiguous range per thread and runs
+// work(begin, end, thread) on each, returning when all are done.
+template <typename Work>
+void parallelRanges(size_t count, int threads, Work work)
+{
+    if (threads <= 1 || count < 2)
+    {
+        work((size_t)0, count, 0);
+        return;
+    }
+    ThreadPool::TaskGroup group(ThreadPool::global());
+    size_t chunk = (count + threads - 1) / threads;
+    for (int t = 0; t < threads; t++)
+    {
+        size_t begin = (size_t)t * chunk;
+        size_t end = begin + chunk < count ? begin + chunk : count;
+        if (begin >= end)
+        {
+            break;
+        }
+        group.run([&work, begin, end, t]()
+                  { work(begin, end, t); });
+    }
+    group.wait();
+}
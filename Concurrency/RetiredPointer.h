@@ -0,0 +1,32 @@
+/**
+ * @file RetiredPointer.h
+ * @author Kofi Boateng
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ *
+ */
+
+#pragma once
+#include <cstdint> // for fixed width integers
+
+// A node that has been unlinked from a concurrent structure but may still be read by other threads.
+// EpochReclamation.h and HazardPointers.h keep these until it is safe to run the deleter. The deleter
+// is a plain function pointer, so a retired node costs 24 bytes and no allocation of its own.
+
+struct RetiredPointer
+{
+    void *pointer;
+    void (*deleter)(void *);
+    // The global epoch when the node was retired (unused by hazard pointers).
+    uint64_t epoch;
+
+    void reclaim() const { deleter(pointer); }
+};
+
+// The default deleter: destroys a T allocated with new.
+template <typename T>
+void deleteRetired(void *pointer)
+{
+    delete static_cast<T *>(pointer);
+}
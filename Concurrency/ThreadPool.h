@@ -0,0 +1,592 @@
+/**
+ * @file ThreadPool.h
+ * @author Kofi Boateng
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ *
+ */
+
+#pragma once
+#include <stdexcept>          // for runtime_error
+#include <cstddef>            // for size_t
+#include <atomic>             // for counters and flags
+#include <condition_variable> // for sleeping workers
+#include <deque>              // per-worker task deques
+#include <exception>          // for exception_ptr
+#include <functional>         // for std::function
+#include <memory>             // for unique_ptr and shared_ptr
+#include <mutex>              // for deque locks
+#include <thread>             // worker threads
+#include <vector>             // workers and partial results
+#include "NumaTopology.h"
+#if defined(__linux__)
+#include <pthread.h> // for pthread_setaffinity_np
+#include <sched.h>   // for cpu_set_t
+#endif
+
+// This is an implementation of a work-stealing Thread Pool, the one scheduler that the parallel
+// algorithms in this repository share instead of each spawning its own std::threads.
+// Every worker owns a deque of tasks. A worker pushes the tasks it spawns onto the back of its own deque
+// and pops from the back, so it keeps working on the most recent, cache-warm task. An idle worker steals
+// from the front of another worker's deque, where the oldest and usually largest pieces of work are.
+// Each deque has its own small lock, so workers only contend when one of them is stealing.
+// parallelFor splits its range lazily: the running task keeps halving its range and pushes the right
+// half as a new task, so idle workers find large pieces to steal and busy ones never split further
+// than they need to. The automatic grain size aims for about eight pieces per worker.
+// A thread that waits for a TaskGroup runs queued tasks until the group is done, so parallel calls can
+// nest inside tasks (a parallel sort inside a parallel build) without deadlocking. Once there is nothing
+// it can run, it sleeps with the idle workers until a task is queued or the group's last task finishes.
+// Cancellation is cooperative. A cancelled CancellationToken stops parallelFor and parallelReduce from
+// starting new pieces, and long-running bodies can poll it themselves. Every TaskGroup has a token of its
+// own, a child of the one it was given, so cancelling the group stops only its tasks while cancelling
+// the caller's token stops the group as well. If a task throws, its group is cancelled and wait()
+// rethrows the first exception.
+// With pinWorkers, workers are pinned to CPUs ordered by NUMA node (Refer to NumaTopology.h), and a
+// worker tries to steal from workers on its own node before crossing to another one. submitToNode queues
+// a task with the workers of one node, which is how the NUMA-partitioned containers keep each shard's
+// work next to its memory.
+
+// Returns the default number of worker threads.
+inline int defaultThreadCount()
+{
+    unsigned threads = std::thread::hardware_concurrency();
+    return threads == 0 ? 1 : (int)threads;
+}
+
+// A cancellation flag shared by every copy of the token. A token made with child() also counts as
+// cancelled once its parent is, but cancelling the child leaves the parent alone.
+class CancellationToken
+{
+private:
+    struct State
+    {
+        std::atomic<bool> cancelled;
+        std::shared_ptr<const State> parent;
+
+        State() : cancelled(false) {}
+    };
+
+    std::shared_ptr<State> state_;
+
+public:
+    void cancel() { state_->cancelled.store(true, std::memory_order_release); }
+
+    bool isCancelled() const
+    {
+        for (const State *state = state_.get(); state; state = state->parent.get())
+        {
+            if (state->cancelled.load(std::memory_order_acquire))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Returns a new token that is cancelled when this one is.
+    CancellationToken child() const
+    {
+        CancellationToken token;
+        token.state_->parent = state_;
+        return token;
+    }
+
+    CancellationToken() : state_(std::make_shared<State>()) {}
+};
+
+class ThreadPool
+{
+public:
+    typedef std::function<void()> Task;
+
+    // A set of tasks that can be waited for together.
+    class TaskGroup
+    {
+    private:
+        ThreadPool &pool_;
+        std::atomic<size_t> pending_;
+        CancellationToken token_;
+        std::mutex errorLock_;
+        std::exception_ptr error_;
+
+        // Runs queued tasks, or sleeps when there are none, until every task
+        // of the group has finished.
+        void _waitForTasks()
+        {
+            while (pending_.load(std::memory_order_acquire) > 0)
+            {
+                if (!pool_._runOne())
+                {
+                    pool_._sleepUntil([this]()
+                                      { return pending_.load(std::memory_order_seq_cst) == 0; });
+                }
+            }
+        }
+
+    public:
+        // Runs task on the pool. It is skipped if the group was cancelled
+        // before it started.
+        void run(Task task)
+        {
+            pending_.fetch_add(1, std::memory_order_relaxed);
+            // The group may be gone as soon as the last task is counted off,
+            // so the task wakes waiters through the pool, not through the group.
+            ThreadPool *pool = &pool_;
+            pool_.submit([this, pool, task]()
+                         {
+                if (!token_.isCancelled())
+                {
+                    try
+                    {
+                        task();
+                    }
+                    catch (...)
+                    {
+                        std::lock_guard<std::mutex> lock(errorLock_);
+                        if (!error_)
+                        {
+                            error_ = std::current_exception();
+                        }
+                        token_.cancel();
+                    }
+                }
+                if (pending_.fetch_sub(1, std::memory_order_seq_cst) == 1)
+                {
+                    pool->_wakeAll();
+                } });
+        }
+
+        // Runs queued tasks until every task of the group has finished, then
+        // rethrows the first exception any of them threw.
+        void wait()
+        {
+            _waitForTasks();
+            if (error_)
+            {
+                std::exception_ptr error = error_;
+                error_ = nullptr;
+                std::rethrow_exception(error);
+            }
+        }
+
+        // Cancels the tasks of this group. The token it was made with is left alone.
+        void cancel() { token_.cancel(); }
+        const CancellationToken &token() const { return token_; }
+
+        explicit TaskGroup(ThreadPool &pool) : pool_(pool), pending_(0) {}
+
+        // The group is also cancelled once parent is.
+        TaskGroup(ThreadPool &pool, const CancellationToken &parent)
+            : pool_(pool), pending_(0), token_(parent.child()) {}
+
+        TaskGroup(const TaskGroup &) = delete;
+        TaskGroup &operator=(const TaskGroup &) = delete;
+
+        // Tasks refer to the group, so it cannot go away before they finish.
+        ~TaskGroup() { _waitForTasks(); }
+    };
+
+private:
+    struct alignas(64) Worker
+    {
+        std::mutex lock;
+        std::deque<Task> tasks;
+    };
+
+    std::vector<std::unique_ptr<Worker>> workers_;
+    std::vector<std::thread> threads_;
+
+    // Steal order for each worker: same NUMA node first.
+    std::vector<std::vector<int>> victims_;
+
+    // The workers of each NUMA node, indexed by node id, for submitToNode.
+    std::vector<std::vector<int>> nodeWorkers_;
+
+    std::atomic<size_t> queued_;
+    std::atomic<int> sleeping_;
+    // Threads sleeping in _sleepUntil, a subset of sleeping_.
+    std::atomic<int> waiting_;
+    std::atomic<bool> stopping_;
+    std::atomic<unsigned> nextWorker_;
+    std::atomic<unsigned> nextNodeWorker_;
+    std::mutex sleepLock_;
+    std::condition_variable wake_;
+
+    // The pool and worker index of the calling thread, if it is a worker.
+    static ThreadPool *&_currentPool()
+    {
+        static thread_local ThreadPool *pool = nullptr;
+        return pool;
+    }
+
+    static int &_currentWorker()
+    {
+        static thread_local int worker = -1;
+        return worker;
+    }
+
+    // Returns the worker index of the calling thread in this pool, or -1.
+    int _self() { return _currentPool() == this ? _currentWorker() : -1; }
+
+    // Pops a task from the back of the own deque, or steals one from the
+    // front of another. Returns false if every deque was empty.
+    bool _take(int self, Task &task);
+
+    // Runs one queued task, if there is one.
+    bool _runOne()
+    {
+        Task task;
+        if (!_take(_self(), task))
+        {
+            return false;
+        }
+        task();
+        return true;
+    }
+
+    void _workerLoop(int index);
+
+    // Sleeps with the idle workers until done() returns true or a task is
+    // queued. Whatever makes done() true must change it with a seq_cst
+    // operation and call _wakeAll() afterwards.
+    template <typename Done>
+    void _sleepUntil(Done done)
+    {
+        std::unique_lock<std::mutex> lock(sleepLock_);
+        sleeping_.fetch_add(1, std::memory_order_seq_cst);
+        waiting_.fetch_add(1, std::memory_order_seq_cst);
+        wake_.wait(lock, [this, &done]()
+                   { return done() || stopping_.load(std::memory_order_seq_cst) || queued_.load(std::memory_order_seq_cst) > 0; });
+        waiting_.fetch_sub(1, std::memory_order_seq_cst);
+        sleeping_.fetch_sub(1, std::memory_order_seq_cst);
+    }
+
+    // Wakes the sleeping threads if one of them is in _sleepUntil, so that it
+    // re-checks its condition.
+    void _wakeAll()
+    {
+        if (waiting_.load(std::memory_order_seq_cst) == 0)
+        {
+            return;
+        }
+        {
+            std::lock_guard<std::mutex> lock(sleepLock_);
+        }
+        wake_.notify_all();
+    }
+
+    template <typename Body>
+    void _splitFor(TaskGroup &group, size_t begin, size_t end, size_t grain, Body &body);
+
+    // Pushes task onto the back of worker's deque and wakes a sleeping worker.
+    void _push(Worker &worker, Task task)
+    {
+        {
+            std::lock_guard<std::mutex> lock(worker.lock);
+            worker.tasks.push_back(std::move(task));
+        }
+        queued_.fetch_add(1, std::memory_order_seq_cst);
+        if (sleeping_.load(std::memory_order_seq_cst) > 0)
+        {
+            std::lock_guard<std::mutex> lock(sleepLock_);
+            wake_.notify_one();
+        }
+    }
+
+public:
+    // Queues task to run on some worker. Prefer TaskGroup, which can be waited for.
+    void submit(Task task)
+    {
+        int self = _self();
+        _push(*workers_[self >= 0 ? (size_t)self : nextWorker_.fetch_add(1, std::memory_order_relaxed) % workers_.size()], std::move(task));
+    }
+
+    // Queues task on a worker of NUMA node (a NumaTopology node id, such as
+    // NumaHashTable::nodeOf returns), so that with pinWorkers it runs
+    // next to memory placed on that node. Workers of the node take it first;
+    // workers of other nodes only steal it once they have nothing else to do.
+    // Falls back to submit() if no worker belongs to node.
+    void submitToNode(int node, Task task)
+    {
+        if (node < 0 || (size_t)node >= nodeWorkers_.size() || nodeWorkers_[node].empty())
+        {
+            submit(std::move(task));
+            return;
+        }
+        const std::vector<int> &local = nodeWorkers_[node];
+        int self = _self();
+        size_t worker = local[nextNodeWorker_.fetch_add(1, std::memory_order_relaxed) % local.size()];
+        // A worker of the node keeps the task on its own deque.
+        for (int candidate : local)
+        {
+            if (candidate == self)
+            {
+                worker = (size_t)self;
+            }
+        }
+        _push(*workers_[worker], std::move(task));
+    }
+
+    // Calls body(begin, end) on pieces of [0, count) in parallel, pieces of
+    // at most grain indices (0 picks one), and returns when all are done.
+    template <typename Body>
+    void parallelFor(size_t count, Body body, size_t grain = 0, const CancellationToken &token = CancellationToken())
+    {
+        if (count == 0)
+        {
+            return;
+        }
+        if (grain == 0)
+        {
+            grain = count / (8 * workers_.size());
+            grain = grain == 0 ? 1 : grain;
+        }
+        TaskGroup group(*this, token);
+        _splitFor(group, 0, count, grain, body);
+        group.wait();
+    }
+
+    // Reduces [0, count) in parallel: map(begin, end) reduces a piece to a T,
+    // and the pieces are combined in index order, starting from identity.
+    template <typename T, typename Map, typename Combine>
+    T parallelReduce(size_t count, T identity, Map map, Combine combine, size_t grain = 0,
+                     const CancellationToken &token = CancellationToken())
+    {
+        if (count == 0)
+        {
+            return identity;
+        }
+        if (grain == 0)
+        {
+            grain = count / (8 * workers_.size());
+            grain = grain == 0 ? 1 : grain;
+        }
+        size_t pieces = (count + grain - 1) / grain;
+        std::vector<T> partial(pieces, identity);
+        parallelFor(pieces, [&](size_t first, size_t last)
+                    {
+            for (size_t p = first; p < last; p++)
+            {
+                size_t begin = p * grain;
+                size_t end = begin + grain < count ? begin + grain : count;
+                partial[p] = map(begin, end);
+            } }, 1, token);
+        T result = identity;
+        for (size_t p = 0; p < pieces; p++)
+        {
+            result = combine(result, partial[p]);
+        }
+        return result;
+    }
+
+    // Runs every function in parallel and returns when all have finished.
+    template <typename... Functions>
+    void parallelInvoke(Functions... functions)
+    {
+        TaskGroup group(*this);
+        int expand[] = {0, (group.run(Task(functions)), 0)...};
+        (void)expand;
+        group.wait();
+    }
+
+    // Returns the number of workers.
+    int size() const { return (int)workers_.size(); }
+
+    // Returns the number of NUMA nodes the workers are spread over.
+    int nodeCount() const
+    {
+        int count = 0;
+        for (const std::vector<int> &workers : nodeWorkers_)
+        {
+            count += workers.empty() ? 0 : 1;
+        }
+        return count;
+    }
+
+    // Returns the process-wide pool, created on first use.
+    static ThreadPool &global()
+    {
+        static ThreadPool pool;
+        return pool;
+    }
+
+    // Starts threads workers, pinned to CPUs by NUMA node if pinWorkers.
+    explicit ThreadPool(int threads = defaultThreadCount(), bool pinWorkers = false);
+
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool &operator=(const ThreadPool &) = delete;
+
+    // Stops the workers. Tasks still queued are dropped, so wait for groups first.
+    ~ThreadPool()
+    {
+        stopping_.store(true, std::memory_order_seq_cst);
+        {
+            std::lock_guard<std::mutex> lock(sleepLock_);
+            wake_.notify_all();
+        }
+        for (std::thread &thread : threads_)
+        {
+            thread.join();
+        }
+    }
+};
+
+// ===================================================================================
+// Implementation Section
+// ===================================================================================
+
+inline bool ThreadPool::_take(int self, Task &task)
+{
+    if (queued_.load(std::memory_order_acquire) == 0)
+    {
+        return false;
+    }
+    if (self >= 0)
+    {
+        Worker &own = *workers_[self];
+        std::lock_guard<std::mutex> lock(own.lock);
+        if (!own.tasks.empty())
+        {
+            task = std::move(own.tasks.back());
+            own.tasks.pop_back();
+            queued_.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+    const std::vector<int> &victims = victims_[self >= 0 ? (size_t)self : 0];
+    for (int victim : victims)
+    {
+        if (victim == self)
+        {
+            continue;
+        }
+        Worker &worker = *workers_[victim];
+        std::lock_guard<std::mutex> lock(worker.lock);
+        if (!worker.tasks.empty())
+        {
+            task = std::move(worker.tasks.front());
+            worker.tasks.pop_front();
+            queued_.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+    return false;
+}
+
+inline void ThreadPool::_workerLoop(int index)
+{
+    _currentPool() = this;
+    _currentWorker() = index;
+    int idleRounds = 0;
+    while (!stopping_.load(std::memory_order_acquire))
+    {
+        Task task;
+        if (_take(index, task))
+        {
+            task();
+            idleRounds = 0;
+            continue;
+        }
+        // Spin briefly before going to sleep, since work often arrives in bursts.
+        if (++idleRounds < 64)
+        {
+            std::this_thread::yield();
+            continue;
+        }
+        std::unique_lock<std::mutex> lock(sleepLock_);
+        sleeping_.fetch_add(1, std::memory_order_seq_cst);
+        wake_.wait(lock, [this]()
+                   { return stopping_.load(std::memory_order_seq_cst) || queued_.load(std::memory_order_seq_cst) > 0; });
+        sleeping_.fetch_sub(1, std::memory_order_seq_cst);
+        idleRounds = 0;
+    }
+}
+
+inline ThreadPool::ThreadPool(int threads, bool pinWorkers)
+    : queued_(0), sleeping_(0), waiting_(0), stopping_(false), nextWorker_(0), nextNodeWorker_(0)
+{
+    if (threads <= 0)
+    {
+        throw std::runtime_error("Error: ThreadPool needs at least one worker.");
+    }
+    // Every CPU in node order, with its node.
+    std::vector<int> cpus;
+    std::vector<int> nodes;
+    for (int node : NumaTopology::nodes())
+    {
+        for (int cpu : NumaTopology::cpus(node))
+        {
+            cpus.push_back(cpu);
+            nodes.push_back(node);
+        }
+    }
+
+    // Worker i runs on cpus[i] (modulo the CPU count) and belongs to its node.
+    std::vector<int> workerNode(threads);
+    for (int i = 0; i < threads; i++)
+    {
+        workers_.emplace_back(new Worker());
+        workerNode[i] = nodes[i % nodes.size()];
+    }
+    nodeWorkers_.resize(NumaTopology::nodes().back() + 1);
+    for (int i = 0; i < threads; i++)
+    {
+        nodeWorkers_[workerNode[i]].push_back(i);
+    }
+    victims_.resize(threads);
+    for (int i = 0; i < threads; i++)
+    {
+        // Start after i so that thieves spread over different victims.
+        for (int pass = 0; pass < 2; pass++)
+        {
+            for (int offset = 1; offset <= threads; offset++)
+            {
+                int victim = (i + offset) % threads;
+                if ((workerNode[victim] == workerNode[i]) == (pass == 0))
+                {
+                    victims_[i].push_back(victim);
+                }
+            }
+        }
+    }
+
+    for (int i = 0; i < threads; i++)
+    {
+        threads_.emplace_back(&ThreadPool::_workerLoop, this, i);
+#if defined(__linux__)
+        if (pinWorkers)
+        {
+            cpu_set_t set;
+            CPU_ZERO(&set);
+            CPU_SET(cpus[i % cpus.size()], &set);
+            // Pinning is best effort; a restricted affinity mask makes it fail.
+            pthread_setaffinity_np(threads_.back().native_handle(), sizeof(set), &set);
+        }
+#else
+        (void)pinWorkers;
+#endif
+    }
+}
+
+template <typename Body>
+void ThreadPool::_splitFor(TaskGroup &group, size_t begin, size_t end, size_t grain, Body &body)
+{
+    // Keep the left half and hand the right half to the pool, until the
+    // piece is small enough to run.
+    while (end - begin > grain)
+    {
+        if (group.token().isCancelled())
+        {
+            return;
+        }
+        size_t middle = begin + (end - begin) / 2;
+        group.run([this, &group, middle, end, grain, &body]()
+                  { _splitFor(group, middle, end, grain, body); });
+        end = middle;
+    }
+    if (!group.token().isCancelled())
+    {
+        body(begin, end);
+    }
+}
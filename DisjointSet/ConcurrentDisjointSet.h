@@ -0,0 +1,155 @@
+/**
+ * @file ConcurrentDisjointSet.h
+ * @author Kofi Boateng
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ *
+ */
+
+#pragma once
+#include <stdexcept> // for runtime_error
+#include <cstdint>   // for fixed width integers
+#include <vector>    // parent array
+#include <atomic>    // for compare-and-swap on parents
+#include "../Hashing/HashMixer.h"
+
+// This is a lock-free version of DisjointSet.h that any number of threads can use at the same time,
+// following Jayanti and Tarjan's randomized concurrent union-find. Parents are atomics and every change
+// is a compare-and-swap (CAS), so no thread ever waits for another.
+// unite links one root under the other with a CAS on the root's parent, which only succeeds if the
+// node is still a root. If another thread got there first, it re-finds both roots and tries again.
+// Ranks cannot be kept consistent with the parent without locking, so the order of linking comes from
+// a fixed pseudo-random priority per element (a hash of its index): the lower priority root always goes
+// under the higher one. That gives the same expected O(log n) tree height as union by rank.
+// find uses path halving, also by CAS. A failed CAS only means another thread already shortened the path,
+// so it is simply ignored.
+// setCount() is exact once all threads are done; while they run it is only an estimate.
+
+class ConcurrentDisjointSet
+{
+private:
+    std::vector<std::atomic<uint32_t>> parent_;
+
+    // Number of disjoint sets left.
+    std::atomic<int> setCount_;
+
+    // Linking priority of element x. Ties are broken by index.
+    static bool _lowerPriority(uint32_t x, uint32_t y)
+    {
+        uint64_t px = mixHash(x);
+        uint64_t py = mixHash(y);
+        return px < py || (px == py && x < y);
+    }
+
+    void _checkElement(int x) const
+    {
+        if (x < 0 || x >= (int)parent_.size())
+        {
+            throw std::runtime_error("Error: ConcurrentDisjointSet element is out of range.");
+        }
+    }
+
+    uint32_t _find(uint32_t x)
+    {
+        uint32_t parent = parent_[x].load(std::memory_order_acquire);
+        while (parent != x)
+        {
+            uint32_t grandparent = parent_[parent].load(std::memory_order_acquire);
+            if (parent != grandparent)
+            {
+                parent_[x].compare_exchange_weak(parent, grandparent, std::memory_order_release,
+                                                 std::memory_order_relaxed);
+            }
+            x = grandparent;
+            parent = parent_[x].load(std::memory_order_acquire);
+        }
+        return x;
+    }
+
+public:
+    // Returns the representative of the set that contains x. While other
+    // threads unite, the representative may change right after it is returned.
+    int find(int x)
+    {
+        _checkElement(x);
+        return (int)_find((uint32_t)x);
+    }
+
+    // Merges the sets that contain x and y. Returns false if they were
+    // already in the same set. Safe to call from several threads at once.
+    bool unite(int x, int y)
+    {
+        _checkElement(x);
+        _checkElement(y);
+        uint32_t rootX = (uint32_t)x;
+        uint32_t rootY = (uint32_t)y;
+        while (true)
+        {
+            rootX = _find(rootX);
+            rootY = _find(rootY);
+            if (rootX == rootY)
+            {
+                return false;
+            }
+            if (!_lowerPriority(rootX, rootY))
+            {
+                uint32_t swap = rootX;
+                rootX = rootY;
+                rootY = swap;
+            }
+            uint32_t expected = rootX;
+            if (parent_[rootX].compare_exchange_strong(expected, rootY, std::memory_order_acq_rel))
+            {
+                setCount_.fetch_sub(1, std::memory_order_relaxed);
+                return true;
+            }
+        }
+    }
+
+    // Returns whether x and y are in the same set. The answer is exact for
+    // the moment it was taken: if x's root was still a root after both finds,
+    // the two were in different sets at that point.
+    bool sameSet(int x, int y)
+    {
+        _checkElement(x);
+        _checkElement(y);
+        uint32_t rootX = (uint32_t)x;
+        uint32_t rootY = (uint32_t)y;
+        while (true)
+        {
+            rootX = _find(rootX);
+            rootY = _find(rootY);
+            if (rootX == rootY)
+            {
+                return true;
+            }
+            if (parent_[rootX].load(std::memory_order_acquire) == rootX)
+            {
+                return false;
+            }
+        }
+    }
+
+    // Returns the number of elements.
+    int size() const { return (int)parent_.size(); }
+
+    // Returns the number of disjoint sets.
+    int setCount() const { return setCount_.load(std::memory_order_relaxed); }
+
+    // Creates n singleton sets {0}, {1}, ..., {n - 1}.
+    explicit ConcurrentDisjointSet(int n) : parent_(n < 0 ? 0 : n), setCount_(n)
+    {
+        if (n < 0)
+        {
+            throw std::runtime_error("Error: ConcurrentDisjointSet cannot have a negative number of elements.");
+        }
+        for (int i = 0; i < n; i++)
+        {
+            parent_[i].store((uint32_t)i, std::memory_order_relaxed);
+        }
+    }
+
+    ConcurrentDisjointSet(const ConcurrentDisjointSet &) = delete;
+    ConcurrentDisjointSet &operator=(const ConcurrentDisjointSet &) = delete;
+};
@@ -0,0 +1,112 @@
+/**
+ * @file DisjointSet.h
+ * @author Kofi Boateng
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ *
+ */
+
+#pragma once
+#include <stdexcept> // for runtime_error
+#include <cstdint>   // for fixed width integers
+#include <vector>    // parent and rank arrays
+
+// This is an implementation of a Disjoint-Set, also called Union-Find. It keeps the elements 0..n-1
+// partitioned into sets and supports merging two sets (unite) and asking which set an element is in
+// (find). Every set is a tree stored in a flat parent array, and the root is the set's representative.
+// Two techniques keep the trees shallow. Union by rank hangs the shorter tree under the taller one, so
+// a tree of height h has at least 2^h elements. Path halving makes every node on a find path point to
+// its grandparent, which flattens the tree as a side effect of looking it up. Together they make each
+// operation take O(alpha(n)) amortized time, where alpha is the inverse Ackermann function (at most 4
+// for any practical n).
+// Ranks never exceed log2(n), so they fit in one byte each. This version is single-threaded; see
+// ConcurrentDisjointSet.h to unite from several threads at once.
+
+class DisjointSet
+{
+private:
+    std::vector<uint32_t> parent_;
+    std::vector<uint8_t> rank_;
+
+    // Number of disjoint sets left.
+    int setCount_;
+
+    void _checkElement(int x) const
+    {
+        if (x < 0 || x >= (int)parent_.size())
+        {
+            throw std::runtime_error("Error: DisjointSet element is out of range.");
+        }
+    }
+
+public:
+    // Returns the representative of the set that contains x.
+    int find(int x)
+    {
+        _checkElement(x);
+        uint32_t current = (uint32_t)x;
+        while (parent_[current] != current)
+        {
+            // Path halving: skip over the parent.
+            parent_[current] = parent_[parent_[current]];
+            current = parent_[current];
+        }
+        return (int)current;
+    }
+
+    // Merges the sets that contain x and y. Returns false if they were
+    // already in the same set.
+    bool unite(int x, int y)
+    {
+        uint32_t rootX = (uint32_t)find(x);
+        uint32_t rootY = (uint32_t)find(y);
+        if (rootX == rootY)
+        {
+            return false;
+        }
+        if (rank_[rootX] < rank_[rootY])
+        {
+            uint32_t swap = rootX;
+            rootX = rootY;
+            rootY = swap;
+        }
+        parent_[rootY] = rootX;
+        if (rank_[rootX] == rank_[rootY])
+        {
+            rank_[rootX]++;
+        }
+        setCount_--;
+        return true;
+    }
+
+    // Returns whether x and y are in the same set.
+    bool sameSet(int x, int y) { return find(x) == find(y); }
+
+    // Returns the number of elements.
+    int size() const { return (int)parent_.size(); }
+
+    // Returns the number of disjoint sets.
+    int setCount() const { return setCount_; }
+
+    // Puts every element back into its own set.
+    void reset()
+    {
+        for (size_t i = 0; i < parent_.size(); i++)
+        {
+            parent_[i] = (uint32_t)i;
+        }
+        rank_.assign(parent_.size(), 0);
+        setCount_ = (int)parent_.size();
+    }
+
+    // Creates n singleton sets {0}, {1}, ..., {n - 1}.
+    explicit DisjointSet(int n) : parent_(n < 0 ? 0 : n), rank_(n < 0 ? 0 : n, 0), setCount_(n)
+    {
+        if (n < 0)
+        {
+            throw std::runtime_error("Error: DisjointSet cannot have a negative number of elements.");
+        }
+        reset();
+    }
+};
@@ -0,0 +1,203 @@
+/**
+ * @file CSRGraph.h
+ * @author Kofi Boateng
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ *
+ */
+
+#pragma once
+#include <stdexcept> // for runtime_error
+#include <cstdint>   // for fixed width integers
+#include <vector>    // offset, target and weight arrays
+
+// This is an implementation of a graph stored in Compressed Sparse Row (CSR) form. Instead of a list of
+// nodes per vertex, all adjacency lists are packed back to back in one targets array, and offsets[v]
+// gives the position where vertex v's neighbours start (they end at offsets[v + 1]). A vertex costs
+// 8 bytes and an edge 4 bytes (plus the weight, if any), and scanning a neighbourhood is a linear walk
+// over contiguous memory. A graph with 10^8 edges fits in well under a gigabyte.
+// The graph is built once from an edge list with a counting sort (count degrees, prefix sum, scatter),
+// which is O(V + E) and never reallocates. It is immutable afterwards; build a new one to change it.
+// Undirected graphs store every edge in both directions. Directed graphs also keep the reverse (incoming)
+// adjacency, which the bottom-up step of breadthFirstSearch in GraphSearch.h needs.
+// Vertices are numbered 0..vertexCount() - 1. W is the edge weight type; weights are only stored when
+// the graph is built with them.
+
+template <typename W = float>
+class CSRGraph
+{
+public:
+    // An edge of the input list. The weight is ignored by unweighted builds.
+    struct Edge
+    {
+        uint32_t from;
+        uint32_t to;
+        W weight;
+    };
+
+    // A view over one adjacency list, usable in a range-based for loop.
+    struct Neighbors
+    {
+        const uint32_t *first;
+        const uint32_t *last;
+
+        const uint32_t *begin() const { return first; }
+        const uint32_t *end() const { return last; }
+        int size() const { return (int)(last - first); }
+    };
+
+private:
+    int vertexCount_;
+    bool directed_;
+    bool weighted_;
+
+    // Outgoing adjacency: neighbours of v are targets_[offsets_[v] .. offsets_[v + 1]).
+    std::vector<uint64_t> offsets_;
+    std::vector<uint32_t> targets_;
+
+    // Parallel to targets_, empty for unweighted graphs.
+    std::vector<W> weights_;
+
+    // Incoming adjacency of a directed graph. Empty for undirected graphs,
+    // whose outgoing lists already are the incoming ones.
+    std::vector<uint64_t> inOffsets_;
+    std::vector<uint32_t> inSources_;
+
+    // Fills offsets, targets and (if weights is non-null) weights from the
+    // edge list. reverse swaps the ends of every edge; both adds each edge in
+    // both directions.
+    void _fill(const std::vector<Edge> &edges, bool reverse, bool both, std::vector<uint64_t> &offsets,
+               std::vector<uint32_t> &targets, std::vector<W> *weights) const;
+
+public:
+    // Returns the number of vertices.
+    int vertexCount() const { return vertexCount_; }
+
+    // Returns the number of stored (directed) edges. An undirected edge counts twice.
+    uint64_t edgeCount() const { return targets_.size(); }
+
+    bool isDirected() const { return directed_; }
+    bool isWeighted() const { return weighted_; }
+
+    // Returns the vertices that v has an edge to.
+    Neighbors neighbors(int v) const
+    {
+        return Neighbors{targets_.data() + offsets_[v], targets_.data() + offsets_[v + 1]};
+    }
+
+    // Returns the vertices that have an edge to v.
+    Neighbors inNeighbors(int v) const
+    {
+        if (!directed_)
+        {
+            return neighbors(v);
+        }
+        return Neighbors{inSources_.data() + inOffsets_[v], inSources_.data() + inOffsets_[v + 1]};
+    }
+
+    // Returns the weights of v's outgoing edges, in the order of neighbors(v).
+    const W *weights(int v) const
+    {
+        if (!weighted_)
+        {
+            throw std::runtime_error("Error: Asking for the weights of an unweighted graph.");
+        }
+        return weights_.data() + offsets_[v];
+    }
+
+    int outDegree(int v) const { return (int)(offsets_[v + 1] - offsets_[v]); }
+    int inDegree(int v) const { return directed_ ? (int)(inOffsets_[v + 1] - inOffsets_[v]) : outDegree(v); }
+
+    // Returns the approximate memory used by the adjacency arrays, in bytes.
+    size_t memoryBytes() const
+    {
+        return (offsets_.size() + inOffsets_.size()) * sizeof(uint64_t) +
+               (targets_.size() + inSources_.size()) * sizeof(uint32_t) + weights_.size() * sizeof(W);
+    }
+
+    // Builds a graph on vertexCount vertices from an edge list. Edges of an
+    // undirected graph are stored in both directions. Throws if an edge
+    // refers to a vertex that does not exist.
+    CSRGraph(int vertexCount, const std::vector<Edge> &edges, bool directed, bool weighted = false);
+
+    // An empty graph with no vertices.
+    CSRGraph() : vertexCount_(0), directed_(false), weighted_(false), offsets_(1, 0) {}
+};
+
+// ===================================================================================
+// Implementation Section
+// ===================================================================================
+
+template <typename W>
+CSRGraph<W>::CSRGraph(int vertexCount, const std::vector<Edge> &edges, bool directed, bool weighted)
+    : vertexCount_(vertexCount), directed_(directed), weighted_(weighted)
+{
+    if (vertexCount < 0)
+    {
+        throw std::runtime_error("Error: A graph cannot have a negative number of vertices.");
+    }
+    for (const Edge &edge : edges)
+    {
+        if (edge.from >= (uint32_t)vertexCount || edge.to >= (uint32_t)vertexCount)
+        {
+            throw std::runtime_error("Error: Edge refers to a vertex outside the graph.");
+        }
+    }
+
+    _fill(edges, false, !directed, offsets_, targets_, weighted ? &weights_ : nullptr);
+    if (directed)
+    {
+        _fill(edges, true, false, inOffsets_, inSources_, nullptr);
+    }
+}
+
+template <typename W>
+void CSRGraph<W>::_fill(const std::vector<Edge> &edges, bool reverse, bool both, std::vector<uint64_t> &offsets,
+                        std::vector<uint32_t> &targets, std::vector<W> *weights) const
+{
+    // Count the degree of every vertex, shifted by one so the prefix sum
+    // leaves the start of each list in offsets[v].
+    offsets.assign((size_t)vertexCount_ + 1, 0);
+    for (const Edge &edge : edges)
+    {
+        offsets[(reverse ? edge.to : edge.from) + 1]++;
+        if (both)
+        {
+            offsets[(reverse ? edge.from : edge.to) + 1]++;
+        }
+    }
+    for (int v = 0; v < vertexCount_; v++)
+    {
+        offsets[v + 1] += offsets[v];
+    }
+
+    targets.resize(offsets[vertexCount_]);
+    if (weights)
+    {
+        weights->resize(offsets[vertexCount_]);
+    }
+
+    // Scatter every edge to the next free position of its source's list.
+    std::vector<uint64_t> cursor(offsets.begin(), offsets.end() - 1);
+    for (const Edge &edge : edges)
+    {
+        uint32_t source = reverse ? edge.to : edge.from;
+        uint32_t target = reverse ? edge.from : edge.to;
+        uint64_t position = cursor[source]++;
+        targets[position] = target;
+        if (weights)
+        {
+            (*weights)[position] = edge.weight;
+        }
+        if (both)
+        {
+            position = cursor[target]++;
+            targets[position] = source;
+            if (weights)
+            {
+                (*weights)[position] = edge.weight;
+            }
+        }
+    }
+}
@@ -0,0 +1,301 @@
+/**
+ * @file GraphSearch.h
+ * @author Kofi Boateng
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ *
+ */
+
+#pragma once
+#include <stdexcept> // for runtime_error
+#include <cstdint>   // for fixed width integers
+#include <vector>    // frontiers, bitmaps and results
+#include <limits>    // for infinity
+#include <utility>   // for pair
+#include <algorithm> // for reverse
+#include "CSRGraph.h"
+#include "../Stack/Stack.h"
+#include "../Heap/PriorityQueue.h"
+
+// These are the classic graph searches over a CSRGraph.
+// breadthFirstSearch is direction-optimizing (Beamer et al.). The usual top-down step expands each
+// vertex of the frontier and checks all of its edges. Once the frontier grows large, most of those edges
+// lead to vertices that were already visited, so the search switches to a bottom-up step: every
+// unvisited vertex scans its incoming edges and stops at the first parent it finds in the frontier,
+// which is held as a bitmap. When the frontier shrinks again, it switches back. On low-diameter graphs
+// this skips most edge checks. The search runs level by level over two arrays instead of a QueueADT,
+// because the frontier needs to be turned into a bitmap and back between levels.
+// depthFirstSearch is iterative and keeps one (vertex, next edge) frame per vertex on the path on a
+// Stack, so deep graphs cannot overflow the call stack. It visits vertices in the same order as the
+// recursive version.
+// dijkstra and aStar use PriorityQueueADT, which has no decrease-key. Instead, a vertex is pushed again
+// whenever its distance improves, and entries that are older than the vertex's current distance are
+// skipped when they are popped ("lazy deletion"). The heap then holds O(E) entries at worst, which is
+// usually faster than maintaining positions for a decrease-key.
+
+// Distance, in edges, of vertices that a breadth first search did not reach.
+const int unreachedDepth = -1;
+
+// The result of a breadth first search. parent[source] == source, and
+// vertices that were not reached have parent -1 and depth unreachedDepth.
+struct BreadthFirstResult
+{
+    std::vector<int> parent;
+    std::vector<int> depth;
+};
+
+// Distance of vertices that a shortest path search did not reach: infinity
+// for floating point weights, the largest value for integral ones.
+template <typename W>
+W unreachedDistance()
+{
+    return std::numeric_limits<W>::has_infinity ? std::numeric_limits<W>::infinity() : std::numeric_limits<W>::max();
+}
+
+// The result of a shortest path search. Unreached vertices have distance
+// unreachedDistance<W>() and parent -1.
+template <typename W>
+struct ShortestPathResult
+{
+    std::vector<W> distance;
+    std::vector<int> parent;
+
+    // Returns the vertices on the shortest path from the source to target,
+    // source first. Empty if target was not reached.
+    std::vector<int> pathTo(int target) const
+    {
+        std::vector<int> path;
+        if (distance[target] == unreachedDistance<W>())
+        {
+            return path;
+        }
+        for (int v = target; v != -1; v = parent[v] == v ? -1 : parent[v])
+        {
+            path.push_back(v);
+        }
+        std::reverse(path.begin(), path.end());
+        return path;
+    }
+};
+
+// Returns the breadth first tree of the vertices reachable from source.
+// alpha and beta control the switches: go bottom-up once the frontier's
+// edges exceed 1/alpha of the unexplored edges, and back top-down once the
+// frontier holds fewer than 1/beta of the vertices.
+template <typename W>
+BreadthFirstResult breadthFirstSearch(const CSRGraph<W> &graph, int source, int alpha = 15, int beta = 18)
+{
+    int n = graph.vertexCount();
+    if (source < 0 || source >= n)
+    {
+        throw std::runtime_error("Error: breadthFirstSearch source is not a vertex of the graph.");
+    }
+
+    BreadthFirstResult result;
+    result.parent.assign(n, -1);
+    result.depth.assign(n, unreachedDepth);
+    result.parent[source] = source;
+    result.depth[source] = 0;
+
+    std::vector<uint32_t> frontier(1, (uint32_t)source);
+    std::vector<uint32_t> next;
+    size_t words = ((size_t)n + 63) / 64;
+    std::vector<uint64_t> frontierBits;
+
+    // Edges still to be checked by a top-down step, and edges out of the frontier.
+    uint64_t unexploredEdges = graph.edgeCount() - (uint64_t)graph.outDegree(source);
+    uint64_t frontierEdges = (uint64_t)graph.outDegree(source);
+    bool bottomUp = false;
+
+    for (int level = 1; !frontier.empty(); level++)
+    {
+        if (!bottomUp && frontierEdges > unexploredEdges / (uint64_t)alpha)
+        {
+            bottomUp = true;
+        }
+        else if (bottomUp && frontier.size() < (size_t)n / (size_t)beta)
+        {
+            bottomUp = false;
+        }
+
+        next.clear();
+        if (bottomUp)
+        {
+            frontierBits.assign(words, 0);
+            for (uint32_t v : frontier)
+            {
+                frontierBits[v >> 6] |= 1ULL << (v & 63);
+            }
+            for (int v = 0; v < n; v++)
+            {
+                if (result.depth[v] != unreachedDepth)
+                {
+                    continue;
+                }
+                for (uint32_t u : graph.inNeighbors(v))
+                {
+                    if (frontierBits[u >> 6] & (1ULL << (u & 63)))
+                    {
+                        result.parent[v] = (int)u;
+                        result.depth[v] = level;
+                        next.push_back((uint32_t)v);
+                        break;
+                    }
+                }
+            }
+        }
+        else
+        {
+            for (uint32_t u : frontier)
+            {
+                for (uint32_t v : graph.neighbors((int)u))
+                {
+                    if (result.depth[v] == unreachedDepth)
+                    {
+                        result.parent[v] = (int)u;
+                        result.depth[v] = level;
+                        next.push_back(v);
+                    }
+                }
+            }
+        }
+
+        frontier.swap(next);
+        frontierEdges = 0;
+        for (uint32_t v : frontier)
+        {
+            frontierEdges += (uint64_t)graph.outDegree((int)v);
+        }
+        unexploredEdges -= frontierEdges < unexploredEdges ? frontierEdges : unexploredEdges;
+    }
+    return result;
+}
+
+// Returns the vertices reachable from source in depth first preorder.
+// visit, if given, is called on each vertex as it is discovered.
+template <typename W, typename Visitor>
+std::vector<int> depthFirstSearch(const CSRGraph<W> &graph, int source, Visitor visit)
+{
+    int n = graph.vertexCount();
+    if (source < 0 || source >= n)
+    {
+        throw std::runtime_error("Error: depthFirstSearch source is not a vertex of the graph.");
+    }
+
+    // A vertex on the current path and the next of its edges to follow.
+    struct Frame
+    {
+        uint32_t vertex;
+        const uint32_t *nextEdge;
+    };
+
+    std::vector<bool> visited(n, false);
+    std::vector<int> order;
+    Stack<Frame> path;
+
+    visited[source] = true;
+    order.push_back(source);
+    visit(source);
+    path.push(Frame{(uint32_t)source, graph.neighbors(source).begin()});
+
+    while (!path.isEmpty())
+    {
+        Frame &frame = path.top();
+        const uint32_t *last = graph.neighbors((int)frame.vertex).end();
+        while (frame.nextEdge != last && visited[*frame.nextEdge])
+        {
+            frame.nextEdge++;
+        }
+        if (frame.nextEdge == last)
+        {
+            path.pop();
+            continue;
+        }
+
+        uint32_t v = *frame.nextEdge++;
+        visited[v] = true;
+        order.push_back((int)v);
+        visit((int)v);
+        path.push(Frame{v, graph.neighbors((int)v).begin()});
+    }
+    return order;
+}
+
+template <typename W>
+std::vector<int> depthFirstSearch(const CSRGraph<W> &graph, int source)
+{
+    return depthFirstSearch(graph, source, [](int) {});
+}
+
+// Runs A* from source towards target with a consistent heuristic, which
+// never over-estimates the remaining distance to target and never drops by
+// more than an edge's weight along that edge. Stops as soon as
+// target is settled. With a heuristic that is always 0, and target -1, this is
+// Dijkstra's algorithm over the whole graph. Throws on negative weights.
+template <typename W, typename Heuristic>
+ShortestPathResult<W> aStar(const CSRGraph<W> &graph, int source, int target, Heuristic heuristic)
+{
+    int n = graph.vertexCount();
+    if (source < 0 || source >= n || target < -1 || target >= n)
+    {
+        throw std::runtime_error("Error: Shortest path endpoints are not vertices of the graph.");
+    }
+    if (!graph.isWeighted())
+    {
+        throw std::runtime_error("Error: Shortest paths need a weighted graph.");
+    }
+
+    ShortestPathResult<W> result;
+    result.distance.assign(n, unreachedDistance<W>());
+    result.parent.assign(n, -1);
+    result.distance[source] = 0;
+    result.parent[source] = source;
+
+    // Entries are (distance + heuristic, vertex), smallest first.
+    PriorityQueueADT<std::pair<W, int>> queue;
+    queue.insert(std::make_pair((W)heuristic(source), source));
+
+    std::vector<bool> settled(n, false);
+    while (!queue.isEmpty())
+    {
+        int u = queue.peek().second;
+        queue.removeMin();
+        // A stale entry for a vertex that was already settled.
+        if (settled[u])
+        {
+            continue;
+        }
+        settled[u] = true;
+        if (u == target)
+        {
+            break;
+        }
+
+        const W *weights = graph.weights(u);
+        int i = 0;
+        for (uint32_t v : graph.neighbors(u))
+        {
+            W weight = weights[i++];
+            if (weight < 0)
+            {
+                throw std::runtime_error("Error: Shortest path search found a negative edge weight.");
+            }
+            W candidate = result.distance[u] + weight;
+            if (candidate < result.distance[v])
+            {
+                result.distance[v] = candidate;
+                result.parent[v] = u;
+                queue.insert(std::make_pair(candidate + (W)heuristic((int)v), (int)v));
+            }
+        }
+    }
+    return result;
+}
+
+// Returns the shortest distances from source to every vertex.
+template <typename W>
+ShortestPathResult<W> dijkstra(const CSRGraph<W> &graph, int source)
+{
+    return aStar(graph, source, -1, [](int) { return (W)0; });
+}
@@ -0,0 +1,89 @@
+/**
+ * @file MinimumSpanningTree.h
+ * @author Kofi Boateng
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ *
+ */
+
+#pragma once
+#include <stdexcept> // for runtime_error
+#include <cstdint>   // for fixed width integers
+#include <vector>    // edge lists
+#include <algorithm> // for sort
+#include <utility>   // for move
+#include "CSRGraph.h"
+#include "../DisjointSet/DisjointSet.h"
+
+// This is an implementation of Kruskal's Minimum Spanning Tree algorithm. The edges are sorted by weight
+// and taken from lightest to heaviest; an edge joins the tree unless both of its ends are already
+// connected, which a DisjointSet answers in near constant time. If the graph is disconnected, the result
+// is a minimum spanning forest with one tree per component.
+// The edges are sorted once up front with std::sort instead of being popped one at a time from a
+// PriorityQueueADT. Kruskal needs every edge in order anyway, and a sort over one contiguous array is
+// several times faster than E heap removals. The loop stops as soon as every vertex is connected, so
+// on dense connected graphs the heaviest edges are never looked at.
+
+// A minimum spanning forest: the chosen edges and their total weight.
+template <typename W>
+struct SpanningForest
+{
+    std::vector<typename CSRGraph<W>::Edge> edges;
+    double totalWeight;
+};
+
+// Returns a minimum spanning forest of the undirected graph on vertexCount
+// vertices with the given edges.
+template <typename W>
+SpanningForest<W> kruskalMinimumSpanningForest(int vertexCount, std::vector<typename CSRGraph<W>::Edge> edges)
+{
+    typedef typename CSRGraph<W>::Edge Edge;
+    std::sort(edges.begin(), edges.end(), [](const Edge &a, const Edge &b)
+              { return a.weight < b.weight; });
+
+    DisjointSet components(vertexCount);
+    SpanningForest<W> forest;
+    forest.totalWeight = 0;
+    for (const Edge &edge : edges)
+    {
+        if (components.setCount() == 1)
+        {
+            break;
+        }
+        if (components.unite((int)edge.from, (int)edge.to))
+        {
+            forest.edges.push_back(edge);
+            forest.totalWeight += (double)edge.weight;
+        }
+    }
+    return forest;
+}
+
+// Returns a minimum spanning forest of an undirected, weighted CSRGraph.
+template <typename W>
+SpanningForest<W> kruskalMinimumSpanningForest(const CSRGraph<W> &graph)
+{
+    if (graph.isDirected() || !graph.isWeighted())
+    {
+        throw std::runtime_error("Error: Minimum spanning trees need an undirected, weighted graph.");
+    }
+
+    // Every undirected edge is stored twice; keep the copy with from < to.
+    std::vector<typename CSRGraph<W>::Edge> edges;
+    edges.reserve(graph.edgeCount() / 2);
+    for (int u = 0; u < graph.vertexCount(); u++)
+    {
+        const W *weights = graph.weights(u);
+        int i = 0;
+        for (uint32_t v : graph.neighbors(u))
+        {
+            if ((uint32_t)u < v)
+            {
+                edges.push_back(typename CSRGraph<W>::Edge{(uint32_t)u, v, weights[i]});
+            }
+            i++;
+        }
+    }
+    return kruskalMinimumSpanningForest<W>(graph.vertexCount(), std::move(edges));
+}
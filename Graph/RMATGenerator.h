@@ -0,0 +1,101 @@
+/**
+ * @file RMATGenerator.h
+ * @author Kofi Boateng
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ *
+ */
+
+#pragma once
+#include <stdexcept> // for runtime_error
+#include <cstdint>   // for fixed width integers
+#include <vector>    // edge list
+#include <random>    // for mt19937_64
+#include "CSRGraph.h"
+#include "../Hashing/HashMixer.h"
+
+// This is a generator of synthetic RMAT (Recursive MATrix) graphs, the kind used by Graph500 and the
+// GAP benchmark suite to test graph algorithms. Each edge is placed by walking down the adjacency
+// matrix scale times: at every level it picks one of the four quadrants with probabilities a, b, c and
+// 1 - a - b - c. With the default (0.57, 0.19, 0.19) this gives a skewed, power-law degree distribution
+// and a small diameter, like social and web graphs.
+// The graph has 2^scale vertices and edgeFactor * 2^scale edges. Vertex ids are scrambled with a hash
+// so that high-degree vertices are not all packed at the start of the id range. Weights are uniform
+// integers in [1, maxWeight]. The same seed always produces the same graph.
+
+template <typename W = float>
+class RMATGenerator
+{
+private:
+    int scale_;
+    int edgeFactor_;
+    double a_, b_, c_;
+    int maxWeight_;
+    uint64_t seed_;
+
+    // Scrambles a vertex id within [0, 2^scale) with a bijection.
+    uint32_t _permute(uint32_t v) const
+    {
+        // Multiplying by an odd number and xor-shifting are both bijections
+        // modulo a power of two.
+        uint64_t mask = ((uint64_t)1 << scale_) - 1;
+        uint64_t x = (v * 0x9E3779B1ULL + (mixHash(seed_) & mask)) & mask;
+        x ^= x >> (scale_ / 2 + 1);
+        return (uint32_t)((x * 0x85EBCA77ULL) & mask);
+    }
+
+public:
+    // Returns the number of vertices, 2^scale.
+    int vertexCount() const { return 1 << scale_; }
+
+    // Returns the generated edge list.
+    std::vector<typename CSRGraph<W>::Edge> edges() const
+    {
+        uint64_t count = (uint64_t)edgeFactor_ << scale_;
+        std::vector<typename CSRGraph<W>::Edge> result;
+        result.reserve(count);
+
+        std::mt19937_64 rng(seed_);
+        std::uniform_real_distribution<double> unit(0.0, 1.0);
+        std::uniform_int_distribution<int> weight(1, maxWeight_);
+        for (uint64_t i = 0; i < count; i++)
+        {
+            uint32_t from = 0;
+            uint32_t to = 0;
+            for (int level = 0; level < scale_; level++)
+            {
+                // Quadrants a, b, c and d are (top, left), (top, right),
+                // (bottom, left) and (bottom, right).
+                double r = unit(rng);
+                bool bottom = r >= a_ + b_;
+                bool right = (r >= a_ && r < a_ + b_) || r >= a_ + b_ + c_;
+                from = (from << 1) | (bottom ? 1 : 0);
+                to = (to << 1) | (right ? 1 : 0);
+            }
+            result.push_back(typename CSRGraph<W>::Edge{_permute(from), _permute(to), (W)weight(rng)});
+        }
+        return result;
+    }
+
+    // Builds the graph directly.
+    CSRGraph<W> graph(bool directed = false) const { return CSRGraph<W>(vertexCount(), edges(), directed, true); }
+
+    RMATGenerator(int scale, int edgeFactor = 16, uint64_t seed = 1, double a = 0.57, double b = 0.19, double c = 0.19,
+                  int maxWeight = 255)
+        : scale_(scale), edgeFactor_(edgeFactor), a_(a), b_(b), c_(c), maxWeight_(maxWeight), seed_(seed)
+    {
+        if (scale < 1 || scale > 30 || edgeFactor < 1)
+        {
+            throw std::runtime_error("Error: RMATGenerator needs a scale between 1 and 30 and a positive edge factor.");
+        }
+        if (a < 0 || b < 0 || c < 0 || a + b + c > 1)
+        {
+            throw std::runtime_error("Error: RMATGenerator quadrant probabilities must be non-negative and sum to at most 1.");
+        }
+        if (maxWeight < 1)
+        {
+            throw std::runtime_error("Error: RMATGenerator needs a positive maximum weight.");
+        }
+    }
+};
@@ -0,0 +1,177 @@
+/**
+ * @file BlockedBloomFilter.h
+ * @author Kofi Boateng
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ *
+ */
+
+#pragma once
+#include <stdexcept>  // for runtime_error
+#include <functional> // for std::hash
+#include <cstdint>    // for fixed width integers
+#include <vector>     // backing array of blocks
+#include "../HashMixer.h"
+#if defined(__AVX2__)
+#include <immintrin.h> // for AVX2 bit tests
+#endif
+
+// This is an implementation of a Blocked Bloom Filter. A Bloom filter answers "is this key in the
+// set?" with either "definitely not" or "probably", using a few bits per key. It is meant to sit in
+// front of something expensive (a HashTable lookup, a disk read) so that most misses never reach it.
+// A classic Bloom filter sets k bits scattered over the whole bit array, so every query costs k
+// cache misses. Here the array is split into 512-bit blocks, one cache line each, and all of a
+// key's bits are placed inside a single block: one cache miss per query. Each block is eight 64-bit
+// words and every key sets exactly one bit per word (k = 8), so with AVX2 the eight masks are built
+// and tested in two vector instructions. The scalar path is used when AVX2 is not available.
+// The filter uses the same pluggable Hash parameter as HashTable, so a filter and the table it
+// guards can share a hashing policy. Keys cannot be removed (Refer to CuckooFilter.h for that).
+
+template <typename K, typename Hash = std::hash<K>>
+class BlockedBloomFilter
+{
+public:
+    // A single cache line of the filter.
+    struct alignas(64) Block
+    {
+        uint64_t words[8];
+    };
+
+private:
+    std::vector<Block> blocks_;
+
+    // Number of keys inserted so far.
+    long long size_;
+
+    Hash hasher_;
+
+    // Odd constants used to derive the eight in-block bit positions from one
+    // 32-bit hash (multiply-shift hashing).
+    static constexpr uint32_t salts[8] = {0x47b6137bU, 0x44974d91U, 0x8824ad5bU, 0xa2b7289dU,
+                                          0x705495c7U, 0x2df1424bU, 0x9efc4947U, 0x5c6bfb31U};
+
+    // Splits the key's hash into the block index (upper half) and the seed for
+    // the bit positions (lower half).
+    uint64_t _hash(const K &key) const { return mixHash((uint64_t)hasher_(key)); }
+
+    // Maps the upper 32 bits of the hash onto [0, blocks_.size()) without a modulo.
+    size_t _blockIndex(uint64_t hash) const
+    {
+        return (size_t)(((hash >> 32) * (uint64_t)blocks_.size()) >> 32);
+    }
+
+    // Fills mask with the one bit per word that this hash selects.
+    static void _makeMask(uint32_t seed, uint64_t mask[8])
+    {
+        for (int i = 0; i < 8; i++)
+        {
+            mask[i] = 1ULL << ((seed * salts[i]) >> 26);
+        }
+    }
+
+public:
+    // Inserts a key into the filter.
+    void insert(const K &key);
+
+    // Returns false if the key was definitely never inserted, or true if it
+    // probably was.
+    bool contains(const K &key) const;
+
+    // Returns the number of keys inserted.
+    long long size() const { return size_; }
+
+    // Returns a boolean signifying if the filter is empty or not.
+    bool isEmpty() const { return size_ == 0; }
+
+    // Returns the size of the bit array in bytes.
+    size_t memoryBytes() const { return blocks_.size() * sizeof(Block); }
+
+    // Returns the bits of filter spent on each inserted key so far.
+    double bitsPerKey() const { return size_ == 0 ? 0.0 : (double)(memoryBytes() * 8) / (double)size_; }
+
+    // Clears every bit.
+    void clear();
+
+    // Creates a filter sized for expectedKeys at bitsPerKey bits each. Around
+    // 10 bits per key gives roughly a 1% false positive rate.
+    BlockedBloomFilter(long long expectedKeys, double bitsPerKey = 10.0, const Hash &hasher = Hash());
+};
+
+// ===================================================================================
+// Implementation Section
+// ===================================================================================
+
+template <typename K, typename Hash>
+BlockedBloomFilter<K, Hash>::BlockedBloomFilter(long long expectedKeys, double bitsPerKey, const Hash &hasher)
+    : size_(0), hasher_(hasher)
+{
+    if (expectedKeys < 1 || bitsPerKey <= 0)
+    {
+        throw std::runtime_error("Error: BlockedBloomFilter needs a positive key count and bits per key.");
+    }
+    size_t bits = (size_t)((double)expectedKeys * bitsPerKey);
+    size_t blockCount = (bits + 511) / 512;
+    blocks_.assign(blockCount > 0 ? blockCount : 1, Block());
+    clear();
+}
+
+template <typename K, typename Hash>
+void BlockedBloomFilter<K, Hash>::clear()
+{
+    for (Block &block : blocks_)
+    {
+        for (int i = 0; i < 8; i++)
+        {
+            block.words[i] = 0;
+        }
+    }
+    size_ = 0;
+}
+
+template <typename K, typename Hash>
+void BlockedBloomFilter<K, Hash>::insert(const K &key)
+{
+    uint64_t hash = _hash(key);
+    Block &block = blocks_[_blockIndex(hash)];
+    uint64_t mask[8];
+    _makeMask((uint32_t)hash, mask);
+    for (int i = 0; i < 8; i++)
+    {
+        block.words[i] |= mask[i];
+    }
+    size_++;
+}
+
+template <typename K, typename Hash>
+bool BlockedBloomFilter<K, Hash>::contains(const K &key) const
+{
+    uint64_t hash = _hash(key);
+    const Block &block = blocks_[_blockIndex(hash)];
+
+#if defined(__AVX2__)
+    // Eight 32-bit multiply-shifts give the bit positions, which are widened to
+    // 64-bit lanes and turned into single-bit masks with a variable shift.
+    const __m256i saltVector = _mm256_setr_epi32((int)salts[0], (int)salts[1], (int)salts[2], (int)salts[3],
+                                                 (int)salts[4], (int)salts[5], (int)salts[6], (int)salts[7]);
+    __m256i positions = _mm256_srli_epi32(_mm256_mullo_epi32(_mm256_set1_epi32((int)(uint32_t)hash), saltVector), 26);
+    const __m256i ones = _mm256_set1_epi64x(1);
+    __m256i maskLow = _mm256_sllv_epi64(ones, _mm256_cvtepu32_epi64(_mm256_castsi256_si128(positions)));
+    __m256i maskHigh = _mm256_sllv_epi64(ones, _mm256_cvtepu32_epi64(_mm256_extracti128_si256(positions, 1)));
+    __m256i wordsLow = _mm256_load_si256((const __m256i *)&block.words[0]);
+    __m256i wordsHigh = _mm256_load_si256((const __m256i *)&block.words[4]);
+    // testc returns 1 when every bit of the mask is also set in the words.
+    return _mm256_testc_si256(wordsLow, maskLow) && _mm256_testc_si256(wordsHigh, maskHigh);
+#else
+    uint64_t mask[8];
+    _makeMask((uint32_t)hash, mask);
+    for (int i = 0; i < 8; i++)
+    {
+        if ((block.words[i] & mask[i]) != mask[i])
+        {
+            return false;
+        }
+    }
+    return true;
+#endif
+}
@@ -0,0 +1,197 @@
+/**
+ * @file ConsistentHashRing.h
+ * @author Kofi Boateng
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ *
+ */
+
+#pragma once
+#include <stdexcept>  // for runtime_error
+#include <functional> // for std::hash
+#include <cstdint>    // for fixed width integers
+#include <vector>     // sorted array of ring points
+#include <algorithm>  // for sort, upper_bound and inplace_merge
+#include "../HashMixer.h"
+
+// This is an implementation of a Consistent Hashing Ring, used to spread a key space across several
+// nodes (processes or machines), each holding its own HashTable. With plain hash(key) % nodes, adding
+// or removing one node moves almost every key. On a ring, every node is hashed to a set of points on
+// a circle of 2^64 positions, and a key belongs to the first node point at or after the key's hash.
+// Adding a node only takes keys from its clockwise neighbours, so about 1/n of the keys move.
+// Each node gets many "virtual nodes" (points) so that the arcs even out; with 100-200 points per node
+// the load imbalance is typically within 10%.
+// The ring is stored as a sorted array of (point, node) pairs rather than a tree, so a lookup is a
+// binary search over contiguous memory. Membership changes re-sort the array, which is fine because
+// they are rare compared to lookups.
+
+template <typename N, typename Hash = std::hash<N>>
+class ConsistentHashRing
+{
+private:
+    // A virtual node: its position on the ring and the index of its node in nodes_.
+    struct Point
+    {
+        uint64_t position;
+        int node;
+
+        bool operator<(const Point &other) const { return position < other.position; }
+    };
+
+    // Every point on the ring, sorted by position.
+    std::vector<Point> points_;
+
+    // The real nodes. A Point refers to its node by index in this array.
+    std::vector<N> nodes_;
+
+    // Number of virtual nodes placed for each real node.
+    int virtualNodes_;
+
+    Hash hasher_;
+
+    // Returns the position of the replica-th virtual node of node.
+    uint64_t _pointFor(const N &node, int replica) const
+    {
+        return mixHash((uint64_t)hasher_(node) ^ mixHash((uint64_t)replica + 1));
+    }
+
+    // Returns the index of the point that owns position.
+    size_t _ownerIndex(uint64_t position) const
+    {
+        auto Iter = std::lower_bound(points_.begin(), points_.end(), Point{position, 0});
+        // Positions past the last point wrap around to the first one.
+        return Iter == points_.end() ? 0 : (size_t)(Iter - points_.begin());
+    }
+
+public:
+    // Adds a node and its virtual nodes to the ring. Throws if it already exists.
+    void addNode(const N &node);
+
+    // Removes a node and its virtual nodes. Throws if it does not exist.
+    void removeNode(const N &node);
+
+    // Returns whether node is on the ring.
+    bool containsNode(const N &node) const;
+
+    // Returns the node that owns key. The key is hashed with KeyHash, which
+    // defaults to std::hash<K>, the same policy HashTable uses.
+    template <typename K, typename KeyHash = std::hash<K>>
+    const N &nodeFor(const K &key, const KeyHash &keyHasher = KeyHash()) const
+    {
+        if (points_.empty())
+        {
+            throw std::runtime_error("Error: Looking up a key on an empty ring.");
+        }
+        return nodes_[points_[_ownerIndex(mixHash((uint64_t)keyHasher(key)))].node];
+    }
+
+    // Returns the share of the ring owned by each node, in the order of nodes().
+    // A perfectly balanced ring gives 1 / nodeCount() to everyone.
+    std::vector<double> ownership() const;
+
+    // Returns the nodes currently on the ring.
+    const std::vector<N> &nodes() const { return nodes_; }
+
+    // Returns the number of real nodes.
+    int nodeCount() const { return (int)nodes_.size(); }
+
+    // Returns a boolean signifying if the ring is empty or not.
+    bool isEmpty() const { return nodes_.empty(); }
+
+    // Creates an empty ring that places virtualNodes points per node.
+    explicit ConsistentHashRing(int virtualNodes = 160, const Hash &hasher = Hash())
+        : virtualNodes_(virtualNodes), hasher_(hasher)
+    {
+        if (virtualNodes < 1)
+        {
+            throw std::runtime_error("Error: ConsistentHashRing needs at least one virtual node per node.");
+        }
+    }
+};
+
+// ===================================================================================
+// Implementation Section
+// ===================================================================================
+
+template <typename N, typename Hash>
+bool ConsistentHashRing<N, Hash>::containsNode(const N &node) const
+{
+    return std::find(nodes_.begin(), nodes_.end(), node) != nodes_.end();
+}
+
+template <typename N, typename Hash>
+void ConsistentHashRing<N, Hash>::addNode(const N &node)
+{
+    if (containsNode(node))
+    {
+        throw std::runtime_error("Error: Node is already on the ring.");
+    }
+
+    int index = (int)nodes_.size();
+    nodes_.push_back(node);
+
+    // Sort only the new points and merge them in, O(P + v log v).
+    size_t middle = points_.size();
+    for (int replica = 0; replica < virtualNodes_; replica++)
+    {
+        points_.push_back(Point{_pointFor(node, replica), index});
+    }
+    std::sort(points_.begin() + middle, points_.end());
+    std::inplace_merge(points_.begin(), points_.begin() + middle, points_.end());
+}
+
+template <typename N, typename Hash>
+void ConsistentHashRing<N, Hash>::removeNode(const N &node)
+{
+    auto found = std::find(nodes_.begin(), nodes_.end(), node);
+    if (found == nodes_.end())
+    {
+        throw std::runtime_error("Error: Removing a node that is not on the ring.");
+    }
+
+    int index = (int)(found - nodes_.begin());
+    nodes_.erase(found);
+
+    // Drop the node's points and shift the indices of the nodes after it. The
+    // remaining points stay sorted.
+    size_t kept = 0;
+    for (size_t i = 0; i < points_.size(); i++)
+    {
+        if (points_[i].node == index)
+        {
+            continue;
+        }
+        Point point = points_[i];
+        if (point.node > index)
+        {
+            point.node--;
+        }
+        points_[kept++] = point;
+    }
+    points_.resize(kept);
+}
+
+template <typename N, typename Hash>
+std::vector<double> ConsistentHashRing<N, Hash>::ownership() const
+{
+    std::vector<double> share(nodes_.size(), 0.0);
+    if (points_.empty())
+    {
+        return share;
+    }
+
+    // A point owns the arc between the previous point (exclusive) and itself.
+    const double ringSize = 18446744073709551616.0; // 2^64
+    for (size_t i = 0; i < points_.size(); i++)
+    {
+        uint64_t previous = i == 0 ? points_.back().position : points_[i - 1].position;
+        uint64_t arc = points_[i].position - previous; // wraps correctly for i == 0
+        share[points_[i].node] += (double)arc / ringSize;
+    }
+    if (points_.size() == 1)
+    {
+        share[points_[0].node] = 1.0;
+    }
+    return share;
+}
@@ -0,0 +1,69 @@
+/**
+ * @file JumpHash.h
+ * @author Kofi Boateng
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ *
+ */
+
+#pragma once
+#include <stdexcept>  // for runtime_error
+#include <functional> // for std::hash
+#include <cstdint>    // for fixed width integers
+#include "../HashMixer.h"
+
+// This is an implementation of Jump Consistent Hash (Lamping and Veach). It maps a key to one of
+// numBuckets buckets with no memory at all and in O(log n) time, and when the number of buckets grows
+// from n to n + 1 only 1/(n + 1) of the keys move, all of them into the new bucket. The catch is that
+// buckets are numbered 0..n-1 and can only be added or removed at the end, so it suits shards that are
+// replicated and never die individually. Use ConsistentHashRing.h or RendezvousHash.h when arbitrary
+// nodes come and go.
+// The algorithm walks a pseudo-random sequence of "jump" points seeded by the key. Each step jumps
+// forward to the next bucket count at which the key would move, and the last jump below numBuckets is
+// the key's bucket.
+
+template <typename K, typename Hash = std::hash<K>>
+class JumpHash
+{
+private:
+    int buckets_;
+    Hash hasher_;
+
+public:
+    // Maps a 64-bit key to a bucket in [0, numBuckets).
+    static int bucketForHash(uint64_t key, int numBuckets)
+    {
+        int64_t bucket = -1;
+        int64_t jump = 0;
+        while (jump < numBuckets)
+        {
+            bucket = jump;
+            key = key * 2862933555777941757ULL + 1;
+            jump = (int64_t)((double)(bucket + 1) * ((double)(1LL << 31) / (double)((key >> 33) + 1)));
+        }
+        return (int)bucket;
+    }
+
+    // Returns the bucket that key belongs to.
+    int bucketFor(const K &key) const { return bucketForHash(mixHash((uint64_t)hasher_(key)), buckets_); }
+
+    // Returns the number of buckets.
+    int bucketCount() const { return buckets_; }
+
+    // Changes the number of buckets. Growing from n to m moves (m - n) / m of
+    // the keys, all into the new buckets.
+    void resize(int numBuckets)
+    {
+        if (numBuckets < 1)
+        {
+            throw std::runtime_error("Error: JumpHash needs at least one bucket.");
+        }
+        buckets_ = numBuckets;
+    }
+
+    explicit JumpHash(int numBuckets, const Hash &hasher = Hash()) : buckets_(1), hasher_(hasher)
+    {
+        resize(numBuckets);
+    }
+};
@@ -0,0 +1,113 @@
+/**
+ * @file RendezvousHash.h
+ * @author Kofi Boateng
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ *
+ */
+
+#pragma once
+#include <stdexcept>  // for runtime_error
+#include <functional> // for std::hash
+#include <cstdint>    // for fixed width integers
+#include <vector>     // list of nodes
+#include <algorithm>  // for find
+#include <cmath>      // for log
+#include "../HashMixer.h"
+
+// This is an implementation of Rendezvous Hashing, also called Highest Random Weight hashing. For
+// every key, each node gets a pseudo-random score from hash(key, node), and the key goes to the node
+// with the highest score. Removing a node only moves the keys it owned (their second choice takes
+// over), and adding a node only takes the keys it now wins, which gives the same 1/n movement as
+// ConsistentHashRing.h without any virtual nodes and with perfect balance in expectation.
+// A lookup costs O(n) score computations, so it is best for tens of nodes, not thousands.
+// Nodes can be weighted: a node with weight 2 receives twice the keys of a node with weight 1. The
+// weighted score is -weight / ln(u) with u uniform in (0, 1), which keeps the minimal-movement
+// property when weights change.
+
+template <typename N, typename Hash = std::hash<N>>
+class RendezvousHash
+{
+private:
+    // The nodes, their weights, and their hashes (computed once).
+    std::vector<N> nodes_;
+    std::vector<double> weights_;
+    std::vector<uint64_t> nodeHashes_;
+
+    Hash hasher_;
+
+    // Returns the weighted score of node i for a key hash.
+    double _score(uint64_t keyHash, size_t i) const
+    {
+        uint64_t combined = mixHash(keyHash ^ nodeHashes_[i]);
+        // Top 53 bits as a uniform double in (0, 1).
+        double u = ((double)(combined >> 11) + 0.5) / 9007199254740992.0;
+        return -weights_[i] / std::log(u);
+    }
+
+public:
+    // Adds a node with the given weight. Throws if it already exists.
+    void addNode(const N &node, double weight = 1.0)
+    {
+        if (weight <= 0)
+        {
+            throw std::runtime_error("Error: RendezvousHash node weights must be positive.");
+        }
+        if (std::find(nodes_.begin(), nodes_.end(), node) != nodes_.end())
+        {
+            throw std::runtime_error("Error: Node is already registered.");
+        }
+        nodes_.push_back(node);
+        weights_.push_back(weight);
+        nodeHashes_.push_back(mixHash((uint64_t)hasher_(node)));
+    }
+
+    // Removes a node. Throws if it does not exist.
+    void removeNode(const N &node)
+    {
+        auto found = std::find(nodes_.begin(), nodes_.end(), node);
+        if (found == nodes_.end())
+        {
+            throw std::runtime_error("Error: Removing a node that is not registered.");
+        }
+        size_t index = (size_t)(found - nodes_.begin());
+        nodes_.erase(found);
+        weights_.erase(weights_.begin() + index);
+        nodeHashes_.erase(nodeHashes_.begin() + index);
+    }
+
+    // Returns the node with the highest score for key.
+    template <typename K, typename KeyHash = std::hash<K>>
+    const N &nodeFor(const K &key, const KeyHash &keyHasher = KeyHash()) const
+    {
+        if (nodes_.empty())
+        {
+            throw std::runtime_error("Error: Looking up a key with no nodes registered.");
+        }
+        uint64_t keyHash = mixHash((uint64_t)keyHasher(key));
+        size_t best = 0;
+        double bestScore = _score(keyHash, 0);
+        for (size_t i = 1; i < nodes_.size(); i++)
+        {
+            double score = _score(keyHash, i);
+            if (score > bestScore)
+            {
+                bestScore = score;
+                best = i;
+            }
+        }
+        return nodes_[best];
+    }
+
+    // Returns the nodes currently registered.
+    const std::vector<N> &nodes() const { return nodes_; }
+
+    // Returns the number of nodes.
+    int nodeCount() const { return (int)nodes_.size(); }
+
+    // Returns a boolean signifying if there are no nodes.
+    bool isEmpty() const { return nodes_.empty(); }
+
+    explicit RendezvousHash(const Hash &hasher = Hash()) : hasher_(hasher) {}
+};
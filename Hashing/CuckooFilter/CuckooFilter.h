@@ -0,0 +1,290 @@
+/**
+ * @file CuckooFilter.h
+ * @author Kofi Boateng
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ *
+ */
+
+#pragma once
+#include <stdexcept>  // for runtime_error
+#include <functional> // for std::hash
+#include <cstdint>    // for fixed width integers
+#include <vector>     // backing array of buckets
+#include "../HashMixer.h"
+
+// This is an implementation of a Cuckoo Filter. Like a Bloom filter (Refer to BlockedBloomFilter.h)
+// it answers membership queries with "definitely not" or "probably", but it stores a short
+// fingerprint of every key instead of setting bits, which means keys can also be removed.
+// Each key has two candidate buckets of four fingerprint slots. The second bucket is derived from
+// the first one and the fingerprint alone (i2 = i1 ^ hash(fingerprint)), so a fingerprint can be
+// moved between its two buckets without knowing the original key. When both buckets are full, a
+// resident fingerprint is kicked to its alternate bucket, possibly kicking another one, the same
+// way cuckoo hashing works. At 95% occupancy the filter needs about (fingerprint bits + 3) / 0.95
+// bits per key: uint8_t fingerprints give roughly a 3% false positive rate and uint16_t roughly 0.01%.
+// The filter uses the same pluggable Hash parameter as HashTable.
+
+template <typename K, typename Fingerprint = uint16_t, typename Hash = std::hash<K>>
+class CuckooFilter
+{
+private:
+    // Slots per bucket.
+    static const int slotsPerBucket = 4;
+
+    // Upper bound on the number of kicks before an insert gives up.
+    static const int maxKicks = 500;
+
+    // Fingerprints, slotsPerBucket per bucket. Zero marks an empty slot.
+    std::vector<Fingerprint> slots_;
+
+    // Number of buckets minus one; the count is always a power of two.
+    uint64_t bucketMask_;
+
+    // Number of fingerprints stored.
+    long long size_;
+
+    // When an insert runs out of kicks, the fingerprint left homeless is kept
+    // here so that it is never lost (a Cuckoo Filter must not have false
+    // negatives). Once it is used the filter is considered full.
+    bool hasVictim_;
+    uint64_t victimIndex_;
+    Fingerprint victimFingerprint_;
+
+    // State for picking which slot to kick.
+    uint64_t kickState_;
+
+    Hash hasher_;
+
+    // Derives the fingerprint (never zero) and the primary bucket of a key.
+    void _indexAndFingerprint(const K &key, uint64_t &index, Fingerprint &fingerprint) const
+    {
+        uint64_t hash = mixHash((uint64_t)hasher_(key));
+        index = hash & bucketMask_;
+        fingerprint = (Fingerprint)(hash >> 32);
+        if (fingerprint == 0)
+        {
+            fingerprint = 1;
+        }
+    }
+
+    // Returns the other bucket a fingerprint may live in.
+    uint64_t _altIndex(uint64_t index, Fingerprint fingerprint) const
+    {
+        return (index ^ mixHash((uint64_t)fingerprint)) & bucketMask_;
+    }
+
+    // Places fingerprint in an empty slot of bucket index, if one exists.
+    bool _insertIntoBucket(uint64_t index, Fingerprint fingerprint);
+
+    // Returns whether bucket index holds fingerprint.
+    bool _bucketContains(uint64_t index, Fingerprint fingerprint) const;
+
+    // Removes one copy of fingerprint from bucket index, if it is there.
+    bool _removeFromBucket(uint64_t index, Fingerprint fingerprint);
+
+public:
+    // Inserts a key. Returns false if the filter is too full to take it, in
+    // which case the caller should rebuild a larger filter. Inserting the same
+    // key twice stores two fingerprints, so remove must then be called twice.
+    bool insert(const K &key);
+
+    // Returns false if the key is definitely not in the filter, or true if it
+    // probably is.
+    bool contains(const K &key) const;
+
+    // Removes a key. Only remove keys that were actually inserted, otherwise a
+    // colliding key's fingerprint may be removed instead. Returns whether a
+    // matching fingerprint was found.
+    bool remove(const K &key);
+
+    // Returns the number of keys stored.
+    long long size() const { return size_; }
+
+    // Returns a boolean signifying if the filter is empty or not.
+    bool isEmpty() const { return size_ == 0; }
+
+    // Returns the fraction of slots in use.
+    double loadFactor() const { return (double)size_ / (double)slots_.size(); }
+
+    // Returns the size of the fingerprint array in bytes.
+    size_t memoryBytes() const { return slots_.size() * sizeof(Fingerprint); }
+
+    // Returns the bits of filter spent on each stored key so far.
+    double bitsPerKey() const { return size_ == 0 ? 0.0 : (double)(memoryBytes() * 8) / (double)size_; }
+
+    // Creates a filter with room for about expectedKeys keys at 95% occupancy.
+    explicit CuckooFilter(long long expectedKeys, const Hash &hasher = Hash());
+};
+
+// ===================================================================================
+// Implementation Section
+// ===================================================================================
+
+template <typename K, typename Fingerprint, typename Hash>
+CuckooFilter<K, Fingerprint, Hash>::CuckooFilter(long long expectedKeys, const Hash &hasher)
+    : size_(0), hasVictim_(false), victimIndex_(0), victimFingerprint_(0), kickState_(0x2545f4914f6cdd1dULL), hasher_(hasher)
+{
+    if (expectedKeys < 1)
+    {
+        throw std::runtime_error("Error: CuckooFilter needs a positive key count.");
+    }
+    uint64_t buckets = 1;
+    while ((double)(buckets * slotsPerBucket) * 0.95 < (double)expectedKeys)
+    {
+        buckets <<= 1;
+    }
+    bucketMask_ = buckets - 1;
+    slots_.assign(buckets * slotsPerBucket, 0);
+}
+
+template <typename K, typename Fingerprint, typename Hash>
+bool CuckooFilter<K, Fingerprint, Hash>::_insertIntoBucket(uint64_t index, Fingerprint fingerprint)
+{
+    Fingerprint *bucket = &slots_[index * slotsPerBucket];
+    for (int i = 0; i < slotsPerBucket; i++)
+    {
+        if (bucket[i] == 0)
+        {
+            bucket[i] = fingerprint;
+            return true;
+        }
+    }
+    return false;
+}
+
+template <typename K, typename Fingerprint, typename Hash>
+bool CuckooFilter<K, Fingerprint, Hash>::_bucketContains(uint64_t index, Fingerprint fingerprint) const
+{
+    const Fingerprint *bucket = &slots_[index * slotsPerBucket];
+    // Branch-free so the compiler can turn the four compares into one vector compare.
+    bool found = false;
+    for (int i = 0; i < slotsPerBucket; i++)
+    {
+        found |= bucket[i] == fingerprint;
+    }
+    return found;
+}
+
+template <typename K, typename Fingerprint, typename Hash>
+bool CuckooFilter<K, Fingerprint, Hash>::_removeFromBucket(uint64_t index, Fingerprint fingerprint)
+{
+    Fingerprint *bucket = &slots_[index * slotsPerBucket];
+    for (int i = 0; i < slotsPerBucket; i++)
+    {
+        if (bucket[i] == fingerprint)
+        {
+            bucket[i] = 0;
+            return true;
+        }
+    }
+    return false;
+}
+
+template <typename K, typename Fingerprint, typename Hash>
+bool CuckooFilter<K, Fingerprint, Hash>::insert(const K &key)
+{
+    if (hasVictim_)
+    {
+        return false;
+    }
+
+    uint64_t index;
+    Fingerprint fingerprint;
+    _indexAndFingerprint(key, index, fingerprint);
+
+    if (_insertIntoBucket(index, fingerprint))
+    {
+        size_++;
+        return true;
+    }
+    index = _altIndex(index, fingerprint);
+    if (_insertIntoBucket(index, fingerprint))
+    {
+        size_++;
+        return true;
+    }
+
+    // Both buckets are full: evict a random resident and move it to its
+    // alternate bucket, repeating until something lands in an empty slot.
+    for (int kick = 0; kick < maxKicks; kick++)
+    {
+        kickState_ ^= kickState_ << 13;
+        kickState_ ^= kickState_ >> 7;
+        kickState_ ^= kickState_ << 17;
+        Fingerprint &slot = slots_[index * slotsPerBucket + (kickState_ % slotsPerBucket)];
+        Fingerprint evicted = slot;
+        slot = fingerprint;
+        fingerprint = evicted;
+
+        index = _altIndex(index, fingerprint);
+        if (_insertIntoBucket(index, fingerprint))
+        {
+            size_++;
+            return true;
+        }
+    }
+
+    // Out of kicks. The key itself was stored along the way; the fingerprint
+    // left over is parked in the victim slot so it is still found by contains.
+    hasVictim_ = true;
+    victimIndex_ = index;
+    victimFingerprint_ = fingerprint;
+    size_++;
+    return true;
+}
+
+template <typename K, typename Fingerprint, typename Hash>
+bool CuckooFilter<K, Fingerprint, Hash>::contains(const K &key) const
+{
+    uint64_t index;
+    Fingerprint fingerprint;
+    _indexAndFingerprint(key, index, fingerprint);
+    uint64_t altIndex = _altIndex(index, fingerprint);
+
+    if (hasVictim_ && victimFingerprint_ == fingerprint && (victimIndex_ == index || victimIndex_ == altIndex))
+    {
+        return true;
+    }
+    return _bucketContains(index, fingerprint) || _bucketContains(altIndex, fingerprint);
+}
+
+template <typename K, typename Fingerprint, typename Hash>
+bool CuckooFilter<K, Fingerprint, Hash>::remove(const K &key)
+{
+    uint64_t index;
+    Fingerprint fingerprint;
+    _indexAndFingerprint(key, index, fingerprint);
+    uint64_t altIndex = _altIndex(index, fingerprint);
+
+    if (hasVictim_ && victimFingerprint_ == fingerprint && (victimIndex_ == index || victimIndex_ == altIndex))
+    {
+        hasVictim_ = false;
+        size_--;
+        return true;
+    }
+
+    if (_removeFromBucket(index, fingerprint) || _removeFromBucket(altIndex, fingerprint))
+    {
+        size_--;
+        // A slot just opened up, so the parked victim may fit again.
+        if (hasVictim_)
+        {
+            hasVictim_ = false;
+            size_--;
+            uint64_t parkedIndex = victimIndex_;
+            Fingerprint parked = victimFingerprint_;
+            if (_insertIntoBucket(parkedIndex, parked) || _insertIntoBucket(_altIndex(parkedIndex, parked), parked))
+            {
+                size_++;
+            }
+            else
+            {
+                hasVictim_ = true;
+                size_++;
+            }
+        }
+        return true;
+    }
+    return false;
+}
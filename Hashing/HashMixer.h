@@ -0,0 +1,27 @@
+/**
+ * @file HashMixer.h
+ * @author Kofi Boateng
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ *
+ */
+
+#pragma once
+#include <cstdint> // for uint64_t
+
+// The structures in Hashing/ take their hashing policy as a template parameter that defaults to
+// std::hash<K>. For integers std::hash is the identity, which is fine for picking a chain in
+// HashTable but terrible for filters and sketches that slice one hash into several indices, since
+// sequential keys would only differ in their low bits. mixHash runs the value through the
+// MurmurHash3 finalizer so every output bit depends on every input bit.
+
+constexpr uint64_t mixHash(uint64_t hash)
+{
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdULL;
+    hash ^= hash >> 33;
+    hash *= 0xc4ceb9fe1a85ec53ULL;
+    hash ^= hash >> 33;
+    return hash;
+}
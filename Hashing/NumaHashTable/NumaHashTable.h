@@ -0,0 +1,195 @@
+/**
+ * @file NumaHashTable.h
+ * @author Kofi Boateng
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ *
+ */
+
+#pragma once
+#include <stdexcept>  // for runtime_error
+#include <cstddef>    // for size_t
+#include <functional> // for std::hash, the default hashing policy
+#include <memory>     // for unique_ptr
+#include <mutex>      // for the shard locks
+#include <utility>    // for pair
+#include <vector>     // for the shards
+#include "../HashMixer.h"
+#include "../SeparateChainingHashTable/SeparateChainingHashTable.h"
+#include "../../Memory/RecyclingAllocator.h"
+#include "../../Concurrency/NumaTopology.h"
+
+// This is an implementation of a NUMA-partitioned Hash Table. On a machine with several sockets, one big
+// HashTable lives wherever its pages happened to be touched first, so threads on the other sockets pay a
+// remote memory access on nearly every lookup and all of them fight over the same lock.
+// Here the keys are split into shards, shardsPerNode for every NUMA node. Each shard is an ordinary
+// HashTable with its own lock, whose chain nodes and bucket array come from its own HugePageArena. A
+// RecyclingArena on top of it reuses the nodes of removed keys, so a shard only needs room for the keys
+// it holds at once, however long it runs. With Placement::Local that arena is bound (mbind) to the
+// shard's node, so the shard's memory sits next to the CPUs of that node; with Placement::Interleaved
+// every arena is spread over all nodes, which is what a single table gets at best and is the baseline to
+// compare against.
+// Locality only pays off if the work for a key runs on the key's node: nodeOf(key) says which node that
+// is, and ThreadPool::submitToNode queues the work with that node's workers. If mbind is not available the
+// pages still land by first touch, i.e. on the node of the thread that inserts into the shard, so routing
+// inserts the same way keeps the shards local.
+// All operations are thread-safe. Values are returned by copy, since a pointer into a shard would outlive
+// its lock.
+
+template <typename K, typename V, typename Hash = std::hash<K>>
+class NumaHashTable
+{
+public:
+    enum class Placement
+    {
+        Local,
+        Interleaved
+    };
+
+private:
+    typedef RecyclingAllocator<pair<K, V>> Allocator;
+
+    struct alignas(64) Shard
+    {
+        std::mutex lock;
+        HugePageArena arena;
+        // Removed chain nodes go on the pool's free lists and are reused by
+        // later inserts, so churn does not use up the arena.
+        RecyclingArena pool;
+        HashTable<K, V, Hash, Allocator> table;
+        int node;
+
+        // Sets the arena's NUMA policy before the table touches any of it.
+        static HugePageArena &_place(HugePageArena &arena, int node, Placement placement)
+        {
+            if (placement == Placement::Local)
+            {
+                arena.bindToNode(node);
+            }
+            else
+            {
+                arena.interleave(NumaTopology::nodes());
+            }
+            return arena;
+        }
+
+        Shard(size_t bytes, int buckets, const Hash &hasher, int nodeArg, Placement placement)
+            : arena(bytes), pool(_place(arena, nodeArg, placement)), table(buckets, hasher, Allocator(pool)), node(nodeArg) {}
+    };
+
+    std::vector<std::unique_ptr<Shard>> shards_;
+    Hash hasher_;
+
+    Shard &_shard(const K &key) const { return *shards_[mixHash((uint64_t)hasher_(key)) % shards_.size()]; }
+
+public:
+    // Inserts the pair, or replaces the value if the key already exists.
+    void insert(const K &key, const V &value)
+    {
+        Shard &shard = _shard(key);
+        std::lock_guard<std::mutex> lock(shard.lock);
+        V *current = shard.table.find(key);
+        if (current)
+        {
+            *current = value;
+        }
+        else
+        {
+            shard.table.add(key, value);
+        }
+    }
+
+    // Removes the key and returns true, or returns false if it does not exist.
+    bool remove(const K &key)
+    {
+        Shard &shard = _shard(key);
+        std::lock_guard<std::mutex> lock(shard.lock);
+        if (!shard.table.containsKey(key))
+        {
+            return false;
+        }
+        shard.table.remove(key);
+        return true;
+    }
+
+    // Copies the value of key into value and returns true, or returns false
+    // if the key does not exist.
+    bool find(const K &key, V &value) const
+    {
+        Shard &shard = _shard(key);
+        std::lock_guard<std::mutex> lock(shard.lock);
+        const V *current = shard.table.find(key);
+        if (!current)
+        {
+            return false;
+        }
+        value = *current;
+        return true;
+    }
+
+    // Return the value associated with the given key.
+    V get(const K &key) const
+    {
+        V value;
+        if (!find(key, value))
+        {
+            throw std::runtime_error("[WARNING]: Trying to retrieve a value that does not exist.");
+        }
+        return value;
+    }
+
+    // Searches the table for the key and returns true if it is available.
+    bool containsKey(const K &key) const
+    {
+        Shard &shard = _shard(key);
+        std::lock_guard<std::mutex> lock(shard.lock);
+        return shard.table.containsKey(key);
+    }
+
+    // Returns how many pairs are stored in the table.
+    size_t size() const
+    {
+        size_t total = 0;
+        for (const std::unique_ptr<Shard> &shard : shards_)
+        {
+            std::lock_guard<std::mutex> lock(shard->lock);
+            total += shard->table.size();
+        }
+        return total;
+    }
+
+    // Returns the NUMA node whose memory holds key, as a NumaTopology node id
+    // that can be passed to ThreadPool::submitToNode.
+    int nodeOf(const K &key) const { return _shard(key).node; }
+
+    // Returns the number of shards.
+    size_t shardCount() const { return shards_.size(); }
+
+    // Creates a table whose shards may each use up to bytesPerShard bytes of
+    // memory (reserved, not committed) and start with bucketsPerShard buckets.
+    explicit NumaHashTable(size_t bytesPerShard, Placement placement = Placement::Local, int shardsPerNode = 4,
+                           int bucketsPerShard = 1024, const Hash &hasher = Hash())
+        : hasher_(hasher)
+    {
+        if (shardsPerNode <= 0)
+        {
+            throw std::runtime_error("Error: NumaHashTable needs at least one shard per node.");
+        }
+        for (int node : NumaTopology::nodes())
+        {
+            // No thread is local to a memory-only node, so it gets no shards.
+            if (NumaTopology::cpus(node).empty())
+            {
+                continue;
+            }
+            for (int i = 0; i < shardsPerNode; i++)
+            {
+                shards_.emplace_back(new Shard(bytesPerShard, bucketsPerShard, hasher_, node, placement));
+            }
+        }
+    }
+
+    NumaHashTable(const NumaHashTable &) = delete;
+    NumaHashTable &operator=(const NumaHashTable &) = delete;
+};
@@ -0,0 +1,575 @@
+/**
+ * @file FrozenHashTable.h
+ * @author Kofi Boateng
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ *
+ */
+
+#pragma once
+#include <stdexcept>   // for runtime_error
+#include <functional>  // for std::hash
+#include <cstdint>     // for fixed width integers
+#include <cstring>     // for memcpy
+#include <string>      // for file paths
+#include <vector>      // build scratch space and owned storage
+#include <algorithm>   // for sort
+#include <type_traits> // for is_trivially_copyable
+#include <fstream>     // for writing the layout to disk
+#include <fcntl.h>     // for open
+#include <sys/mman.h>  // for mmap
+#include <sys/stat.h>  // for fstat
+#include <unistd.h>    // for close
+#include "../HashMixer.h"
+#include "../SeparateChainingHashTable/SeparateChainingHashTable.h" // for HashTable::freeze
+
+// This is an implementation of a read-only hash table built on a Minimal Perfect Hash Function (MPHF).
+// Many tables are never modified after they are loaded. For those, HashTable::freeze() builds this
+// structure from the table's current contents. A perfect hash function maps each of the n keys to a
+// different slot in [0, n), so a lookup computes one position and compares one key: no chains, no
+// probing, no collisions.
+// The function is built PTHash-style. Keys are split into buckets of about seven keys each, skewed so
+// that 60% of the keys fall into the first 30% of the buckets. Buckets are then processed largest
+// first, and for each one we search for a 16-bit "pilot" value that sends every key in the bucket to a
+// free slot (slot = hash(key, pilot) % tableSize). The skew makes the big buckets bigger, so they are
+// placed while the table is still empty, and leaves mostly one- and two-key buckets for the nearly
+// full table at the end. Only the pilots are stored: 16 bits per 7 keys, about 2.3 bits per key. The
+// table is sized at n / 0.98 so that the last buckets still find free slots quickly; the few keys that
+// land past n are sent to the holes below n through a small remap array, adding roughly 0.65 bits per
+// key, or about 2.95 bits per key in all. In the rare case that no pilot works
+// for a bucket, its keys are given leftover slots and listed in a small sorted overflow array that is
+// binary searched by hash; the bucket's pilot is set to the reserved value escapePilot.
+// Everything lives in a single flat buffer (header, pilots, remap, overflow, keys, values) with no pointers, so
+// the buffer can be written to a file and later mmap'd back in and queried directly. This requires K
+// and V to be trivially copyable.
+
+template <typename K, typename V, typename Hash = std::hash<K>>
+class FrozenHashTable
+{
+    static_assert(std::is_trivially_copyable<K>::value && std::is_trivially_copyable<V>::value,
+                  "FrozenHashTable stores keys and values in a flat buffer and needs trivially copyable types.");
+
+public:
+    // The fixed-size header at the start of the buffer. Offsets are in bytes
+    // from the start of the buffer.
+    struct Header
+    {
+        uint64_t magic;
+        uint32_t version;
+        uint32_t keySize;
+        uint32_t valueSize;
+        uint32_t reserved;
+        uint64_t count;
+        uint64_t tableSize;
+        uint64_t bucketCount;
+        uint64_t seed;
+        uint64_t overflowCount;
+        uint64_t pilotsOffset;
+        uint64_t remapOffset;
+        uint64_t overflowOffset;
+        uint64_t keysOffset;
+        uint64_t valuesOffset;
+        uint64_t totalBytes;
+    };
+
+    static const uint64_t layoutMagic = 0x4e5a4f5246485446ULL; // "FTHFROZN" in little-endian bytes
+    static const uint32_t layoutVersion = 2;
+
+    // An entry of the overflow array: the hash of a key whose bucket had no
+    // working pilot, and the slot the key was given.
+    struct Overflow
+    {
+        uint64_t hash;
+        uint64_t slot;
+    };
+
+private:
+    // Average number of keys per bucket.
+    static const int keysPerBucket = 7;
+
+    // The first 30% of the buckets receive the keys whose high hash bits are
+    // below this, 60% of all keys.
+    static const uint64_t denseKeysBelow = 2576980378ULL; // 0.6 * 2^32
+
+    // Pilot value marking a bucket whose keys live in the overflow array.
+    static const uint16_t escapePilot = 0xFFFF;
+
+    // Owned storage (8-byte aligned). Empty when the table views an mmap'd file.
+    std::vector<uint64_t> storage_;
+
+    // The mapped file, if the table was opened with mapFile().
+    void *mapped_;
+    size_t mappedBytes_;
+
+    Hash hasher_;
+
+    // Start of the flat layout, wherever it lives.
+    const unsigned char *_base() const
+    {
+        return mapped_ ? (const unsigned char *)mapped_ : (const unsigned char *)storage_.data();
+    }
+
+    const Header &_header() const { return *(const Header *)_base(); }
+    const uint16_t *_pilots() const { return (const uint16_t *)(_base() + _header().pilotsOffset); }
+    const uint32_t *_remap() const { return (const uint32_t *)(_base() + _header().remapOffset); }
+    const Overflow *_overflow() const { return (const Overflow *)(_base() + _header().overflowOffset); }
+    const K *_keys() const { return (const K *)(_base() + _header().keysOffset); }
+    const V *_values() const { return (const V *)(_base() + _header().valuesOffset); }
+
+    // Rounds an offset up to a cache line.
+    static uint64_t _align(uint64_t offset) { return (offset + 63) & ~(uint64_t)63; }
+
+    // Seeded 64-bit hash of a key.
+    uint64_t _hash(const K &key, uint64_t seed) const { return mixHash((uint64_t)hasher_(key) ^ seed); }
+
+    // Maps a key hash to its bucket. The high bits choose between the dense
+    // and the sparse buckets and the low bits choose one of them.
+    static uint64_t _bucket(uint64_t hash, uint64_t bucketCount)
+    {
+        uint64_t dense = bucketCount * 3 / 10;
+        if (dense == 0)
+        {
+            return (hash >> 32) % bucketCount;
+        }
+        if ((hash >> 32) < denseKeysBelow)
+        {
+            return (uint32_t)hash % dense;
+        }
+        return dense + (uint32_t)hash % (bucketCount - dense);
+    }
+
+    // Position of a key hash under a pilot, before remapping.
+    static uint64_t _position(uint64_t hash, uint16_t pilot, uint64_t tableSize)
+    {
+        return mixHash(hash ^ ((uint64_t)(pilot + 1) * 0x9e3779b97f4a7c15ULL)) % tableSize;
+    }
+
+    // Returns whether count elements of the given size, starting at offset,
+    // lie between the header and the end of a layout of the given size, and
+    // whether offset is aligned for them.
+    static bool _fits(uint64_t offset, uint64_t count, size_t elementSize, size_t alignment, uint64_t totalBytes)
+    {
+        return offset >= sizeof(Header) && offset % alignment == 0 && offset <= totalBytes &&
+               count <= (totalBytes - offset) / elementSize;
+    }
+
+    // Returns whether every section named in header lies inside a mapping of
+    // the given size, with the sizes implied by the header's counts.
+    static bool _validLayout(const Header &header, size_t mappedBytes)
+    {
+        uint64_t total = header.totalBytes;
+        return total <= mappedBytes && header.bucketCount >= 1 && header.tableSize >= 1 &&
+               header.tableSize >= header.count && header.count <= UINT32_MAX &&
+               _fits(header.pilotsOffset, header.bucketCount, sizeof(uint16_t), alignof(uint16_t), total) &&
+               _fits(header.remapOffset, header.tableSize - header.count, sizeof(uint32_t), alignof(uint32_t), total) &&
+               _fits(header.overflowOffset, header.overflowCount, sizeof(Overflow), alignof(Overflow), total) &&
+               _fits(header.keysOffset, header.count, sizeof(K), alignof(K), total) &&
+               _fits(header.valuesOffset, header.count, sizeof(V), alignof(V), total);
+    }
+
+    // Builds the layout into storage_. Returns false if two keys in the
+    // overflow array share a hash, in which case the caller retries with
+    // another seed.
+    bool _build(const std::vector<K> &keys, const std::vector<V> &values, uint64_t seed);
+
+    // Releases the mapping, if any.
+    void _unmap()
+    {
+        if (mapped_)
+        {
+            munmap(mapped_, mappedBytes_);
+            mapped_ = nullptr;
+            mappedBytes_ = 0;
+        }
+    }
+
+public:
+    // Returns a pointer to the value stored under key, or nullptr if key was
+    // not in the table when it was frozen. One hash, one slot, one compare.
+    const V *find(const K &key) const;
+
+    // Returns whether key is in the table.
+    bool containsKey(const K &key) const { return find(key) != nullptr; }
+
+    // Returns the value stored under key, or throws if it does not exist.
+    V get(const K &key) const
+    {
+        const V *value = find(key);
+        if (!value)
+        {
+            throw std::runtime_error("[WARNING]: Trying to retrieve a value that does not exist.");
+        }
+        return *value;
+    }
+
+    // Returns the number of keys.
+    int size() const { return (int)_header().count; }
+
+    // Returns a boolean signifying if the table is empty or not.
+    bool isEmpty() const { return _header().count == 0; }
+
+    // Bits spent on the perfect hash function itself (pilots and remap) per key.
+    double hashBitsPerKey() const
+    {
+        const Header &header = _header();
+        if (header.count == 0)
+        {
+            return 0.0;
+        }
+        double bits = (double)header.bucketCount * 16.0 + (double)(header.tableSize - header.count) * 32.0 +
+                      (double)header.overflowCount * 8.0 * sizeof(Overflow);
+        return bits / (double)header.count;
+    }
+
+    // The flat layout, e.g. for writing it somewhere other than a file.
+    const unsigned char *data() const { return _base(); }
+    size_t byteSize() const { return (size_t)_header().totalBytes; }
+
+    // Writes the flat layout to a file that mapFile() can open.
+    void save(const std::string &path) const;
+
+    // Opens a file written by save() by mapping it read-only into memory. No
+    // data is copied; pages are loaded on demand by the operating system.
+    static FrozenHashTable mapFile(const std::string &path);
+
+    // Builds the table over the given keys and values, which must be unique
+    // keys with values at the same index. HashTable::freeze() calls this with
+    // getKeys() and getValues().
+    FrozenHashTable(const std::vector<K> &keys, const std::vector<V> &values, const Hash &hasher = Hash());
+
+    FrozenHashTable(const FrozenHashTable &other) : storage_(), mapped_(nullptr), mappedBytes_(0), hasher_(other.hasher_)
+    {
+        *this = other;
+    }
+
+    // Copying a mapped table copies its bytes into owned storage.
+    FrozenHashTable &operator=(const FrozenHashTable &other)
+    {
+        if (this == &other)
+        {
+            return *this;
+        }
+        std::vector<uint64_t> copy((other.byteSize() + 7) / 8);
+        std::memcpy(copy.data(), other.data(), other.byteSize());
+        _unmap();
+        storage_.swap(copy);
+        hasher_ = other.hasher_;
+        return *this;
+    }
+
+    FrozenHashTable(FrozenHashTable &&other) noexcept
+        : storage_(std::move(other.storage_)), mapped_(other.mapped_), mappedBytes_(other.mappedBytes_), hasher_(other.hasher_)
+    {
+        other.mapped_ = nullptr;
+        other.mappedBytes_ = 0;
+    }
+
+    ~FrozenHashTable() { _unmap(); }
+
+private:
+    // Used by mapFile().
+    FrozenHashTable() : mapped_(nullptr), mappedBytes_(0), hasher_() {}
+};
+
+// ===================================================================================
+// Implementation Section
+// ===================================================================================
+
+template <typename K, typename V, typename Hash>
+FrozenHashTable<K, V, Hash>::FrozenHashTable(const std::vector<K> &keys, const std::vector<V> &values, const Hash &hasher)
+    : mapped_(nullptr), mappedBytes_(0), hasher_(hasher)
+{
+    if (keys.size() != values.size())
+    {
+        throw std::runtime_error("Error: FrozenHashTable needs one value per key.");
+    }
+
+    // Only two keys sharing a 64-bit hash can make a build fail, and a new seed
+    // changes every hash. Retrying a few times only fails for duplicate keys.
+    for (uint64_t attempt = 0; attempt < 16; attempt++)
+    {
+        if (_build(keys, values, mixHash(attempt + 1)))
+        {
+            return;
+        }
+    }
+    throw std::runtime_error("Error: Could not build a perfect hash function. Are the keys unique?");
+}
+
+template <typename K, typename V, typename Hash>
+bool FrozenHashTable<K, V, Hash>::_build(const std::vector<K> &keys, const std::vector<V> &values, uint64_t seed)
+{
+    uint64_t count = keys.size();
+    uint64_t tableSize = count == 0 ? 1 : (uint64_t)((double)count / 0.98) + 1;
+    uint64_t bucketCount = count / keysPerBucket + 1;
+
+    // Group the key indices by bucket with a counting sort.
+    std::vector<uint64_t> hashes(count);
+    std::vector<uint64_t> bucketStart(bucketCount + 1, 0);
+    for (uint64_t i = 0; i < count; i++)
+    {
+        hashes[i] = _hash(keys[i], seed);
+        bucketStart[_bucket(hashes[i], bucketCount) + 1]++;
+    }
+    for (uint64_t b = 0; b < bucketCount; b++)
+    {
+        bucketStart[b + 1] += bucketStart[b];
+    }
+    std::vector<uint64_t> members(count);
+    std::vector<uint64_t> fill(bucketStart.begin(), bucketStart.end() - 1);
+    for (uint64_t i = 0; i < count; i++)
+    {
+        members[fill[_bucket(hashes[i], bucketCount)]++] = i;
+    }
+
+    // Largest buckets first, while the table is still mostly empty.
+    std::vector<uint64_t> order(bucketCount);
+    for (uint64_t b = 0; b < bucketCount; b++)
+    {
+        order[b] = b;
+    }
+    std::sort(order.begin(), order.end(), [&](uint64_t a, uint64_t b)
+              { return bucketStart[a + 1] - bucketStart[a] > bucketStart[b + 1] - bucketStart[b]; });
+
+    std::vector<uint16_t> pilots(bucketCount, 0);
+    std::vector<bool> taken(tableSize, false);
+    std::vector<uint64_t> positions;
+    std::vector<uint64_t> escaped;
+    for (uint64_t b : order)
+    {
+        uint64_t first = bucketStart[b];
+        uint64_t last = bucketStart[b + 1];
+        if (first == last)
+        {
+            break; // every remaining bucket is empty too
+        }
+
+        bool placed = false;
+        for (uint32_t pilot = 0; pilot < escapePilot && !placed; pilot++)
+        {
+            positions.clear();
+            bool fits = true;
+            for (uint64_t m = first; m < last && fits; m++)
+            {
+                uint64_t position = _position(hashes[members[m]], (uint16_t)pilot, tableSize);
+                fits = !taken[position] && std::find(positions.begin(), positions.end(), position) == positions.end();
+                positions.push_back(position);
+            }
+            if (fits)
+            {
+                for (uint64_t position : positions)
+                {
+                    taken[position] = true;
+                }
+                pilots[b] = (uint16_t)pilot;
+                placed = true;
+            }
+        }
+        if (!placed)
+        {
+            // Placed in the overflow array once the remap is done.
+            pilots[b] = escapePilot;
+            for (uint64_t m = first; m < last; m++)
+            {
+                escaped.push_back(members[m]);
+            }
+        }
+    }
+
+    // Send every occupied position past count to a free slot below count.
+    std::vector<uint32_t> remap(tableSize - count, 0);
+    uint64_t hole = 0;
+    for (uint64_t position = count; position < tableSize; position++)
+    {
+        if (!taken[position])
+        {
+            continue;
+        }
+        while (taken[hole])
+        {
+            hole++;
+        }
+        remap[position - count] = (uint32_t)hole;
+        taken[hole] = true;
+    }
+
+    // Escaped keys take the holes that are still left below count.
+    std::vector<Overflow> overflow;
+    for (uint64_t key : escaped)
+    {
+        while (taken[hole])
+        {
+            hole++;
+        }
+        overflow.push_back(Overflow{hashes[key], hole});
+        taken[hole] = true;
+    }
+    std::sort(overflow.begin(), overflow.end(), [](const Overflow &a, const Overflow &b)
+              { return a.hash < b.hash; });
+    for (size_t i = 1; i < overflow.size(); i++)
+    {
+        if (overflow[i].hash == overflow[i - 1].hash)
+        {
+            return false;
+        }
+    }
+
+    // Lay everything out in one buffer.
+    Header header;
+    std::memset(&header, 0, sizeof(header));
+    header.magic = layoutMagic;
+    header.version = layoutVersion;
+    header.keySize = sizeof(K);
+    header.valueSize = sizeof(V);
+    header.count = count;
+    header.tableSize = tableSize;
+    header.bucketCount = bucketCount;
+    header.seed = seed;
+    header.overflowCount = overflow.size();
+    header.pilotsOffset = _align(sizeof(Header));
+    header.remapOffset = _align(header.pilotsOffset + bucketCount * sizeof(uint16_t));
+    header.overflowOffset = _align(header.remapOffset + remap.size() * sizeof(uint32_t));
+    header.keysOffset = _align(header.overflowOffset + overflow.size() * sizeof(Overflow));
+    header.valuesOffset = _align(header.keysOffset + count * sizeof(K));
+    header.totalBytes = header.valuesOffset + count * sizeof(V);
+
+    storage_.assign((header.totalBytes + 7) / 8, 0);
+    unsigned char *base = (unsigned char *)storage_.data();
+    std::memcpy(base, &header, sizeof(header));
+    std::memcpy(base + header.pilotsOffset, pilots.data(), bucketCount * sizeof(uint16_t));
+    if (!remap.empty())
+    {
+        std::memcpy(base + header.remapOffset, remap.data(), remap.size() * sizeof(uint32_t));
+    }
+    if (!overflow.empty())
+    {
+        std::memcpy(base + header.overflowOffset, overflow.data(), overflow.size() * sizeof(Overflow));
+    }
+
+    K *slotKeys = (K *)(base + header.keysOffset);
+    V *slotValues = (V *)(base + header.valuesOffset);
+    for (uint64_t i = 0; i < count; i++)
+    {
+        uint16_t pilot = pilots[_bucket(hashes[i], bucketCount)];
+        uint64_t slot;
+        if (pilot == escapePilot)
+        {
+            slot = std::lower_bound(overflow.begin(), overflow.end(), Overflow{hashes[i], 0},
+                                    [](const Overflow &a, const Overflow &b)
+                                    { return a.hash < b.hash; })
+                       ->slot;
+        }
+        else
+        {
+            uint64_t position = _position(hashes[i], pilot, tableSize);
+            slot = position < count ? position : remap[position - count];
+        }
+        std::memcpy((void *)&slotKeys[slot], &keys[i], sizeof(K));
+        std::memcpy((void *)&slotValues[slot], &values[i], sizeof(V));
+    }
+    return true;
+}
+
+template <typename K, typename V, typename Hash>
+const V *FrozenHashTable<K, V, Hash>::find(const K &key) const
+{
+    const Header &header = _header();
+    if (header.count == 0)
+    {
+        return nullptr;
+    }
+
+    uint64_t hash = _hash(key, header.seed);
+    uint16_t pilot = _pilots()[_bucket(hash, header.bucketCount)];
+    uint64_t slot;
+    if (pilot == escapePilot)
+    {
+        const Overflow *first = _overflow();
+        const Overflow *last = first + header.overflowCount;
+        const Overflow *found = std::lower_bound(first, last, Overflow{hash, 0}, [](const Overflow &a, const Overflow &b)
+                                                 { return a.hash < b.hash; });
+        if (found == last || found->hash != hash)
+        {
+            return nullptr;
+        }
+        slot = found->slot;
+    }
+    else
+    {
+        uint64_t position = _position(hash, pilot, header.tableSize);
+        slot = position < header.count ? position : _remap()[position - header.count];
+    }
+
+    // The function is only perfect for the frozen keys, so a foreign key still
+    // lands somewhere and has to be rejected by comparing. The slot comes from
+    // the remap or overflow array, which a damaged file can fill with anything.
+    if (slot >= header.count || !(_keys()[slot] == key))
+    {
+        return nullptr;
+    }
+    return &_values()[slot];
+}
+
+template <typename K, typename V, typename Hash>
+void FrozenHashTable<K, V, Hash>::save(const std::string &path) const
+{
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out)
+    {
+        throw std::runtime_error("Error: Could not open " + path + " for writing.");
+    }
+    out.write((const char *)data(), (std::streamsize)byteSize());
+    if (!out)
+    {
+        throw std::runtime_error("Error: Could not write " + path + ".");
+    }
+}
+
+template <typename K, typename V, typename Hash>
+FrozenHashTable<K, V, Hash> FrozenHashTable<K, V, Hash>::mapFile(const std::string &path)
+{
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+        throw std::runtime_error("Error: Could not open " + path + ".");
+    }
+    struct stat info;
+    if (fstat(fd, &info) != 0 || (size_t)info.st_size < sizeof(Header))
+    {
+        close(fd);
+        throw std::runtime_error("Error: " + path + " is not a frozen hash table.");
+    }
+    void *mapped = mmap(nullptr, (size_t)info.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (mapped == MAP_FAILED)
+    {
+        throw std::runtime_error("Error: Could not map " + path + ".");
+    }
+
+    FrozenHashTable table;
+    table.mapped_ = mapped;
+    table.mappedBytes_ = (size_t)info.st_size;
+
+    const Header &header = table._header();
+    if (header.magic != layoutMagic || header.version != layoutVersion || header.keySize != sizeof(K) ||
+        header.valueSize != sizeof(V))
+    {
+        throw std::runtime_error("Error: " + path + " does not match this FrozenHashTable type or version.");
+    }
+    // Lookups index every section straight from the header, so a truncated or
+    // damaged file is turned away here instead of being read out of bounds.
+    if (!_validLayout(header, table.mappedBytes_))
+    {
+        throw std::runtime_error("Error: " + path + " is damaged: its sections do not fit in the file.");
+    }
+    return table;
+}
+
+template <typename K, typename V, typename Hash, typename Allocator>
+FrozenHashTable<K, V, Hash> HashTable<K, V, Hash, Allocator>::freeze() const
+{
+    // getKeys and getValues walk the buckets in the same order, so the i-th
+    // value belongs to the i-th key.
+    return FrozenHashTable<K, V, Hash>(getKeys(), getValues(), hasher_);
+}
@@ -0,0 +1,626 @@
+/**
+ * @file PersistentHashTable.h
+ * @author Kofi Boateng
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ *
+ */
+
+#pragma once
+#include <stdexcept>          // for runtime_error
+#include <cerrno>             // for errno codes
+#include <cstddef>            // for size_t
+#include <cstdint>            // for fixed width integers
+#include <cstdio>             // for rename and remove
+#include <cstring>            // for strerror
+#include <condition_variable> // for group commit
+#include <fstream>            // for the snapshot
+#include <functional>         // for std::hash, the default hashing policy
+#include <mutex>              // for the table and the log
+#include <string>             // for paths
+#include <vector>             // for log buffers and replayed records
+#include <fcntl.h>            // for open
+#include <sys/stat.h>         // for mkdir and fstat
+#include <unistd.h>           // for write, fsync and ftruncate
+#include "../SeparateChainingHashTable/SeparateChainingHashTable.h"
+#include "../../Serialization/BinaryStream.h"
+#include "../../Serialization/Crc32c.h"
+#include "../../Concurrency/ParallelRanges.h"
+
+// This is an implementation of a Persistent Hash Table: a HashTable kept in memory whose changes are also
+// appended to a write-ahead log on disk, so it comes back after a crash without writing out the whole
+// table on every change.
+// Every insert and remove is encoded (Refer to Serialization/BinaryStream.h) into one log record: the
+// payload length, a CRC-32C of the payload, then the operation, its log sequence number (LSN), the key and
+// for inserts the value. Records are collected in memory and written with a single write and fsync
+// (group commit). Whichever thread needs durability first becomes the leader and syncs everything
+// buffered so far, its own record and those of every thread that arrived meanwhile. Others wait for the
+// leader and then find that their records are on disk already. New records go into a second buffer while
+// the leader is writing, so logging never stops for an fsync.
+// syncEvery sets how many operations may share an fsync. With 1, every insert and remove returns only once
+// it is durable (concurrent callers still share fsyncs). With N, the operation that completes a group of N
+// syncs the group, so a crash loses at most the last N - 1 operations. With 0, nothing is synced until
+// sync() or checkpoint().
+// A checkpoint (compaction) writes the table to a snapshot file, which is replaced atomically by a
+// rename, and then empties the log. It runs by itself once the log passes checkpointBytes.
+// Recovery loads the snapshot and replays the log records newer than it. The record boundaries are found
+// in one quick pass over the length fields, and then the checksums are verified and the records decoded
+// in parallel on the ThreadPool. The decoded operations are applied in LSN order, since later operations
+// on a key must win. Replay stops at the first torn record or failed checksum, and the log is cut there.
+// All operations are thread-safe. Changes are visible to readers as soon as they are applied, possibly
+// before they are durable. If a write or fsync fails, that call throws and so does every later
+// change, since the log can no longer be trusted; reads keep working.
+
+struct WalOptions
+{
+    // Operations per fsync, or 0 to sync only in sync() and checkpoint().
+    size_t syncEvery = 1;
+    // Log size in bytes that triggers a checkpoint, or 0 for never.
+    size_t checkpointBytes = 64 << 20;
+    // Threads that verify and decode the log during recovery, or 0 for the
+    // size of the global ThreadPool.
+    int recoveryThreads = 0;
+};
+
+template <typename K, typename V, typename Hash = std::hash<K>>
+class PersistentHashTable
+{
+private:
+    enum Operation : uint8_t
+    {
+        Insert = 1,
+        Remove = 2
+    };
+
+    // Length and checksum that precede every payload.
+    static constexpr size_t headerBytes = 8;
+
+    struct Replayed
+    {
+        uint8_t operation = 0;
+        uint64_t lsn = 0;
+        K key;
+        V value;
+    };
+
+    std::string directory_;
+    WalOptions options_;
+    HashTable<K, V, Hash> table_;
+    int log_;
+
+    mutable std::mutex lock_;
+    std::condition_variable synced_;
+    // Records not yet handed to the log file.
+    std::vector<char> pending_;
+    // Records the current leader is writing; only the leader touches it.
+    std::vector<char> writing_;
+    // One payload being encoded.
+    std::vector<char> scratch_;
+    BinaryWriter encoder_;
+
+    // LSN of the last record logged, of the last one on disk, of the last
+    // one in the snapshot, and of the last one a caller asked to sync.
+    uint64_t lastLsn_;
+    uint64_t durableLsn_;
+    uint64_t snapshotLsn_;
+    uint64_t requestedLsn_;
+    // Size of the log, written and pending.
+    size_t logBytes_;
+    // Set while a leader is writing to the log outside the lock.
+    bool syncing_;
+    // errno of the write or fsync that failed, or 0.
+    int error_;
+
+    std::string _path(const char *name) const { return directory_ + "/" + name; }
+
+    void _checkError() const
+    {
+        if (error_ != 0)
+        {
+            throw std::runtime_error(std::string("Error: PersistentHashTable log write failed: ") + std::strerror(error_));
+        }
+    }
+
+    void _apply(const K &key, const V &value)
+    {
+        V *slot = table_.find(key);
+        if (slot)
+        {
+            *slot = value;
+        }
+        else
+        {
+            table_.add(key, value);
+        }
+    }
+
+    // Encodes one record into pending_ and returns its LSN.
+    uint64_t _append(uint8_t operation, const K &key, const V *value);
+
+    // Syncs (if syncEvery says so) and checkpoints (if the log is large
+    // enough) after the record lsn was appended.
+    void _afterAppend(std::unique_lock<std::mutex> &lock, uint64_t lsn);
+
+    // Returns once every record up to lsn is durable, leading the group
+    // commit if no other thread is.
+    void _commit(std::unique_lock<std::mutex> &lock, uint64_t lsn);
+
+    void _checkpoint(std::unique_lock<std::mutex> &lock);
+
+    // Writes bytes to the end of the log and fsyncs it. Returns 0 or errno.
+    int _writeAndSync(const std::vector<char> &bytes);
+
+    // Writes the table and the LSN it includes to a new snapshot file.
+    void _writeSnapshot();
+
+    // Loads the snapshot, replays the log and opens it for appending.
+    void _recover();
+
+    static int _syncPath(const std::string &path);
+
+public:
+    // Inserts or updates key. Returns once the change is logged and, every
+    // syncEvery operations, durable.
+    void insert(const K &key, const V &value)
+    {
+        std::unique_lock<std::mutex> lock(lock_);
+        _checkError();
+        uint64_t lsn = _append(Insert, key, &value);
+        _apply(key, value);
+        _afterAppend(lock, lsn);
+    }
+
+    // Removes key. Returns false (and logs nothing) if it does not exist.
+    bool remove(const K &key)
+    {
+        std::unique_lock<std::mutex> lock(lock_);
+        _checkError();
+        if (!table_.find(key))
+        {
+            return false;
+        }
+        uint64_t lsn = _append(Remove, key, nullptr);
+        table_.remove(key);
+        _afterAppend(lock, lsn);
+        return true;
+    }
+
+    // Copies the value of key into value and returns true, or returns false.
+    bool find(const K &key, V &value) const
+    {
+        std::lock_guard<std::mutex> lock(lock_);
+        const V *slot = table_.find(key);
+        if (!slot)
+        {
+            return false;
+        }
+        value = *slot;
+        return true;
+    }
+
+    // Returns the value of key. Throws if it does not exist.
+    V get(const K &key) const
+    {
+        V value;
+        if (!find(key, value))
+        {
+            throw std::runtime_error("Error: key does not exist in the PersistentHashTable.");
+        }
+        return value;
+    }
+
+    bool containsKey(const K &key) const
+    {
+        std::lock_guard<std::mutex> lock(lock_);
+        return table_.find(key) != nullptr;
+    }
+
+    int size() const
+    {
+        std::lock_guard<std::mutex> lock(lock_);
+        return table_.size();
+    }
+
+    // Makes every change logged so far durable.
+    void sync()
+    {
+        std::unique_lock<std::mutex> lock(lock_);
+        requestedLsn_ = lastLsn_;
+        _commit(lock, lastLsn_);
+    }
+
+    // Writes a snapshot of the table and empties the log.
+    void checkpoint()
+    {
+        std::unique_lock<std::mutex> lock(lock_);
+        _checkpoint(lock);
+    }
+
+    // Returns the LSN of the last change.
+    uint64_t lastLsn() const
+    {
+        std::lock_guard<std::mutex> lock(lock_);
+        return lastLsn_;
+    }
+
+    // Returns the LSN up to which every change is on disk.
+    uint64_t durableLsn() const
+    {
+        std::lock_guard<std::mutex> lock(lock_);
+        return durableLsn_;
+    }
+
+    // Returns the size of the log in bytes, including records not yet written.
+    size_t logBytes() const
+    {
+        std::lock_guard<std::mutex> lock(lock_);
+        return logBytes_;
+    }
+
+    // Opens (creating it if needed) the table stored in directory and
+    // recovers its contents.
+    explicit PersistentHashTable(const std::string &directory, const WalOptions &options = WalOptions(), const Hash &hasher = Hash())
+        : directory_(directory), options_(options), table_(16, hasher), log_(-1), encoder_(scratch_), lastLsn_(0), durableLsn_(0),
+          snapshotLsn_(0), requestedLsn_(0), logBytes_(0), syncing_(false), error_(0)
+    {
+        _recover();
+    }
+
+    PersistentHashTable(const PersistentHashTable &) = delete;
+    PersistentHashTable &operator=(const PersistentHashTable &) = delete;
+
+    // Syncs whatever is still buffered. Call sync() first to see errors.
+    ~PersistentHashTable()
+    {
+        try
+        {
+            sync();
+        }
+        catch (...)
+        {
+        }
+        close(log_);
+    }
+};
+
+// ===================================================================================
+// Implementation Section
+// ===================================================================================
+
+template <typename K, typename V, typename Hash>
+uint64_t PersistentHashTable<K, V, Hash>::_append(uint8_t operation, const K &key, const V *value)
+{
+    uint64_t lsn = lastLsn_ + 1;
+    scratch_.clear();
+    encoder_.write(operation);
+    encoder_.write(lsn);
+    encoder_.write(key);
+    if (value)
+    {
+        encoder_.write(*value);
+    }
+    encoder_.flush();
+
+    uint32_t length = (uint32_t)scratch_.size();
+    uint32_t checksum = crc32c(scratch_.data(), scratch_.size());
+    char header[headerBytes];
+    for (int i = 0; i < 4; i++)
+    {
+        header[i] = (char)(length >> (8 * i));
+        header[4 + i] = (char)(checksum >> (8 * i));
+    }
+    pending_.insert(pending_.end(), header, header + headerBytes);
+    pending_.insert(pending_.end(), scratch_.begin(), scratch_.end());
+    logBytes_ += headerBytes + length;
+    lastLsn_ = lsn;
+    return lsn;
+}
+
+template <typename K, typename V, typename Hash>
+void PersistentHashTable<K, V, Hash>::_afterAppend(std::unique_lock<std::mutex> &lock, uint64_t lsn)
+{
+    if (options_.syncEvery > 0 && lsn - requestedLsn_ >= options_.syncEvery)
+    {
+        requestedLsn_ = lsn;
+        _commit(lock, lsn);
+    }
+    if (options_.checkpointBytes > 0 && logBytes_ >= options_.checkpointBytes)
+    {
+        _checkpoint(lock);
+    }
+}
+
+template <typename K, typename V, typename Hash>
+void PersistentHashTable<K, V, Hash>::_commit(std::unique_lock<std::mutex> &lock, uint64_t lsn)
+{
+    while (durableLsn_ < lsn)
+    {
+        _checkError();
+        if (syncing_)
+        {
+            // The leader's batch may already hold this record; if not, the
+            // next round picks it up.
+            synced_.wait(lock);
+            continue;
+        }
+        syncing_ = true;
+        writing_.swap(pending_);
+        uint64_t upTo = lastLsn_;
+        lock.unlock();
+        int error = _writeAndSync(writing_);
+        writing_.clear();
+        lock.lock();
+        syncing_ = false;
+        if (error != 0)
+        {
+            error_ = error;
+        }
+        else
+        {
+            durableLsn_ = upTo;
+        }
+        synced_.notify_all();
+    }
+}
+
+template <typename K, typename V, typename Hash>
+void PersistentHashTable<K, V, Hash>::_checkpoint(std::unique_lock<std::mutex> &lock)
+{
+    // Wait for a leader that is writing outside the lock. From here on the
+    // lock is held, so nothing is appended until the checkpoint is done.
+    synced_.wait(lock, [this]()
+                 { return !syncing_; });
+    _checkError();
+
+    // Log what is buffered first, so a failed snapshot loses nothing.
+    int error = _writeAndSync(pending_);
+    if (error != 0)
+    {
+        error_ = error;
+        _checkError();
+    }
+    pending_.clear();
+    durableLsn_ = lastLsn_;
+
+    _writeSnapshot();
+    snapshotLsn_ = lastLsn_;
+    // Every record is in the snapshot now. A crash before the log is emptied
+    // only leaves records that replay skips.
+    if (ftruncate(log_, 0) != 0 || fsync(log_) != 0)
+    {
+        error_ = errno;
+        _checkError();
+    }
+    logBytes_ = 0;
+}
+
+template <typename K, typename V, typename Hash>
+int PersistentHashTable<K, V, Hash>::_writeAndSync(const std::vector<char> &bytes)
+{
+    size_t written = 0;
+    while (written < bytes.size())
+    {
+        ssize_t count = write(log_, bytes.data() + written, bytes.size() - written);
+        if (count < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            return errno;
+        }
+        written += (size_t)count;
+    }
+#if defined(__linux__)
+    if (fdatasync(log_) != 0)
+#else
+    if (fsync(log_) != 0)
+#endif
+    {
+        return errno;
+    }
+    return 0;
+}
+
+template <typename K, typename V, typename Hash>
+int PersistentHashTable<K, V, Hash>::_syncPath(const std::string &path)
+{
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+        return errno;
+    }
+    int error = fsync(fd) == 0 ? 0 : errno;
+    close(fd);
+    return error;
+}
+
+template <typename K, typename V, typename Hash>
+void PersistentHashTable<K, V, Hash>::_writeSnapshot()
+{
+    std::string temporary = _path("snapshot.tmp");
+    {
+        std::ofstream out(temporary, std::ios::binary | std::ios::trunc);
+        if (!out)
+        {
+            throw std::runtime_error("Error: PersistentHashTable could not create " + temporary + ".");
+        }
+        BinaryWriter writer(out);
+        writer.beginObject("PHTS", 1);
+        writer.write(lastLsn_);
+        table_.serialize(writer);
+        writer.flush();
+        out.close();
+        if (out.fail())
+        {
+            throw std::runtime_error("Error: PersistentHashTable could not write " + temporary + ".");
+        }
+    }
+    // The file's contents, then its new name, have to be on disk before the
+    // log may be emptied.
+    if (_syncPath(temporary) != 0 || std::rename(temporary.c_str(), _path("snapshot").c_str()) != 0 ||
+        _syncPath(directory_) != 0)
+    {
+        throw std::runtime_error("Error: PersistentHashTable could not install a new snapshot.");
+    }
+}
+
+template <typename K, typename V, typename Hash>
+void PersistentHashTable<K, V, Hash>::_recover()
+{
+    if (mkdir(directory_.c_str(), 0755) != 0 && errno != EEXIST)
+    {
+        throw std::runtime_error("Error: PersistentHashTable could not create " + directory_ + ".");
+    }
+    // A snapshot.tmp is the remains of a checkpoint that never finished.
+    std::remove(_path("snapshot.tmp").c_str());
+
+    {
+        std::ifstream in(_path("snapshot"), std::ios::binary);
+        if (in)
+        {
+            BinaryReader reader(in);
+            reader.beginObject("PHTS", 1);
+            reader.read(snapshotLsn_);
+            table_.deserialize(reader);
+        }
+    }
+
+    std::string logPath = _path("wal");
+    log_ = open(logPath.c_str(), O_RDWR | O_CREAT | O_APPEND, 0644);
+    if (log_ < 0)
+    {
+        throw std::runtime_error("Error: PersistentHashTable could not open " + logPath + ": " + std::strerror(errno));
+    }
+    _syncPath(directory_);
+
+    struct stat info;
+    if (fstat(log_, &info) != 0)
+    {
+        close(log_);
+        throw std::runtime_error("Error: PersistentHashTable could not stat " + logPath + ".");
+    }
+    std::vector<char> log((size_t)info.st_size);
+    size_t got = 0;
+    while (got < log.size())
+    {
+        ssize_t count = pread(log_, log.data() + got, log.size() - got, (off_t)got);
+        if (count <= 0)
+        {
+            if (count < 0 && errno == EINTR)
+            {
+                continue;
+            }
+            break;
+        }
+        got += (size_t)count;
+    }
+    log.resize(got);
+
+    // Find where every record starts. A length that runs past the end of
+    // the file is a record torn by the crash.
+    std::vector<size_t> offsets;
+    size_t position = 0;
+    while (position + headerBytes <= log.size())
+    {
+        const unsigned char *header = reinterpret_cast<const unsigned char *>(log.data() + position);
+        size_t length = (size_t)header[0] | (size_t)header[1] << 8 | (size_t)header[2] << 16 | (size_t)header[3] << 24;
+        if (length > log.size() - position - headerBytes)
+        {
+            break;
+        }
+        offsets.push_back(position);
+        position += headerBytes + length;
+    }
+    offsets.push_back(position);
+    size_t count = offsets.size() - 1;
+
+    // Verify and decode the records in parallel. Each thread remembers the
+    // first bad record of its range.
+    std::vector<Replayed> records(count);
+    int threads = options_.recoveryThreads > 0 ? options_.recoveryThreads : ThreadPool::global().size();
+    std::vector<size_t> firstBad(threads > 0 ? threads : 1, count);
+    parallelRanges(count, threads, [&](size_t begin, size_t end, int thread)
+                   {
+        for (size_t i = begin; i < end; i++)
+        {
+            const unsigned char *header = reinterpret_cast<const unsigned char *>(log.data() + offsets[i]);
+            uint32_t checksum = (uint32_t)header[4] | (uint32_t)header[5] << 8 | (uint32_t)header[6] << 16 | (uint32_t)header[7] << 24;
+            const char *payload = log.data() + offsets[i] + headerBytes;
+            size_t length = offsets[i + 1] - offsets[i] - headerBytes;
+            bool valid = crc32c(payload, length) == checksum;
+            if (valid)
+            {
+                try
+                {
+                    BinaryReader reader(payload, length);
+                    Replayed &record = records[i];
+                    reader.read(record.operation);
+                    reader.read(record.lsn);
+                    reader.read(record.key);
+                    if (record.operation == Insert)
+                    {
+                        reader.read(record.value);
+                    }
+                    valid = (record.operation == Insert || record.operation == Remove) && reader.atEnd();
+                }
+                catch (const std::exception &)
+                {
+                    valid = false;
+                }
+            }
+            if (!valid)
+            {
+                firstBad[thread] = i;
+                return;
+            }
+        } });
+
+    size_t valid = count;
+    for (size_t bad : firstBad)
+    {
+        valid = bad < valid ? bad : valid;
+    }
+    // LSNs are consecutive; a gap means what follows is not from this log.
+    for (size_t i = 1; i < valid; i++)
+    {
+        if (records[i].lsn != records[i - 1].lsn + 1)
+        {
+            valid = i;
+            break;
+        }
+    }
+
+    lastLsn_ = snapshotLsn_;
+    for (size_t i = 0; i < valid; i++)
+    {
+        const Replayed &record = records[i];
+        if (record.lsn <= snapshotLsn_)
+        {
+            continue;
+        }
+        if (record.operation == Insert)
+        {
+            _apply(record.key, record.value);
+        }
+        else if (table_.find(record.key))
+        {
+            table_.remove(record.key);
+        }
+        lastLsn_ = record.lsn;
+    }
+
+    // Cut the torn tail so new records follow the last good one.
+    logBytes_ = offsets[valid];
+    if (logBytes_ < (size_t)info.st_size)
+    {
+        if (ftruncate(log_, (off_t)logBytes_) != 0 || fsync(log_) != 0)
+        {
+            close(log_);
+            throw std::runtime_error("Error: PersistentHashTable could not truncate " + logPath + ".");
+        }
+    }
+    durableLsn_ = lastLsn_;
+    requestedLsn_ = lastLsn_;
+}
@@ -16,6 +16,10 @@
 #include <string>
 #include <list>
 #include <vector>
+#include <functional> // for std::hash, the default hashing policy
+#include <memory>     // for allocator_traits
+#include <climits>    // for INT_MAX
+#include "../../Serialization/BinaryStream.h"
 using std::begin;
 using std::cout;
 using std::end;
@@ -23,26 +27,68 @@ using std::endl;
 using std::list;
 using std::pair;
 
+// Defined in FrozenHashTable.h together with HashTable::freeze(), so that only
+// code which freezes a table pulls in the file mapping headers.
+template <typename K, typename V, typename Hash>
+class FrozenHashTable;
+
 // This is an implementation of a Separate-Chaining Hash Table. A Separate chaining hash table uses a separate data structure,
 // Linked List, Tree, Array, etc., to help handle collisions during hash computing. This implementation will use a linked list
 // as auxilarry helper.
+// The hashing policy is pluggable through the Hash template parameter. It defaults to std::hash<K>, which is the identity
+// for integral keys, so integer tables hash exactly as they did with the original key % buckets scheme.
+// The chain nodes and the bucket array come from Allocator, so a very large table can keep them in the
+// huge pages of a HugePageArena by passing an ArenaAllocator<pair<K, V>> (Refer to Memory/ArenaAllocator.h).
 
-template <typename K, typename V>
+template <typename K, typename V, typename Hash = std::hash<K>, typename Allocator = std::allocator<pair<K, V>>>
 class HashTable
 {
 private:
-    static const int buckets = 10;
-    list<pair<K, V>> table[buckets];
+    typedef list<pair<K, V>, Allocator> Bucket;
+    typedef typename std::allocator_traits<Allocator>::template rebind_alloc<Bucket> BucketAllocator;
+
+    // Number of buckets currently allocated. The table doubles this whenever
+    // the load factor passes maxLoadFactor so chains stay short on average.
+    int buckets;
+    // Source of the chain nodes and the bucket array.
+    Allocator allocator_;
+    std::vector<Bucket, BucketAllocator> table;
+
+    // Number of key/value pairs stored in the table.
+    int size_;
+
+    // Hashing policy used to place keys into buckets.
+    Hash hasher_;
+
+    // Once size_ / buckets passes this value, the table is rehashed.
+    static constexpr double maxLoadFactor = 1.0;
+
+    // Moves every pair into a new array of newBuckets chains. The list nodes
+    // are spliced over rather than copied.
+    void _rehash(int newBuckets);
+
+    // Grows the table if the last insertion pushed it past maxLoadFactor.
+    void _growIfNeeded();
 
 public:
     // returns whether the table is empty or not.
     bool isEmpty() const;
+    // Returns how many pairs are stored in the table.
+    int size() const { return size_; }
+    // Returns how many buckets are currently allocated.
+    int bucketCount() const { return buckets; }
+    // Returns the hashing policy so other structures can hash keys the same way.
+    const Hash &hasher() const { return hasher_; }
     // generates hash with K input.
-    int hashFunction(K key);
+    int hashFunction(const K &key) const;
     // inserts element into the table.
     void insert(K key, V value);
     // inserts element into the table.
     void add(K key, V value);
+    // Adds every pair of a batch, growing the table once for the whole batch
+    // instead of doubling along the way. Later pairs override earlier ones
+    // with the same key, without the duplicate warning.
+    void addBatch(std::vector<pair<K, V>> pairs);
     // removes an element from the table if it exsit.
     void remove(K key);
     // removes an element from the table if it exsit.
@@ -51,52 +97,87 @@ public:
     bool containsKey(K key) const;
     // Return the value associated with the given key.
     V get(K key) const;
+    // Returns a pointer to the value associated with the given key, or nullptr
+    // if the key does not exist. The pointer is valid until the key is removed.
+    V *find(const K &key);
+    const V *find(const K &key) const;
     // Returns an immutable array of keys.
     std::vector<K> getKeys() const;
     // Returns an immutable array of values.
     std::vector<V> getValues() const;
+    // Builds a read-only copy of the current contents on a minimal perfect hash
+    // function (Refer to FrozenHashTable.h, which must be included to call it).
+    // Lookups in the frozen copy take one probe. K and V must be trivially copyable.
+    FrozenHashTable<K, V, Hash> freeze() const;
 
     // Output a string representation of the table.
     // This requires that the data type T supports stream output itself.
     // This is used by the operator<< overload defined in this file.
     std::ostream &print(std::ostream &os) const; // Outputs a string.
+
+    // Writes the table to writer (Refer to Serialization/BinaryStream.h).
+    void serialize(BinaryWriter &writer) const;
+    // Replaces the contents of the table with one read from reader. Keys are
+    // rehashed on the way in, so the hashing policy may differ from the writer's.
+    // If reading fails the table is left as it was.
+    void deserialize(BinaryReader &reader);
     // Creates a new table on the heap
-    HashTable() {}
+    HashTable() : buckets(10), allocator_(), table(10, Bucket(allocator_), BucketAllocator(allocator_)), size_(0), hasher_() {}
+
+    // Creates a table with a starting number of buckets. Useful when the caller
+    // knows roughly how many keys will be inserted and wants to skip rehashing.
+    explicit HashTable(int bucketCount, const Hash &hasher = Hash(), const Allocator &allocator = Allocator())
+        : buckets(bucketCount > 0 ? bucketCount : 1), allocator_(allocator),
+          table(bucketCount > 0 ? bucketCount : 1, Bucket(allocator_), BucketAllocator(allocator_)), size_(0), hasher_(hasher) {}
 };
 
 // ============================================================================================================================================================
 // Implementation Section
 // ============================================================================================================================================================
 
-template <typename K, typename V>
-bool HashTable<K, V>::isEmpty() const
+template <typename K, typename V, typename Hash, typename Allocator>
+void HashTable<K, V, Hash, Allocator>::_rehash(int newBuckets)
 {
-    int sum{};
-    // Iterates through the array and checks the size of the buckets
+    std::vector<Bucket, BucketAllocator> newTable(newBuckets, Bucket(allocator_), BucketAllocator(allocator_));
     for (int i{}; i < buckets; i++)
     {
-        sum += table[i].size();
+        auto &cell = table[i];
+        while (!cell.empty())
+        {
+            auto Iter = begin(cell);
+            int hashValue = static_cast<int>(hasher_(Iter->first) % static_cast<size_t>(newBuckets));
+            // Splicing relinks the existing list node into its new chain.
+            newTable[hashValue].splice(end(newTable[hashValue]), cell, Iter);
+        }
     }
-    // Will trigger if the sum adds up to 0
-    if (!sum)
+    table.swap(newTable);
+    buckets = newBuckets;
+}
+
+template <typename K, typename V, typename Hash, typename Allocator>
+void HashTable<K, V, Hash, Allocator>::_growIfNeeded()
+{
+    if (size_ > buckets * maxLoadFactor)
     {
-        return true;
+        _rehash(buckets * 2);
     }
+}
 
-    return false;
+template <typename K, typename V, typename Hash, typename Allocator>
+bool HashTable<K, V, Hash, Allocator>::isEmpty() const
+{
+    return size_ == 0;
 }
 
-template <typename K, typename V>
-int HashTable<K, V>::hashFunction(K key)
+template <typename K, typename V, typename Hash, typename Allocator>
+int HashTable<K, V, Hash, Allocator>::hashFunction(const K &key) const
 {
-    // If our type is a digit, we would rather go ahead and not cast it to a string
-    // and return its modulo for the hash value. For all other instances, we will
-    // stringify keys
-    return key % buckets;
+    // The hashing policy produces a size_t that we fold into the bucket range.
+    return static_cast<int>(hasher_(key) % static_cast<size_t>(buckets));
 }
 
-template <typename K, typename V>
-void HashTable<K, V>::insert(K key, V value)
+template <typename K, typename V, typename Hash, typename Allocator>
+void HashTable<K, V, Hash, Allocator>::insert(K key, V value)
 {
 
     int hashValue = hashFunction(key);
@@ -122,12 +203,14 @@ void HashTable<K, V>::insert(K key, V value)
     if (!keyExist)
     {
         cell.emplace_back(key, value);
+        size_++;
+        _growIfNeeded();
     }
 
     return;
 }
-template <typename K, typename V>
-void HashTable<K, V>::add(K key, V value)
+template <typename K, typename V, typename Hash, typename Allocator>
+void HashTable<K, V, Hash, Allocator>::add(K key, V value)
 {
 
     int hashValue = hashFunction(key);
@@ -152,13 +235,53 @@ void HashTable<K, V>::add(K key, V value)
     if (!keyExist)
     {
         cell.emplace_back(key, value);
+        size_++;
+        _growIfNeeded();
     }
 
     return;
 }
 
-template <typename K, typename V>
-void HashTable<K, V>::remove(K key)
+template <typename K, typename V, typename Hash, typename Allocator>
+void HashTable<K, V, Hash, Allocator>::addBatch(std::vector<pair<K, V>> pairs)
+{
+    // Size for the worst case, every key new, so no rehash happens mid-batch.
+    double needed = (double)size_ + (double)pairs.size();
+    int newBuckets = buckets;
+    while (needed > newBuckets * maxLoadFactor && newBuckets <= INT_MAX / 2)
+    {
+        newBuckets *= 2;
+    }
+    if (newBuckets != buckets)
+    {
+        _rehash(newBuckets);
+    }
+
+    for (auto &entry : pairs)
+    {
+        auto &cell = table[hashFunction(entry.first)];
+        auto Iter = begin(cell);
+        for (; Iter != end(cell); Iter++)
+        {
+            if (Iter->first == entry.first)
+            {
+                break;
+            }
+        }
+        if (Iter != end(cell))
+        {
+            Iter->second = std::move(entry.second);
+        }
+        else
+        {
+            cell.emplace_back(std::move(entry.first), std::move(entry.second));
+            size_++;
+        }
+    }
+}
+
+template <typename K, typename V, typename Hash, typename Allocator>
+void HashTable<K, V, Hash, Allocator>::remove(K key)
 {
     int hashValue = hashFunction(key);
 
@@ -175,6 +298,7 @@ void HashTable<K, V>::remove(K key)
         {
             keyExist = true;
             Iter = cell.erase(Iter);
+            size_--;
             break;
         }
     }
@@ -187,8 +311,8 @@ void HashTable<K, V>::remove(K key)
     return;
 }
 
-template <typename K, typename V>
-void HashTable<K, V>::erase(K key)
+template <typename K, typename V, typename Hash, typename Allocator>
+void HashTable<K, V, Hash, Allocator>::erase(K key)
 {
     int hashValue = hashFunction(key);
 
@@ -205,6 +329,7 @@ void HashTable<K, V>::erase(K key)
         {
             keyExist = true;
             Iter = cell.erase(Iter);
+            size_--;
             break;
         }
     }
@@ -217,72 +342,65 @@ void HashTable<K, V>::erase(K key)
     return;
 }
 
-template <typename K, typename V>
-bool HashTable<K, V>::containsKey(K key) const
+template <typename K, typename V, typename Hash, typename Allocator>
+bool HashTable<K, V, Hash, Allocator>::containsKey(K key) const
 {
-    int hashValue = hashFunction(key);
+    return find(key) != nullptr;
+}
 
-    // If the bucket position is null, we will return false;
-    if (!table[hashValue])
+template <typename K, typename V, typename Hash, typename Allocator>
+V *HashTable<K, V, Hash, Allocator>::find(const K &key)
+{
+    auto &cell = table[hashFunction(key)];
+
+    // Walks the chain until we find a key that matches
+    for (auto Iter = begin(cell); Iter != end(cell); Iter++)
     {
-        return false;
+        if (Iter->first == key)
+        {
+            return &Iter->second;
+        }
     }
 
-    // If a value exist we must walk the list to check for the
-    // the exact key.
+    return nullptr;
+}
 
-    auto &cell = table[hashValue];
-    auto Iter = begin(cell);
+template <typename K, typename V, typename Hash, typename Allocator>
+const V *HashTable<K, V, Hash, Allocator>::find(const K &key) const
+{
+    auto &cell = table[hashFunction(key)];
 
-    // Walks the list until we find a key that matches
-    while (Iter != end(cell))
+    for (auto Iter = begin(cell); Iter != end(cell); Iter++)
     {
         if (Iter->first == key)
         {
-            return true;
+            return &Iter->second;
         }
     }
 
-    return false;
+    return nullptr;
 }
 
-// Get method is not stable for implementation yet.
-
-// template <typename K, typename V>
-// V HashTable<K, V>::get(K key) const
-// {
-//     int hashValue = hashFunction(key);
-
-//     auto &cell = table[hashValue];
-
-//     auto Iter = begin(cell);
-
-//     bool keyFound = false;
-
-//     K value = nullptr;
-
-//     while (Iter != end(cell))
-//     {
-//         if (Iter->first == key)
-//         {
-//             keyFound = true;
-//             value = Iter->second;
-//         }
-//     }
+template <typename K, typename V, typename Hash, typename Allocator>
+V HashTable<K, V, Hash, Allocator>::get(K key) const
+{
+    const V *value = find(key);
 
-//     if (!keyFound)
-//     {
-//         throw new std::runtime_error("[WARNING]: Trying to retrieve a value that does not exist.");
-//     }
+    if (!value)
+    {
+        throw std::runtime_error("[WARNING]: Trying to retrieve a value that does not exist.");
+    }
 
-//     return value;
-// }
+    return *value;
+}
 
-template <typename K, typename V>
-std::vector<K> HashTable<K, V>::getKeys() const
+template <typename K, typename V, typename Hash, typename Allocator>
+std::vector<K> HashTable<K, V, Hash, Allocator>::getKeys() const
 {
-    // Iterate through the table and insert the keys into this vector.
+    // Iterate through the table and insert the keys into this vector. The
+    // vector is sized once up front instead of growing while it is filled.
     std::vector<K> keysVector;
+    keysVector.reserve(size_);
     for (int i{}; i < buckets; i++)
     {
         if (table[i].size() == 0)
@@ -300,11 +418,13 @@ std::vector<K> HashTable<K, V>::getKeys() const
 
     return keysVector;
 }
-template <typename K, typename V>
-std::vector<V> HashTable<K, V>::getValues() const
+template <typename K, typename V, typename Hash, typename Allocator>
+std::vector<V> HashTable<K, V, Hash, Allocator>::getValues() const
 {
-    // Iterate through the table and insert the keys into this vector.
+    // Iterate through the table and insert the values into this vector. The
+    // vector is sized once up front instead of growing while it is filled.
     std::vector<V> keysVector;
+    keysVector.reserve(size_);
     for (int i{}; i < buckets; i++)
     {
         if (table[i].size() == 0)
@@ -323,8 +443,8 @@ std::vector<V> HashTable<K, V>::getValues() const
     return keysVector;
 }
 
-template <typename K, typename V>
-std::ostream &HashTable<K, V>::print(std::ostream &os) const
+template <typename K, typename V, typename Hash, typename Allocator>
+std::ostream &HashTable<K, V, Hash, Allocator>::print(std::ostream &os) const
 {
     os << "[ \n";
 
@@ -352,4 +472,62 @@ std::ostream &HashTable<K, V>::print(std::ostream &os) const
     os << "]" << endl;
 
     return os;
-}
\ No newline at end of file
+}
+
+template <typename K, typename V, typename Hash, typename Allocator>
+void HashTable<K, V, Hash, Allocator>::serialize(BinaryWriter &writer) const
+{
+    writer.beginObject("HTBL", 1);
+    writer.writeSize(buckets);
+    writer.writeSize(size_);
+    for (const Bucket &cell : table)
+    {
+        for (const pair<K, V> &entry : cell)
+        {
+            writer.write(entry.first);
+            writer.write(entry.second);
+        }
+    }
+}
+
+template <typename K, typename V, typename Hash, typename Allocator>
+void HashTable<K, V, Hash, Allocator>::deserialize(BinaryReader &reader)
+{
+    reader.beginObject("HTBL", 1);
+    size_t bucketCount = reader.readSize();
+    size_t count = reader.readSize();
+    if (bucketCount == 0 || bucketCount > (size_t)INT32_MAX || count > (size_t)INT32_MAX)
+    {
+        throw std::runtime_error("Error: serialized HashTable has an invalid size.");
+    }
+    // Neither size is trusted for the first allocation. A table that grew to
+    // its size has fewer than twice as many buckets as entries, so that keeps
+    // its bucket count, and past 2^16 buckets it grows as the entries actually
+    // arrive.
+    size_t startBuckets = bucketCount < 2 * count ? bucketCount : 2 * count;
+    startBuckets = startBuckets < ((size_t)1 << 16) ? startBuckets : ((size_t)1 << 16);
+    // Decode into a separate table, so a truncated or corrupt stream leaves
+    // this one as it was.
+    HashTable<K, V, Hash, Allocator> fresh((int)(startBuckets > 0 ? startBuckets : 1), hasher_, allocator_);
+    for (size_t i = 0; i < count; i++)
+    {
+        K key;
+        V value;
+        reader.read(key);
+        reader.read(value);
+        V *current = fresh.find(key);
+        if (current)
+        {
+            *current = std::move(value);
+        }
+        else
+        {
+            fresh.table[fresh.hashFunction(key)].emplace_back(std::move(key), std::move(value));
+            fresh.size_++;
+            fresh._growIfNeeded();
+        }
+    }
+    table.swap(fresh.table);
+    std::swap(buckets, fresh.buckets);
+    std::swap(size_, fresh.size_);
+}
@@ -0,0 +1,160 @@
+/**
+ * @file CountMinSketch.h
+ * @author Kofi Boateng
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ *
+ */
+
+#pragma once
+#include <stdexcept>  // for runtime_error
+#include <functional> // for std::hash
+#include <cstdint>    // for fixed width integers
+#include <vector>     // backing array of counters
+#include <cmath>      // for ceil, exp and log
+#include "../HashMixer.h"
+
+// This is an implementation of a Count-Min Sketch, which estimates how many times each key occurred
+// in a stream using a fixed depth x width grid of counters instead of one counter per key. Every key
+// maps to one counter per row; its estimate is the smallest of those counters. Collisions can only
+// add to a counter, so the estimate never under-counts, and with width = e / epsilon and
+// depth = ln(1 / delta) it over-counts by more than epsilon * (total count) with probability at
+// most delta.
+// Updates are conservative: instead of adding the weight to every row, each counter is raised only
+// as far as (current estimate + weight). That leaves counters that were already too high alone and
+// noticeably reduces the over-count on skewed streams.
+// Sketches with the same dimensions merge by adding counters, so shards can count independently and
+// combine their sketches afterwards. (The sum of conservative sketches is still an over-estimate.)
+
+template <typename K, typename Hash = std::hash<K>>
+class CountMinSketch
+{
+private:
+    // Upper bound on the number of rows, so the per-row columns fit on the
+    // stack. 32 rows already gives delta = e^-32.
+    static const int maxDepth = 32;
+
+    int width_;
+    int depth_;
+
+    // Row-major grid of depth_ x width_ counters.
+    std::vector<uint64_t> counters_;
+
+    // Sum of all weights added.
+    uint64_t totalCount_;
+
+    Hash hasher_;
+
+    // Fills columns with the counter column of each row (double hashing).
+    void _columns(const K &key, int *columns) const
+    {
+        uint64_t h1 = mixHash((uint64_t)hasher_(key));
+        uint64_t h2 = mixHash(h1) | 1;
+        for (int row = 0; row < depth_; row++)
+        {
+            columns[row] = (int)((h1 + (uint64_t)row * h2) % (uint64_t)width_);
+        }
+    }
+
+public:
+    // Adds weight occurrences of key using a conservative update.
+    void insert(const K &key, uint64_t weight = 1);
+
+    // Returns the estimated count of key. Never less than the true count.
+    uint64_t estimate(const K &key) const;
+
+    // Adds another sketch's counters into this one. Both must have the same
+    // width and depth (and the same Hash).
+    void merge(const CountMinSketch &other);
+
+    // Returns the total weight inserted.
+    uint64_t totalCount() const { return totalCount_; }
+
+    int width() const { return width_; }
+    int depth() const { return depth_; }
+
+    // Returns the size of the counter grid in bytes.
+    size_t memoryBytes() const { return counters_.size() * sizeof(uint64_t); }
+
+    // Creates a sketch with explicit dimensions.
+    CountMinSketch(int width, int depth, const Hash &hasher = Hash())
+        : width_(width), depth_(depth), totalCount_(0), hasher_(hasher)
+    {
+        if (width < 1 || depth < 1 || depth > maxDepth)
+        {
+            throw std::runtime_error("Error: CountMinSketch needs a positive width and a depth between 1 and 32.");
+        }
+        counters_.assign((size_t)width_ * depth_, 0);
+    }
+
+    // Creates a sketch whose estimates are within epsilon * totalCount() of the
+    // true count with probability 1 - delta.
+    static CountMinSketch withErrorBounds(double epsilon, double delta, const Hash &hasher = Hash())
+    {
+        if (epsilon <= 0 || delta <= 0 || delta >= 1)
+        {
+            throw std::runtime_error("Error: CountMinSketch error bounds must satisfy epsilon > 0 and 0 < delta < 1.");
+        }
+        return CountMinSketch((int)std::ceil(std::exp(1.0) / epsilon), (int)std::ceil(std::log(1.0 / delta)), hasher);
+    }
+};
+
+// ===================================================================================
+// Implementation Section
+// ===================================================================================
+
+template <typename K, typename Hash>
+void CountMinSketch<K, Hash>::insert(const K &key, uint64_t weight)
+{
+    int columns[maxDepth];
+    _columns(key, columns);
+
+    uint64_t current = UINT64_MAX;
+    for (int row = 0; row < depth_; row++)
+    {
+        uint64_t value = counters_[(size_t)row * width_ + columns[row]];
+        current = value < current ? value : current;
+    }
+
+    // Conservative update: raise each counter only up to the new estimate.
+    uint64_t target = current + weight;
+    for (int row = 0; row < depth_; row++)
+    {
+        uint64_t &counter = counters_[(size_t)row * width_ + columns[row]];
+        if (counter < target)
+        {
+            counter = target;
+        }
+    }
+    totalCount_ += weight;
+}
+
+template <typename K, typename Hash>
+uint64_t CountMinSketch<K, Hash>::estimate(const K &key) const
+{
+    int columns[maxDepth];
+    _columns(key, columns);
+
+    uint64_t result = UINT64_MAX;
+    for (int row = 0; row < depth_; row++)
+    {
+        uint64_t value = counters_[(size_t)row * width_ + columns[row]];
+        result = value < result ? value : result;
+    }
+    return result;
+}
+
+template <typename K, typename Hash>
+void CountMinSketch<K, Hash>::merge(const CountMinSketch &other)
+{
+    if (width_ != other.width_ || depth_ != other.depth_)
+    {
+        throw std::runtime_error("Error: Cannot merge CountMinSketches of different dimensions.");
+    }
+    for (size_t i = 0; i < counters_.size(); i++)
+    {
+        counters_[i] += other.counters_[i];
+    }
+    totalCount_ += other.totalCount_;
+}
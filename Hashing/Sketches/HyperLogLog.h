@@ -0,0 +1,283 @@
+/**
+ * @file HyperLogLog.h
+ * @author Kofi Boateng
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ *
+ */
+
+#pragma once
+#include <stdexcept>  // for runtime_error
+#include <functional> // for std::hash
+#include <cstdint>    // for fixed width integers
+#include <vector>     // for the register arrays
+#include <algorithm>  // for sort, max and lower_bound
+#include <cmath>      // for log and ldexp
+#include <iterator>   // for back_inserter
+#include "../HashMixer.h"
+
+// This is an implementation of HyperLogLog, a sketch that estimates the number of distinct keys in
+// a stream using a few kilobytes no matter how many keys there are. Counting distinct users with a
+// HashTable<K, int> needs memory for every user; HyperLogLog with precision p keeps 2^p one-byte
+// registers and has a standard error of about 1.04 / sqrt(2^p) (p = 14 gives 16 KB and ~0.8%).
+// Every key's hash picks a register with its top p bits, and the register remembers the longest
+// run of leading zeros (plus one) seen in the remaining bits. Long runs are rare, so the registers
+// together tell us roughly how many distinct hashes went by.
+// Small sketches start in a sparse encoding: a sorted list of (register, value) pairs packed into
+// 32-bit words, which is much smaller than 2^p bytes while only a few registers are set. The sketch
+// switches to the dense array once the sparse list would outgrow it.
+// Two sketches with the same precision merge by taking the maximum of each register, so every
+// thread or shard can count its own part of the stream and the results can be combined afterwards.
+
+template <typename K, typename Hash = std::hash<K>>
+class HyperLogLog
+{
+private:
+    // Number of index bits; the sketch has 2^precision_ registers.
+    int precision_;
+
+    // Dense registers. Empty while the sketch is sparse.
+    std::vector<uint8_t> registers_;
+
+    // Sparse encoding: sorted, one entry per register, each packed as
+    // (index << 8) | value.
+    std::vector<uint32_t> sparseList_;
+
+    // Unsorted sparse entries that have not been merged into sparseList_ yet.
+    std::vector<uint32_t> sparseBuffer_;
+
+    Hash hasher_;
+
+    bool _isSparse() const { return registers_.empty(); }
+
+    int _registerCount() const { return 1 << precision_; }
+
+    // Sorts the buffer into the sparse list, keeping the largest value per
+    // register, and converts to dense if the list got too big.
+    void _flushSparse();
+
+    // Switches from the sparse encoding to the dense register array.
+    void _toDense();
+
+    // Returns the number of registers set in the sparse list and buffer,
+    // without flushing the buffer.
+    size_t _sparseRegistersSet() const;
+
+    // Splits a hash into a register index and its value.
+    void _indexAndRank(uint64_t hash, uint32_t &index, uint8_t &rank) const;
+
+public:
+    // Records one occurrence of key.
+    void insert(const K &key);
+
+    // Returns the estimated number of distinct keys inserted.
+    double estimate() const;
+
+    // Folds another sketch into this one. Both must have the same precision.
+    void merge(const HyperLogLog &other);
+
+    // Returns the precision of the sketch.
+    int precision() const { return precision_; }
+
+    // Returns whether the sketch is still in the sparse encoding.
+    bool isSparse() const { return _isSparse(); }
+
+    // Returns the approximate memory used by the registers, in bytes.
+    size_t memoryBytes() const
+    {
+        return registers_.size() + (sparseList_.size() + sparseBuffer_.size()) * sizeof(uint32_t);
+    }
+
+    // Creates an empty sketch with 2^precision registers. precision must be
+    // between 4 and 18.
+    explicit HyperLogLog(int precision = 14, const Hash &hasher = Hash()) : precision_(precision), hasher_(hasher)
+    {
+        if (precision < 4 || precision > 18)
+        {
+            throw std::runtime_error("Error: HyperLogLog precision must be between 4 and 18.");
+        }
+    }
+};
+
+// ===================================================================================
+// Implementation Section
+// ===================================================================================
+
+template <typename K, typename Hash>
+void HyperLogLog<K, Hash>::_indexAndRank(uint64_t hash, uint32_t &index, uint8_t &rank) const
+{
+    index = (uint32_t)(hash >> (64 - precision_));
+    // Shift the index bits out and set a guard bit so the count of leading
+    // zeros is at most 64 - precision_.
+    uint64_t rest = (hash << precision_) | (1ULL << (precision_ - 1));
+    rank = (uint8_t)(__builtin_clzll(rest) + 1);
+}
+
+template <typename K, typename Hash>
+void HyperLogLog<K, Hash>::_flushSparse()
+{
+    if (sparseBuffer_.empty())
+    {
+        return;
+    }
+
+    std::vector<uint32_t> merged;
+    merged.reserve(sparseList_.size() + sparseBuffer_.size());
+    std::sort(sparseBuffer_.begin(), sparseBuffer_.end());
+    std::merge(sparseList_.begin(), sparseList_.end(), sparseBuffer_.begin(), sparseBuffer_.end(), std::back_inserter(merged));
+    sparseBuffer_.clear();
+
+    // Entries are sorted by index first and value second, so the last entry
+    // for each index holds the largest value.
+    sparseList_.clear();
+    for (size_t i = 0; i < merged.size(); i++)
+    {
+        if (i + 1 < merged.size() && (merged[i] >> 8) == (merged[i + 1] >> 8))
+        {
+            continue;
+        }
+        sparseList_.push_back(merged[i]);
+    }
+
+    // Four bytes per sparse entry against one byte per dense register.
+    if (sparseList_.size() * sizeof(uint32_t) > (size_t)_registerCount())
+    {
+        _toDense();
+    }
+}
+
+template <typename K, typename Hash>
+void HyperLogLog<K, Hash>::_toDense()
+{
+    registers_.assign(_registerCount(), 0);
+    for (uint32_t entry : sparseList_)
+    {
+        registers_[entry >> 8] = std::max(registers_[entry >> 8], (uint8_t)(entry & 0xFF));
+    }
+    for (uint32_t entry : sparseBuffer_)
+    {
+        registers_[entry >> 8] = std::max(registers_[entry >> 8], (uint8_t)(entry & 0xFF));
+    }
+    std::vector<uint32_t>().swap(sparseList_);
+    std::vector<uint32_t>().swap(sparseBuffer_);
+}
+
+template <typename K, typename Hash>
+size_t HyperLogLog<K, Hash>::_sparseRegistersSet() const
+{
+    std::vector<uint32_t> pending;
+    pending.reserve(sparseBuffer_.size());
+    for (uint32_t entry : sparseBuffer_)
+    {
+        pending.push_back(entry >> 8);
+    }
+    std::sort(pending.begin(), pending.end());
+    pending.erase(std::unique(pending.begin(), pending.end()), pending.end());
+
+    // sparseList_ is sorted by index, so each buffered register is looked up
+    // by the smallest entry it could have.
+    size_t count = sparseList_.size();
+    for (uint32_t index : pending)
+    {
+        auto found = std::lower_bound(sparseList_.begin(), sparseList_.end(), index << 8);
+        if (found == sparseList_.end() || (*found >> 8) != index)
+        {
+            count++;
+        }
+    }
+    return count;
+}
+
+template <typename K, typename Hash>
+void HyperLogLog<K, Hash>::insert(const K &key)
+{
+    uint32_t index;
+    uint8_t rank;
+    _indexAndRank(mixHash((uint64_t)hasher_(key)), index, rank);
+
+    if (!_isSparse())
+    {
+        if (rank > registers_[index])
+        {
+            registers_[index] = rank;
+        }
+        return;
+    }
+
+    sparseBuffer_.push_back((index << 8) | rank);
+    if (sparseBuffer_.size() * sizeof(uint32_t) * 8 > (size_t)_registerCount())
+    {
+        _flushSparse();
+    }
+}
+
+template <typename K, typename Hash>
+double HyperLogLog<K, Hash>::estimate() const
+{
+    double m = (double)_registerCount();
+
+    if (_isSparse())
+    {
+        // Few registers are set, which is exactly where linear counting on the
+        // number of empty registers is the accurate estimator.
+        double zeros = m - (double)_sparseRegistersSet();
+        return zeros > 0 ? m * std::log(m / zeros) : m;
+    }
+
+    double alpha = m == 16 ? 0.673 : (m == 32 ? 0.697 : (m == 64 ? 0.709 : 0.7213 / (1.0 + 1.079 / m)));
+    double sum = 0.0;
+    int zeros = 0;
+    for (uint8_t value : registers_)
+    {
+        sum += std::ldexp(1.0, -value);
+        zeros += value == 0;
+    }
+
+    double raw = alpha * m * m / sum;
+    if (raw <= 2.5 * m && zeros > 0)
+    {
+        return m * std::log(m / (double)zeros);
+    }
+    return raw;
+}
+
+template <typename K, typename Hash>
+void HyperLogLog<K, Hash>::merge(const HyperLogLog &other)
+{
+    if (precision_ != other.precision_)
+    {
+        throw std::runtime_error("Error: Cannot merge HyperLogLog sketches of different precision.");
+    }
+
+    if (_isSparse() && other._isSparse())
+    {
+        sparseBuffer_.insert(sparseBuffer_.end(), other.sparseList_.begin(), other.sparseList_.end());
+        sparseBuffer_.insert(sparseBuffer_.end(), other.sparseBuffer_.begin(), other.sparseBuffer_.end());
+        _flushSparse();
+        return;
+    }
+
+    if (_isSparse())
+    {
+        _toDense();
+    }
+
+    if (other._isSparse())
+    {
+        for (uint32_t entry : other.sparseList_)
+        {
+            registers_[entry >> 8] = std::max(registers_[entry >> 8], (uint8_t)(entry & 0xFF));
+        }
+        for (uint32_t entry : other.sparseBuffer_)
+        {
+            registers_[entry >> 8] = std::max(registers_[entry >> 8], (uint8_t)(entry & 0xFF));
+        }
+        return;
+    }
+
+    for (size_t i = 0; i < registers_.size(); i++)
+    {
+        registers_[i] = std::max(registers_[i], other.registers_[i]);
+    }
+}
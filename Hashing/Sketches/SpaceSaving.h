@@ -0,0 +1,276 @@
+/**
+ * @file SpaceSaving.h
+ * @author Kofi Boateng
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ *
+ */
+
+#pragma once
+#include <stdexcept>  // for runtime_error
+#include <functional> // for std::hash
+#include <vector>     // for returning the heavy hitters
+#include <algorithm>  // for sort
+#include "../SeparateChainingHashTable/SeparateChainingHashTable.h"
+#include "../../Heap/PriorityQueue.h"
+
+// This is an implementation of the SpaceSaving heavy-hitters algorithm. It monitors at most k keys
+// with a counter each. A monitored key just has its counter incremented. An unmonitored key takes
+// over the counter of the monitored key with the smallest count, inheriting that count as its
+// possible over-estimate ("error"). Any key that occurs more than (total count) / k times is
+// guaranteed to be monitored, and each reported count is at most error too high.
+// The counters live in a HashTable and the smallest one is found with a PriorityQueueADT (a min
+// heap). The heap does not support changing a key's priority, so instead every new count is pushed
+// as a new heap entry and outdated entries are skipped when they reach the top ("lazy deletion").
+// When stale entries pile up the heap is rebuilt from the table, which keeps it at O(k) entries and
+// every update at amortized O(log k).
+// Two summaries merge by adding their counters, treating a key missing from a full summary as
+// having that summary's minimum count, and then keeping the k largest. The result keeps the same
+// guarantee for the combined stream, so shards can be summarized independently.
+
+template <typename K, typename Hash = std::hash<K>>
+class SpaceSaving
+{
+public:
+    // A monitored key with its estimated count. The true count lies in
+    // [count - error, count].
+    struct HeavyHitter
+    {
+        K key;
+        long long count;
+        long long error;
+    };
+
+private:
+    // The value stored per monitored key.
+    struct Counter
+    {
+        long long count;
+        long long error;
+    };
+
+    // A heap entry: a snapshot of a key's count when it was pushed. Ordered by
+    // count only, so K does not have to be comparable.
+    struct HeapEntry
+    {
+        long long count;
+        K key;
+
+        bool operator<(const HeapEntry &other) const { return count < other.count; }
+    };
+
+    // Maximum number of monitored keys.
+    int capacity_;
+
+    // Sum of all weights offered.
+    long long totalCount_;
+
+    HashTable<K, Counter, Hash> counters_;
+    PriorityQueueADT<HeapEntry> heap_;
+
+    // Pushes the current count of key onto the heap, rebuilding the heap first
+    // if stale entries outnumber the live ones.
+    void _push(const K &key, long long count);
+
+    // Rebuilds the heap with exactly one entry per monitored key.
+    void _rebuildHeap();
+
+    // Pops stale entries until the heap top is the live minimum counter.
+    void _settleMinimum();
+
+public:
+    // Records weight occurrences of key.
+    void offer(const K &key, long long weight = 1);
+
+    // Returns the estimated count of key, or 0 if it is not monitored.
+    long long estimate(const K &key) const;
+
+    // Returns up to n monitored keys ordered from most to least frequent.
+    std::vector<HeavyHitter> topK(int n) const;
+
+    // Folds another summary into this one. Both must have the same capacity.
+    void merge(const SpaceSaving &other);
+
+    // Returns the smallest monitored count, or 0 while there is a free counter.
+    long long minimumCount();
+
+    // Returns the number of monitored keys.
+    int size() const { return counters_.size(); }
+
+    // Returns the maximum number of monitored keys.
+    int capacity() const { return capacity_; }
+
+    // Returns the sum of all weights offered.
+    long long totalCount() const { return totalCount_; }
+
+    // Creates a summary that monitors at most k keys.
+    explicit SpaceSaving(int k) : capacity_(k), totalCount_(0), counters_(k)
+    {
+        if (k < 1)
+        {
+            throw std::runtime_error("Error: SpaceSaving needs room for at least one key.");
+        }
+    }
+};
+
+// ===================================================================================
+// Implementation Section
+// ===================================================================================
+
+template <typename K, typename Hash>
+void SpaceSaving<K, Hash>::_rebuildHeap()
+{
+    heap_ = PriorityQueueADT<HeapEntry>();
+    for (const K &key : counters_.getKeys())
+    {
+        heap_.insert(HeapEntry{counters_.find(key)->count, key});
+    }
+}
+
+template <typename K, typename Hash>
+void SpaceSaving<K, Hash>::_push(const K &key, long long count)
+{
+    if (heap_.size() > 4 * capacity_)
+    {
+        _rebuildHeap();
+        return;
+    }
+    heap_.insert(HeapEntry{count, key});
+}
+
+template <typename K, typename Hash>
+void SpaceSaving<K, Hash>::_settleMinimum()
+{
+    while (!heap_.isEmpty())
+    {
+        HeapEntry top = heap_.peek();
+        const Counter *live = counters_.find(top.key);
+        if (live && live->count == top.count)
+        {
+            return;
+        }
+        heap_.removeMin();
+    }
+}
+
+template <typename K, typename Hash>
+long long SpaceSaving<K, Hash>::minimumCount()
+{
+    if (counters_.size() < capacity_)
+    {
+        return 0;
+    }
+    _settleMinimum();
+    return heap_.peek().count;
+}
+
+template <typename K, typename Hash>
+void SpaceSaving<K, Hash>::offer(const K &key, long long weight)
+{
+    totalCount_ += weight;
+
+    Counter *counter = counters_.find(key);
+    if (counter)
+    {
+        counter->count += weight;
+        _push(key, counter->count);
+        return;
+    }
+
+    if (counters_.size() < capacity_)
+    {
+        counters_.add(key, Counter{weight, 0});
+        _push(key, weight);
+        return;
+    }
+
+    // Replace the key with the smallest count; the new key inherits that
+    // count as its error bound.
+    _settleMinimum();
+    HeapEntry victim = heap_.peek();
+    heap_.removeMin();
+    counters_.remove(victim.key);
+    counters_.add(key, Counter{victim.count + weight, victim.count});
+    _push(key, victim.count + weight);
+}
+
+template <typename K, typename Hash>
+long long SpaceSaving<K, Hash>::estimate(const K &key) const
+{
+    const Counter *counter = counters_.find(key);
+    return counter ? counter->count : 0;
+}
+
+template <typename K, typename Hash>
+std::vector<typename SpaceSaving<K, Hash>::HeavyHitter> SpaceSaving<K, Hash>::topK(int n) const
+{
+    std::vector<HeavyHitter> result;
+    for (const K &key : counters_.getKeys())
+    {
+        const Counter *counter = counters_.find(key);
+        result.push_back(HeavyHitter{key, counter->count, counter->error});
+    }
+    std::sort(result.begin(), result.end(), [](const HeavyHitter &a, const HeavyHitter &b)
+              { return a.count > b.count; });
+    if ((int)result.size() > n)
+    {
+        result.resize(n);
+    }
+    return result;
+}
+
+template <typename K, typename Hash>
+void SpaceSaving<K, Hash>::merge(const SpaceSaving &other)
+{
+    if (capacity_ != other.capacity_)
+    {
+        throw std::runtime_error("Error: Cannot merge SpaceSaving summaries of different capacity.");
+    }
+
+    // A key missing from a full summary may still have occurred up to that
+    // summary's minimum count times.
+    long long thisMinimum = minimumCount();
+    long long otherMinimum = other.counters_.size() < other.capacity_ ? 0 : other.topK(other.capacity_).back().count;
+
+    HashTable<K, Counter, Hash> merged(2 * capacity_);
+    for (const K &key : counters_.getKeys())
+    {
+        const Counter *mine = counters_.find(key);
+        const Counter *theirs = other.counters_.find(key);
+        Counter sum = theirs ? Counter{mine->count + theirs->count, mine->error + theirs->error}
+                             : Counter{mine->count + otherMinimum, mine->error + otherMinimum};
+        merged.add(key, sum);
+    }
+    for (const K &key : other.counters_.getKeys())
+    {
+        if (counters_.find(key))
+        {
+            continue;
+        }
+        const Counter *theirs = other.counters_.find(key);
+        merged.add(key, Counter{theirs->count + thisMinimum, theirs->error + thisMinimum});
+    }
+
+    // Keep the capacity_ largest counters.
+    std::vector<HeavyHitter> candidates;
+    for (const K &key : merged.getKeys())
+    {
+        const Counter *counter = merged.find(key);
+        candidates.push_back(HeavyHitter{key, counter->count, counter->error});
+    }
+    std::sort(candidates.begin(), candidates.end(), [](const HeavyHitter &a, const HeavyHitter &b)
+              { return a.count > b.count; });
+    if ((int)candidates.size() > capacity_)
+    {
+        candidates.resize(capacity_);
+    }
+
+    counters_ = HashTable<K, Counter, Hash>(capacity_);
+    for (const HeavyHitter &hitter : candidates)
+    {
+        counters_.add(hitter.key, Counter{hitter.count, hitter.error});
+    }
+    totalCount_ += other.totalCount_;
+    _rebuildHeap();
+}
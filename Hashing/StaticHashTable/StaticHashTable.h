@@ -0,0 +1,194 @@
+/**
+ * @file StaticHashTable.h
+ * @author Kofi Boateng
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ *
+ */
+
+#pragma once
+#include <stdexcept>   // for runtime_error
+#include <cstddef>     // for size_t
+#include <cstdint>     // for uint64_t
+#include <functional>  // for std::hash, the fallback hashing policy
+#include <type_traits> // for is_integral and is_enum
+#include "../HashMixer.h"
+
+// StaticHash is the default hashing policy for StaticHashTable. std::hash is not constexpr, so integral
+// and enum keys are hashed with mixHash instead, which works in constant expressions; any other key
+// falls back to std::hash and can then only be used at run time.
+template <typename K>
+struct StaticHash
+{
+    constexpr size_t operator()(const K &key) const
+    {
+        if constexpr (std::is_integral<K>::value || std::is_enum<K>::value)
+        {
+            return (size_t)mixHash((uint64_t)key);
+        }
+        else
+        {
+            return std::hash<K>()(key);
+        }
+    }
+};
+
+// This is an implementation of a fixed-capacity Hash Table for lookups whose size is known at compile
+// time. Unlike HashTable, which keeps a linked list per bucket, the N slots are one array inside the
+// object and collisions are resolved by linear probing, so nothing is ever allocated and a lookup scans
+// neighbouring slots in the same cache lines. N must be a power of two so that the home slot is the hash
+// masked to its low bits.
+// Every member function is constexpr, so a table can be filled while the compiler evaluates a constant
+// expression and used as a lookup table that costs nothing at startup, e.g.
+//     constexpr auto table = []() { StaticHashTable<int, int, 64> t; t.insert(7, 49); return t; }();
+//     static_assert(table.get(7) == 49);
+// Removal shifts the following entries of the probe run back instead of leaving tombstones, so lookups
+// never slow down after many removals. Inserting into a full table throws; the table stays fast until
+// it is around three quarters full, so N should leave some headroom.
+// K and V must be default constructible, since the array holds N slots from the start.
+
+template <typename K, typename V, size_t N, typename Hash = StaticHash<K>>
+class StaticHashTable
+{
+    static_assert(N > 0 && (N & (N - 1)) == 0, "StaticHashTable capacity must be a power of two.");
+
+private:
+    static constexpr size_t mask_ = N - 1;
+
+    K keys_[N]{};
+    V values_[N]{};
+    bool used_[N]{};
+    size_t size_ = 0;
+    Hash hasher_{};
+
+    constexpr size_t _home(const K &key) const { return hasher_(key) & mask_; }
+
+    // Returns the slot holding key, or N if the key does not exist.
+    constexpr size_t _findSlot(const K &key) const;
+
+public:
+    // Inserts the pair, or replaces the value if the key already exists.
+    constexpr void insert(const K &key, const V &value);
+
+    // Removes the key and returns true, or returns false if it does not exist.
+    constexpr bool remove(const K &key);
+
+    // Searches the table for the key and returns true if it is available.
+    constexpr bool containsKey(const K &key) const { return _findSlot(key) != N; }
+
+    // Return the value associated with the given key.
+    constexpr const V &get(const K &key) const
+    {
+        size_t slot = _findSlot(key);
+        if (slot == N)
+        {
+            throw std::runtime_error("[WARNING]: Trying to retrieve a value that does not exist.");
+        }
+        return values_[slot];
+    }
+
+    // Returns a pointer to the value associated with the given key, or nullptr
+    // if the key does not exist.
+    constexpr V *find(const K &key)
+    {
+        size_t slot = _findSlot(key);
+        return slot == N ? nullptr : &values_[slot];
+    }
+
+    constexpr const V *find(const K &key) const
+    {
+        size_t slot = _findSlot(key);
+        return slot == N ? nullptr : &values_[slot];
+    }
+
+    constexpr size_t size() const { return size_; }
+    static constexpr size_t capacity() { return N; }
+    constexpr bool isEmpty() const { return size_ == 0; }
+
+    // Removes every pair.
+    constexpr void clear()
+    {
+        for (size_t i = 0; i < N; i++)
+        {
+            used_[i] = false;
+        }
+        size_ = 0;
+    }
+
+    constexpr StaticHashTable() = default;
+    constexpr explicit StaticHashTable(const Hash &hasher) : hasher_(hasher) {}
+};
+
+// ===================================================================================
+// Implementation Section
+// ===================================================================================
+
+template <typename K, typename V, size_t N, typename Hash>
+constexpr size_t StaticHashTable<K, V, N, Hash>::_findSlot(const K &key) const
+{
+    size_t slot = _home(key);
+    for (size_t probes = 0; probes < N && used_[slot]; probes++)
+    {
+        if (keys_[slot] == key)
+        {
+            return slot;
+        }
+        slot = (slot + 1) & mask_;
+    }
+    return N;
+}
+
+template <typename K, typename V, size_t N, typename Hash>
+constexpr void StaticHashTable<K, V, N, Hash>::insert(const K &key, const V &value)
+{
+    size_t slot = _home(key);
+    for (size_t probes = 0; probes < N; probes++)
+    {
+        if (!used_[slot])
+        {
+            keys_[slot] = key;
+            values_[slot] = value;
+            used_[slot] = true;
+            size_++;
+            return;
+        }
+        if (keys_[slot] == key)
+        {
+            values_[slot] = value;
+            return;
+        }
+        slot = (slot + 1) & mask_;
+    }
+    throw std::runtime_error("Error: insert() called on a full StaticHashTable.");
+}
+
+template <typename K, typename V, size_t N, typename Hash>
+constexpr bool StaticHashTable<K, V, N, Hash>::remove(const K &key)
+{
+    size_t hole = _findSlot(key);
+    if (hole == N)
+    {
+        return false;
+    }
+    used_[hole] = false;
+    size_--;
+    // Walk the rest of the probe run and move back every entry whose home
+    // slot does not lie in the cyclic range (hole, slot], so that no lookup
+    // stops early at the new hole.
+    size_t slot = (hole + 1) & mask_;
+    while (used_[slot])
+    {
+        size_t home = _home(keys_[slot]);
+        if (((slot - home) & mask_) >= ((slot - hole) & mask_))
+        {
+            keys_[hole] = keys_[slot];
+            values_[hole] = values_[slot];
+            used_[hole] = true;
+            used_[slot] = false;
+            hole = slot;
+        }
+        slot = (slot + 1) & mask_;
+    }
+    return true;
+}
@@ -0,0 +1,186 @@
+/**
+ * @file BucketQueue.h
+ * @author Kofi Boateng
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ *
+ */
+
+#pragma once
+#include <stdexcept> // for runtime_error
+#include <cstddef>   // for size_t
+#include <cstdint>   // for the non-empty bitmap
+#include <map>       // buckets beyond the window
+#include <utility>   // for move
+#include <vector>    // array of buckets
+
+// This is an implementation of a Bucket Queue, a priority queue for small integer priorities. Instead
+// of a heap ordered by comparisons, it keeps one array (bucket) per priority, so insert is O(1) and
+// finding the minimum only walks forward from the last bucket that was taken. That walk is cheap when
+// priorities are monotone, which is the case in delta-stepping (see Graph/GraphAnalytics.h) and other
+// label-setting algorithms, where nothing smaller than the current bucket is ever inserted again.
+// Unlike PriorityQueueADT, items come out a whole bucket at a time with takeBucket(), which is what a
+// parallel algorithm wants: one bucket is the set of items that can be processed together.
+// Inserting below the current bucket is an error. Bucket arrays keep their memory after they are taken
+// so that steady-state use does not allocate.
+// Only a window of buckets starting at the current one is stored as an array, used cyclically: the slot
+// of a bucket that was taken is reused by the bucket a window further on. A bitmap marks the non-empty
+// slots, so minPriority() skips 64 empty buckets per word. Items beyond the window wait in a sparse map
+// of buckets and move into the array as the window reaches them, so memory follows the number of items
+// and not the largest priority. Delta-stepping sizes the window to cover the heaviest edge, so every
+// insert lands in the array.
+
+template <typename T>
+class BucketQueue
+{
+private:
+    // The window: bucket p (current_ <= p < current_ + window) is slot p & mask_.
+    std::vector<std::vector<T>> buckets_;
+    std::vector<uint64_t> nonEmpty_;
+    size_t mask_;
+
+    // Buckets at or beyond current_ + window, by priority.
+    std::map<size_t, std::vector<T>> far_;
+
+    // Every bucket below this one is empty.
+    size_t current_;
+
+    // Number of items across all buckets.
+    size_t size_;
+
+    size_t _window() const { return buckets_.size(); }
+
+    // Returns true if priority falls inside the window.
+    bool _inWindow(size_t priority) const { return priority - current_ < _window(); }
+
+    void _markNonEmpty(size_t slot) { nonEmpty_[slot / 64] |= (uint64_t)1 << (slot % 64); }
+
+    // Moves the current bucket to priority and pulls the far buckets the
+    // window now reaches into their slots.
+    void _advance(size_t priority)
+    {
+        current_ = priority;
+        while (!far_.empty() && _inWindow(far_.begin()->first))
+        {
+            size_t slot = far_.begin()->first & mask_;
+            std::vector<T> &bucket = far_.begin()->second;
+            if (buckets_[slot].empty())
+            {
+                buckets_[slot].swap(bucket);
+            }
+            else
+            {
+                buckets_[slot].insert(buckets_[slot].end(), bucket.begin(), bucket.end());
+            }
+            _markNonEmpty(slot);
+            far_.erase(far_.begin());
+        }
+    }
+
+public:
+    // Adds item with the given priority. Throws if priority is below the
+    // bucket that was last taken.
+    void insert(size_t priority, const T &item)
+    {
+        if (priority < current_)
+        {
+            throw std::runtime_error("Error: BucketQueue priorities must not go below the current bucket.");
+        }
+        if (_inWindow(priority))
+        {
+            size_t slot = priority & mask_;
+            buckets_[slot].push_back(item);
+            _markNonEmpty(slot);
+        }
+        else
+        {
+            far_[priority].push_back(item);
+        }
+        size_++;
+    }
+
+    // Returns the smallest non-empty priority, or size_t(-1) if the queue is
+    // empty. This does not move the current bucket, so smaller priorities can
+    // still be inserted until that bucket is taken.
+    size_t minPriority() const
+    {
+        // Walk the bitmap from the current slot once around the window.
+        size_t start = current_ & mask_;
+        size_t words = nonEmpty_.size();
+        for (size_t i = 0; i <= words; i++)
+        {
+            size_t word = (start / 64 + i) % words;
+            uint64_t bits = nonEmpty_[word];
+            if (i == 0)
+            {
+                bits &= ~(uint64_t)0 << (start % 64);
+            }
+            else if (i == words)
+            {
+                bits &= start % 64 == 0 ? 0 : ~(~(uint64_t)0 << (start % 64));
+            }
+            if (bits)
+            {
+                size_t slot = word * 64 + (size_t)__builtin_ctzll(bits);
+                return current_ + ((slot - start) & mask_);
+            }
+        }
+        return far_.empty() ? (size_t)-1 : far_.begin()->first;
+    }
+
+    // Returns the size of a bucket without taking it.
+    size_t bucketSize(size_t priority) const
+    {
+        if (priority < current_)
+        {
+            return 0;
+        }
+        if (_inWindow(priority))
+        {
+            return buckets_[priority & mask_].size();
+        }
+        typename std::map<size_t, std::vector<T>>::const_iterator far = far_.find(priority);
+        return far == far_.end() ? 0 : far->second.size();
+    }
+
+    // Appends every item of the given bucket to out and empties the bucket.
+    // Items of lower buckets must already have been taken.
+    void takeBucket(size_t priority, std::vector<T> &out)
+    {
+        if (priority < current_)
+        {
+            return;
+        }
+        if (priority > current_)
+        {
+            _advance(priority);
+        }
+        size_t slot = priority & mask_;
+        std::vector<T> &bucket = buckets_[slot];
+        out.insert(out.end(), bucket.begin(), bucket.end());
+        size_ -= bucket.size();
+        bucket.clear();
+        nonEmpty_[slot / 64] &= ~((uint64_t)1 << (slot % 64));
+    }
+
+    // Returns a boolean signifying if the queue is empty or not.
+    bool isEmpty() const { return size_ == 0; }
+
+    // Returns the number of items in the queue.
+    size_t size() const { return size_; }
+
+    // Creates a queue that keeps at least window buckets, starting at the
+    // current one, in its array (rounded up to a power of two, at least 64).
+    explicit BucketQueue(size_t window = 1024) : mask_(0), current_(0), size_(0)
+    {
+        size_t slots = 64;
+        while (slots < window)
+        {
+            slots <<= 1;
+        }
+        buckets_.resize(slots);
+        nonEmpty_.assign(slots / 64, 0);
+        mask_ = slots - 1;
+    }
+};
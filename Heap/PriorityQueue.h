@@ -11,17 +11,33 @@
 #include <iostream>  // for cout & cerr
 #include <stdexcept> // for runtime_error
 #include <ostream>   // for::ostream
+#include <functional> // for std::less, the default ordering
+#include <cstring>    // for memcpy
+#include <memory>     // for uninitialized_copy, uninitialized_move and destroy
+#include <new>        // for operator new and placement new
+#include <type_traits> // for is_trivially_copyable
+#include <utility>    // for move and swap
+#include "../Serialization/BinaryStream.h"
 
 // This is an implementation of the PriorityQueue Abstract Data Type. The underlying data structure
 // that this API will interact with is a minimum heap. This API will allow the end user to retrieve
 // The smallest element in constant time (O(1)) and insert elements to be ordered in logarithmic time (O(n*log(n))).
+// The ordering is set by Compare, which defaults to std::less<T> (operator<). "Minimum" always means the
+// first element according to Compare, so PriorityQueueADT<T, std::greater<T>> is a max heap whose
+// peek() returns the largest element.
+// The array is raw storage: only the slots that hold elements are constructed, so T needs no default
+// constructor and a removed element is destroyed as soon as it leaves the heap.
 
-template <typename T>
+template <typename T, typename Compare = std::less<T>>
 class PriorityQueueADT
 {
 
 private:
-    // Pointer to the Min Heap.
+    // Ordering of the heap; compare_(a, b) means a comes out before b.
+    Compare compare_;
+
+    // Pointer to the Min Heap. Slots 1 to size_ hold constructed elements;
+    // slot 0 and the slots past size_ are uninitialized.
     T *minHeap;
 
     // Size of actual data stored within the heap.
@@ -52,6 +68,60 @@ private:
     // Empties out the array.
     void _clear();
 
+    // Returns uninitialized storage for capacity slots.
+    static T *_allocate(int capacity) { return static_cast<T *>(::operator new((size_t)capacity * sizeof(T))); }
+
+    // Copy-constructs the heap slots [1, count] of source into the uninitialized
+    // slots of destination. Trivially copyable types are copied with one memcpy
+    // instead of element by element.
+    static void _copySlots(T *destination, const T *source, int count)
+    {
+        if constexpr (std::is_trivially_copyable<T>::value)
+        {
+            if (count > 0)
+            {
+                std::memcpy(destination + 1, source + 1, (size_t)count * sizeof(T));
+            }
+        }
+        else
+        {
+            std::uninitialized_copy(source + 1, source + 1 + count, destination + 1);
+        }
+    }
+
+    // Moves the heap slots [1, count] of source into the uninitialized slots of
+    // destination and destroys them in source. Elements are copied instead when
+    // their move constructor may throw and they can be copied, so a throw leaves
+    // source as it was.
+    static void _relocateSlots(T *destination, T *source, int count)
+    {
+        if constexpr (std::is_trivially_copyable<T>::value)
+        {
+            _copySlots(destination, source, count);
+        }
+        else
+        {
+            if constexpr (std::is_nothrow_move_constructible<T>::value || !std::is_copy_constructible<T>::value)
+            {
+                std::uninitialized_move(source + 1, source + 1 + count, destination + 1);
+            }
+            else
+            {
+                std::uninitialized_copy(source + 1, source + 1 + count, destination + 1);
+            }
+            std::destroy(source + 1, source + 1 + count);
+        }
+    }
+
+    // Exchanges the contents of the two queues.
+    void _swap(PriorityQueueADT<T, Compare> &other)
+    {
+        std::swap(compare_, other.compare_);
+        std::swap(minHeap, other.minHeap);
+        std::swap(size_, other.size_);
+        std::swap(capacity_, other.capacity_);
+    }
+
 public:
     // Inserts an element in the heap.
     void insert(const T &element);
@@ -80,62 +150,109 @@ public:
     // Outputs the cotnents of the heap into a string format.
     std::ostream &print(std::ostream &os) const;
 
-    PriorityQueueADT() : minHeap(new T[8]), size_(0), capacity_(8) {}
+    // Writes the heap array to writer (Refer to Serialization/BinaryStream.h).
+    // The ordering is not stored, so read it back into a queue with the same Compare.
+    void serialize(BinaryWriter &writer) const;
+    // Replaces the contents of the queue with one read from reader.
+    void deserialize(BinaryReader &reader);
+
+    explicit PriorityQueueADT(const Compare &compare = Compare()) : compare_(compare), minHeap(_allocate(8)), size_(0), capacity_(8) {}
+
+    // The copy constructor allocates its own array and copies the heap into it,
+    // so that both queues can be destroyed independently.
+    PriorityQueueADT(const PriorityQueueADT<T, Compare> &other) : compare_(other.compare_), minHeap(_allocate(other.capacity_)), size_(0), capacity_(other.capacity_)
+    {
+        try
+        {
+            _copySlots(minHeap, other.minHeap, other.size_);
+        }
+        catch (...)
+        {
+            ::operator delete(minHeap);
+            throw;
+        }
+        size_ = other.size_;
+    }
 
-    PriorityQueueADT(const PriorityQueueADT<T> &other) : minHeap(other.minHeap), size_(other.size_), capacity_(other.capacity_) {}
+    // The copy assignment operator replaces this heap with a copy of the other one.
+    // If copying an element throws, this heap is left as it was.
+    PriorityQueueADT<T, Compare> &operator=(const PriorityQueueADT<T, Compare> &other)
+    {
+        if (this == &other)
+        {
+            return *this;
+        }
+        PriorityQueueADT<T, Compare> copy(other);
+        _swap(copy);
+        return *this;
+    }
 
     ~PriorityQueueADT()
     {
-        delete[] minHeap;
+        _clear();
+        ::operator delete(minHeap);
     }
 };
 // ======================================================================================================================================
 // Implementation Section
 // ======================================================================================================================================
 
-template <typename T>
-void PriorityQueueADT<T>::_increaseCapacity()
+template <typename T, typename Compare>
+void PriorityQueueADT<T, Compare>::_increaseCapacity()
 {
     // Double the capacity of the area and initial a working copy.
     int newSize = capacity_ * 2;
-    T *copyArray = new T[newSize];
+    T *copyArray = _allocate(newSize);
 
-    // Copies over all elements into their correct spots
-    for (int i = 1; i < size_; i++)
+    // Moves over all elements into their correct spots
+    try
     {
-        copyArray[i] = minHeap[i];
+        _relocateSlots(copyArray, minHeap, size_);
+    }
+    catch (...)
+    {
+        ::operator delete(copyArray);
+        throw;
     }
     T *oldHeap = minHeap;
     // Set the new min heap.
     minHeap = copyArray;
+    capacity_ = newSize;
+
+    ::operator delete(oldHeap);
+}
 
-    delete[] oldHeap;
+template <typename T, typename Compare>
+void PriorityQueueADT<T, Compare>::_clear()
+{
+    std::destroy(minHeap + 1, minHeap + 1 + size_);
+    size_ = 0;
 }
 
-template <typename T>
-bool PriorityQueueADT<T>::_isLeaf(const int &index) const
+template <typename T, typename Compare>
+bool PriorityQueueADT<T, Compare>::_isLeaf(const int &index) const
 {
-    return index == size_ || index == size_ - 1;
+    // A node is a leaf once its left child would fall outside the heap.
+    return index * 2 > size_;
 }
 
-template <class T>
-int PriorityQueueADT<T>::_minChild(const int &index)
+template <typename T, typename Compare>
+int PriorityQueueADT<T, Compare>::_minChild(const int &index)
 {
-    T leftChild = minHeap[index * 2];
-    T rightChild = minHeap[index * 2 + 1];
-    if (leftChild < rightChild)
+    // A node with only a left child has that child as its minimum.
+    if (index * 2 + 1 > size_ || compare_(minHeap[index * 2], minHeap[index * 2 + 1]))
     {
         return index * 2;
     }
     return index * 2 + 1;
 }
 
-template <typename T>
-void PriorityQueueADT<T>::_heapifyUp(const int &index)
+template <typename T, typename Compare>
+void PriorityQueueADT<T, Compare>::_heapifyUp(const int &index)
 {
     if (index > 1)
     {
-        if (minHeap[index] < minHeap[index - 1])
+        if (compare_(minHeap[index], minHeap[index / 2]))
         {
             std::swap(minHeap[index], minHeap[index / 2]);
             _heapifyUp(index / 2);
@@ -143,13 +260,13 @@ void PriorityQueueADT<T>::_heapifyUp(const int &index)
     }
 }
 
-template <typename T>
-void PriorityQueueADT<T>::_heapifyDown(const int &index)
+template <typename T, typename Compare>
+void PriorityQueueADT<T, Compare>::_heapifyDown(const int &index)
 {
     if (!_isLeaf(index))
     {
         int minChildIndex = _minChild(index);
-        if (minHeap[index] > minHeap[minChildIndex])
+        if (compare_(minHeap[minChildIndex], minHeap[index]))
         {
             std::swap(minHeap[index], minHeap[minChildIndex]);
             _heapifyDown(minChildIndex);
@@ -157,8 +274,8 @@ void PriorityQueueADT<T>::_heapifyDown(const int &index)
     }
 }
 
-template <class T>
-void PriorityQueueADT<T>::insert(const T &element)
+template <typename T, typename Compare>
+void PriorityQueueADT<T, Compare>::insert(const T &element)
 {
 
     // Null root edge case
@@ -167,18 +284,20 @@ void PriorityQueueADT<T>::insert(const T &element)
     // will begin at position 1. The left and right childs will be placed
     // into the array as if they are following the pattern of a tree as
     // follows: Left child = parents key(index) * 2, Right child = (parent's key(index) * 2) + 1.
-    if (size_ == capacity_)
+    // Slot 0 is unused, so the array is full once size_ reaches capacity_ - 1.
+    if (size_ + 1 >= capacity_)
     {
         _increaseCapacity();
     }
+    new (&minHeap[size_ + 1]) T(element);
 
-    // Increments the size key first before insertion.
-    minHeap[++size_] = element;
+    // The size grows only once the new slot has been constructed.
+    size_++;
     _heapifyUp(size_);
 }
 
-template <typename T>
-void PriorityQueueADT<T>::removeMin()
+template <typename T, typename Compare>
+void PriorityQueueADT<T, Compare>::removeMin()
 {
 
     if (size_ == 0)
@@ -186,22 +305,25 @@ void PriorityQueueADT<T>::removeMin()
         throw new std::runtime_error("Error: Trying to remove an element on an empty heap.");
     }
 
-    // We will swap the top element with the last element in our heap
-    // and decrement the size.
-    T tempLastElement = minHeap[size_];
-    minHeap[1] = tempLastElement;
+    // We will move the last element in our heap to the top, destroy
+    // the last slot and decrement the size.
+    if (size_ > 1)
+    {
+        minHeap[1] = std::move(minHeap[size_]);
+    }
+    minHeap[size_].~T();
     size_--;
 
     _heapifyDown(1);
 }
 
-template <typename T>
-std::ostream &PriorityQueueADT<T>::print(std::ostream &os) const
+template <typename T, typename Compare>
+std::ostream &PriorityQueueADT<T, Compare>::print(std::ostream &os) const
 {
     os << "[";
 
     // Note that this works correctly for an empty list.
-    for (int i = 1; i < capacity_; i++)
+    for (int i = 1; i <= size_; i++)
     {
         os << "(" << minHeap[i] << ")";
     }
@@ -209,3 +331,50 @@ std::ostream &PriorityQueueADT<T>::print(std::ostream &os) const
 
     return os;
 }
+
+template <typename T, typename Compare>
+void PriorityQueueADT<T, Compare>::serialize(BinaryWriter &writer) const
+{
+    // The array is already a valid heap, so it is written as it is, in bulk.
+    writer.beginObject("PRQU", 1);
+    writer.writeSize(size_);
+    writer.writeArray(minHeap + 1, (size_t)size_);
+}
+
+template <typename T, typename Compare>
+void PriorityQueueADT<T, Compare>::deserialize(BinaryReader &reader)
+{
+    reader.beginObject("PRQU", 1);
+    size_t count = reader.readSize();
+    if (count >= (size_t)INT32_MAX)
+    {
+        throw std::runtime_error("Error: serialized PriorityQueueADT is too large.");
+    }
+    // Decode into a separate queue, so a truncated or corrupt stream leaves
+    // this one as it was. The count is not trusted for the allocation: the
+    // array grows as elements actually arrive.
+    PriorityQueueADT<T, Compare> fresh(compare_);
+    while ((size_t)fresh.size_ < count)
+    {
+        if (fresh.size_ + 1 >= fresh.capacity_)
+        {
+            fresh._increaseCapacity();
+        }
+        if constexpr (serialization_detail::IsBulkCopyable<T>::value)
+        {
+            // Fills every free slot at once.
+            size_t room = (size_t)(fresh.capacity_ - 1 - fresh.size_);
+            size_t batch = count - (size_t)fresh.size_ < room ? count - (size_t)fresh.size_ : room;
+            reader.readArray(fresh.minHeap + fresh.size_ + 1, batch);
+            fresh.size_ += (int)batch;
+        }
+        else
+        {
+            T value;
+            reader.read(value);
+            new (&fresh.minHeap[fresh.size_ + 1]) T(std::move(value));
+            fresh.size_++;
+        }
+    }
+    _swap(fresh);
+}
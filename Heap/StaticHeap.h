@@ -0,0 +1,139 @@
+/**
+ * @file StaticHeap.h
+ * @author Kofi Boateng
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ *
+ */
+
+#pragma once
+#include <stdexcept>  // for runtime_error
+#include <cstddef>    // for size_t
+#include <functional> // for std::less, the default ordering
+
+// This is an implementation of a fixed-capacity PriorityQueue for loops whose bounds are known at compile
+// time. It is the same binary min heap as PriorityQueueADT, ordered by Compare, but the N slots live in
+// an array inside the object, so nothing is allocated, and every member function is constexpr, so a heap
+// can run inside a constant expression (Dijkstra over a constant graph, for example).
+// The heap is stored from index 0, so the children of i are 2i + 1 and 2i + 2. Inserting into a full
+// heap throws instead of growing; in a constant expression that is a compile error. T must be default
+// constructible, since the array holds N elements from the start.
+
+template <typename T, size_t N, typename Compare = std::less<T>>
+class StaticHeap
+{
+    static_assert(N > 0, "StaticHeap needs a capacity of at least one element.");
+
+private:
+    T heap_[N]{};
+    size_t size_ = 0;
+    Compare compare_{};
+
+    static constexpr void _swap(T &a, T &b)
+    {
+        T temp = a;
+        a = b;
+        b = temp;
+    }
+
+    // Moves the element at index up until its parent comes before it.
+    constexpr void _heapifyUp(size_t index);
+
+    // Moves the element at index down until it comes before both children.
+    constexpr void _heapifyDown(size_t index);
+
+public:
+    // Inserts an element in the heap.
+    constexpr void insert(const T &element);
+
+    // Removes the minimal element of the heap.
+    constexpr void removeMin();
+
+    // Retrieves the minimal element of the heap, but does not remove it.
+    constexpr const T &peek() const
+    {
+        if (size_ == 0)
+        {
+            throw std::runtime_error("Error: peek() called on an empty StaticHeap.");
+        }
+        return heap_[0];
+    }
+
+    constexpr size_t size() const { return size_; }
+    static constexpr size_t capacity() { return N; }
+    constexpr bool isEmpty() const { return size_ == 0; }
+    constexpr bool isFull() const { return size_ == N; }
+
+    // Removes every element.
+    constexpr void clear() { size_ = 0; }
+
+    constexpr StaticHeap() = default;
+    constexpr explicit StaticHeap(const Compare &compare) : compare_(compare) {}
+};
+
+// ===================================================================================
+// Implementation Section
+// ===================================================================================
+
+template <typename T, size_t N, typename Compare>
+constexpr void StaticHeap<T, N, Compare>::_heapifyUp(size_t index)
+{
+    while (index > 0)
+    {
+        size_t parent = (index - 1) / 2;
+        if (!compare_(heap_[index], heap_[parent]))
+        {
+            return;
+        }
+        _swap(heap_[index], heap_[parent]);
+        index = parent;
+    }
+}
+
+template <typename T, size_t N, typename Compare>
+constexpr void StaticHeap<T, N, Compare>::_heapifyDown(size_t index)
+{
+    while (true)
+    {
+        size_t child = 2 * index + 1;
+        if (child >= size_)
+        {
+            return;
+        }
+        if (child + 1 < size_ && compare_(heap_[child + 1], heap_[child]))
+        {
+            child++;
+        }
+        if (!compare_(heap_[child], heap_[index]))
+        {
+            return;
+        }
+        _swap(heap_[index], heap_[child]);
+        index = child;
+    }
+}
+
+template <typename T, size_t N, typename Compare>
+constexpr void StaticHeap<T, N, Compare>::insert(const T &element)
+{
+    if (size_ == N)
+    {
+        throw std::runtime_error("Error: insert() called on a full StaticHeap.");
+    }
+    heap_[size_] = element;
+    _heapifyUp(size_);
+    size_++;
+}
+
+template <typename T, size_t N, typename Compare>
+constexpr void StaticHeap<T, N, Compare>::removeMin()
+{
+    if (size_ == 0)
+    {
+        throw std::runtime_error("Error: removeMin() called on an empty StaticHeap.");
+    }
+    size_--;
+    heap_[0] = heap_[size_];
+    _heapifyDown(0);
+}
@@ -0,0 +1,651 @@
+/**
+ * @file BlockReader.h
+ * @author Kofi Boateng
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ *
+ */
+
+#pragma once
+#include <stdexcept>          // for runtime_error
+#include <cerrno>             // for errno codes
+#include <cstddef>            // for size_t
+#include <cstdint>            // for uint64_t
+#include <cstdlib>            // for posix_memalign and free
+#include <cstring>            // for memset and strerror
+#include <condition_variable> // for the pread threads
+#include <mutex>              // for the slot states
+#include <string>             // for the path
+#include <thread>             // pread threads
+#include <vector>             // slots and threads
+#include <fcntl.h>            // for open
+#include <sys/stat.h>         // for fstat
+#include <unistd.h>           // for pread and close
+#if defined(__linux__) && defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h> // for the ring layout and opcodes
+#include <sys/mman.h>       // for mapping the rings
+#include <sys/syscall.h>    // for __NR_io_uring_setup and __NR_io_uring_enter
+#define BLOCK_READER_HAS_IO_URING 1
+#endif
+#endif
+
+// This is an implementation of a Block Reader, which reads a file from front to back in large blocks while
+// the caller works on the blocks it has already been given.
+// The reader owns depth buffers of blockSize bytes, aligned to the page size. Block k of the file always
+// goes into buffer k % depth, so up to depth blocks are being read or held by the caller at once, and
+// next() hands them out strictly in file order. A buffer is refilled with block k + depth as soon as the
+// caller releases block k, in whatever order blocks are released.
+// On Linux the reads are queued on an io_uring. The ring is driven through the raw system calls, so no
+// library is needed, and one io_uring_enter both submits new reads and waits for the one the caller
+// needs. Where io_uring is missing or blocked (older kernels, seccomp filters), or when asked to, the
+// reader falls back to one thread per buffer, each issuing plain blocking preads. Those threads belong to
+// the reader rather than to the ThreadPool, so a thread stuck in the kernel never holds up parsing work.
+// With direct set the file is opened with O_DIRECT and reads bypass the page cache; the reader silently
+// drops back to buffered reads if the file system does not support it.
+
+class BlockReader
+{
+public:
+    enum class Backend
+    {
+        // Reads are queued on an io_uring.
+        IoUring,
+        // Each buffer has a thread issuing blocking preads.
+        PreadThreads
+    };
+
+    // A block handed out by next(). data stays valid until it is released.
+    struct Block
+    {
+        const char *data;
+        size_t size;
+        // Position of the block in the file, counted in blocks.
+        uint64_t index;
+    };
+
+    // Buffers, offsets and (with O_DIRECT) read lengths are multiples of this.
+    static constexpr size_t alignment = 4096;
+
+private:
+    enum class SlotState
+    {
+        Free,
+        Reading,
+        Ready,
+        Held
+    };
+
+    struct Slot
+    {
+        char *data = nullptr;
+        uint64_t block = 0;
+        size_t filled = 0;
+        SlotState state = SlotState::Free;
+    };
+
+    int fd_;
+    bool direct_;
+    uint64_t fileSize_;
+    size_t blockSize_;
+    uint64_t blockCount_;
+    Backend backend_;
+    std::vector<Slot> slots_;
+    // Index of the block next() returns next.
+    uint64_t nextBlock_;
+    // First errno reported by a read, or 0.
+    int error_;
+
+    // Pread threads; they share one lock and condition variable with next().
+    std::mutex lock_;
+    std::condition_variable changed_;
+    std::vector<std::thread> threads_;
+    bool stopping_;
+
+#if defined(BLOCK_READER_HAS_IO_URING)
+    int ring_;
+    void *sqMapping_;
+    size_t sqMappingBytes_;
+    void *cqMapping_;
+    size_t cqMappingBytes_;
+    io_uring_sqe *sqes_;
+    size_t sqesBytes_;
+    unsigned *sqHead_;
+    unsigned *sqTail_;
+    unsigned *sqMask_;
+    unsigned *sqArray_;
+    unsigned *cqHead_;
+    unsigned *cqTail_;
+    unsigned *cqMask_;
+    io_uring_cqe *cqes_;
+    // Reads queued on the ring but not yet passed to io_uring_enter.
+    unsigned unsubmitted_;
+    // Reads submitted whose completion has not been reaped.
+    unsigned inFlight_;
+
+    // Sets up a ring with room for every buffer. Returns false if the kernel
+    // refuses or is too old for IORING_OP_READ.
+    bool _openRing();
+    void _closeRing();
+    // Queues a read for the rest of slot's block.
+    void _queueRead(int slot);
+    // Submits queued reads and, with wait set, blocks for one completion.
+    void _enter(bool wait);
+    // Handles every completion on the ring.
+    void _reap();
+#endif
+
+    // Number of bytes of the file in block.
+    size_t _blockBytes(uint64_t block) const
+    {
+        uint64_t offset = block * blockSize_;
+        return (size_t)(fileSize_ - offset < blockSize_ ? fileSize_ - offset : blockSize_);
+    }
+
+    // Length to request for the remaining bytes of a block: O_DIRECT reads
+    // must cover whole aligned units even at the end of the file.
+    size_t _readLength(size_t remaining) const
+    {
+        return direct_ ? (remaining + alignment - 1) / alignment * alignment : remaining;
+    }
+
+    // Starts reading block into slot, or frees the slot past the end of the file.
+    void _fill(int slot, uint64_t block);
+
+    // Body of the pread thread that owns slot.
+    void _preadLoop(int slot);
+
+    void _close();
+
+public:
+    // Hands out the next block in file order. Returns false once the whole
+    // file has been returned. Throws if a read failed.
+    bool next(Block &block);
+
+    // Returns block's buffer to the reader, which starts reading the block
+    // depth positions further on into it.
+    void release(const Block &block);
+
+    // Returns the size of the file in bytes.
+    uint64_t fileSize() const { return fileSize_; }
+
+    // Returns the number of blocks in the file.
+    uint64_t blockCount() const { return blockCount_; }
+
+    // Returns the block size in bytes.
+    size_t blockSize() const { return blockSize_; }
+
+    // Returns the number of buffers.
+    int depth() const { return (int)slots_.size(); }
+
+    // Returns the backend that is actually in use.
+    Backend backend() const { return backend_; }
+
+    // Opens path for reading in blocks of blockSize bytes (rounded up to the
+    // alignment) with depth buffers, and starts reading the first blocks.
+    explicit BlockReader(const std::string &path, size_t blockSize = 4 << 20, int depth = 4,
+                         Backend backend = Backend::IoUring, bool direct = false);
+
+    BlockReader(const BlockReader &) = delete;
+    BlockReader &operator=(const BlockReader &) = delete;
+
+    ~BlockReader() { _close(); }
+};
+
+// ===================================================================================
+// Implementation Section
+// ===================================================================================
+
+inline BlockReader::BlockReader(const std::string &path, size_t blockSize, int depth, Backend backend, bool direct)
+    : fd_(-1), direct_(false), fileSize_(0), blockSize_((blockSize > 0 ? blockSize + alignment - 1 : alignment) / alignment * alignment),
+      blockCount_(0), backend_(backend), slots_(depth > 0 ? depth : 1), nextBlock_(0), error_(0), stopping_(false)
+#if defined(BLOCK_READER_HAS_IO_URING)
+      ,
+      ring_(-1), sqMapping_(nullptr), sqMappingBytes_(0), cqMapping_(nullptr), cqMappingBytes_(0), sqes_(nullptr), sqesBytes_(0),
+      unsubmitted_(0), inFlight_(0)
+#endif
+{
+#if defined(O_DIRECT)
+    if (direct)
+    {
+        fd_ = open(path.c_str(), O_RDONLY | O_DIRECT);
+        direct_ = fd_ >= 0;
+    }
+#else
+    (void)direct;
+#endif
+    if (fd_ < 0)
+    {
+        fd_ = open(path.c_str(), O_RDONLY);
+    }
+    if (fd_ < 0)
+    {
+        throw std::runtime_error("Error: BlockReader could not open " + path + ": " + std::strerror(errno));
+    }
+    struct stat info;
+    if (fstat(fd_, &info) != 0)
+    {
+        close(fd_);
+        throw std::runtime_error("Error: BlockReader could not stat " + path + ".");
+    }
+    fileSize_ = (uint64_t)info.st_size;
+    blockCount_ = (fileSize_ + blockSize_ - 1) / blockSize_;
+
+    for (Slot &slot : slots_)
+    {
+        void *data = nullptr;
+        if (posix_memalign(&data, alignment, blockSize_) != 0)
+        {
+            _close();
+            throw std::runtime_error("Error: BlockReader could not allocate its buffers.");
+        }
+        slot.data = static_cast<char *>(data);
+    }
+
+#if defined(BLOCK_READER_HAS_IO_URING)
+    if (backend_ == Backend::IoUring && !_openRing())
+    {
+        backend_ = Backend::PreadThreads;
+    }
+#else
+    backend_ = Backend::PreadThreads;
+#endif
+
+    if (backend_ == Backend::PreadThreads)
+    {
+        try
+        {
+            for (int i = 0; i < (int)slots_.size(); i++)
+            {
+                threads_.emplace_back(&BlockReader::_preadLoop, this, i);
+            }
+        }
+        catch (...)
+        {
+            _close();
+            throw;
+        }
+    }
+    {
+        std::lock_guard<std::mutex> lock(lock_);
+        for (int i = 0; i < (int)slots_.size(); i++)
+        {
+            _fill(i, (uint64_t)i);
+        }
+    }
+#if defined(BLOCK_READER_HAS_IO_URING)
+    if (backend_ == Backend::IoUring)
+    {
+        _enter(false);
+    }
+#endif
+}
+
+inline void BlockReader::_fill(int slot, uint64_t block)
+{
+    Slot &target = slots_[slot];
+    if (block >= blockCount_)
+    {
+        target.state = SlotState::Free;
+        return;
+    }
+    target.block = block;
+    target.filled = 0;
+    target.state = SlotState::Reading;
+#if defined(BLOCK_READER_HAS_IO_URING)
+    if (backend_ == Backend::IoUring)
+    {
+        _queueRead(slot);
+        return;
+    }
+#endif
+    changed_.notify_all();
+}
+
+inline void BlockReader::_preadLoop(int slot)
+{
+    Slot &target = slots_[slot];
+    std::unique_lock<std::mutex> lock(lock_);
+    while (true)
+    {
+        changed_.wait(lock, [this, &target]()
+                      { return stopping_ || target.state == SlotState::Reading; });
+        if (stopping_)
+        {
+            return;
+        }
+        uint64_t offset = target.block * blockSize_;
+        size_t bytes = _blockBytes(target.block);
+        lock.unlock();
+
+        size_t filled = 0;
+        int error = 0;
+        while (filled < bytes)
+        {
+            ssize_t count = pread(fd_, target.data + filled, _readLength(bytes - filled), (off_t)(offset + filled));
+            if (count < 0)
+            {
+                if (errno == EINTR)
+                {
+                    continue;
+                }
+                error = errno;
+                break;
+            }
+            if (count == 0)
+            {
+                // The file shrank after it was opened.
+                break;
+            }
+            filled += (size_t)count;
+        }
+
+        lock.lock();
+        if (error != 0 && error_ == 0)
+        {
+            error_ = error;
+        }
+        target.filled = filled < bytes ? filled : bytes;
+        target.state = SlotState::Ready;
+        changed_.notify_all();
+    }
+}
+
+inline bool BlockReader::next(Block &block)
+{
+    if (nextBlock_ >= blockCount_)
+    {
+        return false;
+    }
+    // The pread threads change slot states under lock_; the ring is only
+    // touched by this thread.
+    std::unique_lock<std::mutex> lock(lock_, std::defer_lock);
+    if (backend_ == Backend::PreadThreads)
+    {
+        lock.lock();
+    }
+    Slot &slot = slots_[nextBlock_ % slots_.size()];
+    if (slot.state == SlotState::Held)
+    {
+        throw std::runtime_error("Error: BlockReader::next() called while holding depth blocks; release one first.");
+    }
+#if defined(BLOCK_READER_HAS_IO_URING)
+    if (backend_ == Backend::IoUring)
+    {
+        _enter(false);
+        _reap();
+        while (slot.state != SlotState::Ready && error_ == 0)
+        {
+            _enter(true);
+            _reap();
+        }
+    }
+    else
+#endif
+    {
+        changed_.wait(lock, [this, &slot]()
+                      { return slot.state == SlotState::Ready || error_ != 0; });
+    }
+    if (error_ != 0)
+    {
+        throw std::runtime_error(std::string("Error: BlockReader read failed: ") + std::strerror(error_));
+    }
+    slot.state = SlotState::Held;
+    block.data = slot.data;
+    block.size = slot.filled;
+    block.index = nextBlock_++;
+    return true;
+}
+
+inline void BlockReader::release(const Block &block)
+{
+    std::unique_lock<std::mutex> lock(lock_, std::defer_lock);
+    if (backend_ == Backend::PreadThreads)
+    {
+        lock.lock();
+    }
+    int slot = (int)(block.index % slots_.size());
+    if (slots_[slot].state != SlotState::Held || slots_[slot].block != block.index)
+    {
+        throw std::runtime_error("Error: BlockReader::release() called with a block that is not held.");
+    }
+    _fill(slot, block.index + slots_.size());
+#if defined(BLOCK_READER_HAS_IO_URING)
+    if (backend_ == Backend::IoUring)
+    {
+        _enter(false);
+    }
+#endif
+}
+
+inline void BlockReader::_close()
+{
+    {
+        std::lock_guard<std::mutex> lock(lock_);
+        stopping_ = true;
+    }
+    changed_.notify_all();
+    for (std::thread &thread : threads_)
+    {
+        thread.join();
+    }
+    threads_.clear();
+#if defined(BLOCK_READER_HAS_IO_URING)
+    _closeRing();
+#endif
+    for (Slot &slot : slots_)
+    {
+        free(slot.data);
+        slot.data = nullptr;
+    }
+    if (fd_ >= 0)
+    {
+        close(fd_);
+        fd_ = -1;
+    }
+}
+
+#if defined(BLOCK_READER_HAS_IO_URING)
+
+inline bool BlockReader::_openRing()
+{
+    io_uring_params params;
+    std::memset(&params, 0, sizeof(params));
+    int ring = (int)syscall(__NR_io_uring_setup, (unsigned)slots_.size(), &params);
+    if (ring < 0)
+    {
+        return false;
+    }
+    // IORING_OP_READ arrived in the same release (5.6) as this feature flag.
+    if (!(params.features & IORING_FEAT_RW_CUR_POS))
+    {
+        close(ring);
+        return false;
+    }
+    ring_ = ring;
+
+    sqMappingBytes_ = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    cqMappingBytes_ = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+    bool single = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+    if (single && cqMappingBytes_ > sqMappingBytes_)
+    {
+        sqMappingBytes_ = cqMappingBytes_;
+    }
+    void *sq = mmap(nullptr, sqMappingBytes_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_, IORING_OFF_SQ_RING);
+    if (sq == MAP_FAILED)
+    {
+        _closeRing();
+        return false;
+    }
+    sqMapping_ = sq;
+    void *cq = sq;
+    if (!single)
+    {
+        cq = mmap(nullptr, cqMappingBytes_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_, IORING_OFF_CQ_RING);
+        if (cq == MAP_FAILED)
+        {
+            _closeRing();
+            return false;
+        }
+        cqMapping_ = cq;
+    }
+    sqesBytes_ = params.sq_entries * sizeof(io_uring_sqe);
+    void *sqes = mmap(nullptr, sqesBytes_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_, IORING_OFF_SQES);
+    if (sqes == MAP_FAILED)
+    {
+        _closeRing();
+        return false;
+    }
+    sqes_ = static_cast<io_uring_sqe *>(sqes);
+
+    char *sqBase = static_cast<char *>(sq);
+    sqHead_ = reinterpret_cast<unsigned *>(sqBase + params.sq_off.head);
+    sqTail_ = reinterpret_cast<unsigned *>(sqBase + params.sq_off.tail);
+    sqMask_ = reinterpret_cast<unsigned *>(sqBase + params.sq_off.ring_mask);
+    sqArray_ = reinterpret_cast<unsigned *>(sqBase + params.sq_off.array);
+    char *cqBase = static_cast<char *>(cq);
+    cqHead_ = reinterpret_cast<unsigned *>(cqBase + params.cq_off.head);
+    cqTail_ = reinterpret_cast<unsigned *>(cqBase + params.cq_off.tail);
+    cqMask_ = reinterpret_cast<unsigned *>(cqBase + params.cq_off.ring_mask);
+    cqes_ = reinterpret_cast<io_uring_cqe *>(cqBase + params.cq_off.cqes);
+    return true;
+}
+
+inline void BlockReader::_closeRing()
+{
+    // The kernel may still be writing into the buffers, so every submitted
+    // read has to complete before they can be freed.
+    while (ring_ >= 0 && sqes_ && (inFlight_ > 0 || unsubmitted_ > 0))
+    {
+        _enter(true);
+        _reap();
+        if (error_ != 0 && inFlight_ == 0)
+        {
+            break;
+        }
+    }
+    if (sqes_)
+    {
+        munmap(sqes_, sqesBytes_);
+        sqes_ = nullptr;
+    }
+    if (cqMapping_)
+    {
+        munmap(cqMapping_, cqMappingBytes_);
+        cqMapping_ = nullptr;
+    }
+    if (sqMapping_)
+    {
+        munmap(sqMapping_, sqMappingBytes_);
+        sqMapping_ = nullptr;
+    }
+    if (ring_ >= 0)
+    {
+        close(ring_);
+        ring_ = -1;
+    }
+}
+
+inline void BlockReader::_queueRead(int slot)
+{
+    Slot &target = slots_[slot];
+    uint64_t offset = target.block * blockSize_ + target.filled;
+    // Only this thread writes the submission tail; the kernel reads it.
+    unsigned tail = *sqTail_;
+    unsigned index = tail & *sqMask_;
+    io_uring_sqe &sqe = sqes_[index];
+    std::memset(&sqe, 0, sizeof(sqe));
+    sqe.opcode = IORING_OP_READ;
+    sqe.fd = fd_;
+    sqe.addr = (uint64_t)(uintptr_t)(target.data + target.filled);
+    sqe.len = (unsigned)_readLength(_blockBytes(target.block) - target.filled);
+    sqe.off = offset;
+    sqe.user_data = (uint64_t)slot;
+    sqArray_[index] = index;
+    __atomic_store_n(sqTail_, tail + 1, __ATOMIC_RELEASE);
+    unsubmitted_++;
+}
+
+inline void BlockReader::_enter(bool wait)
+{
+    if (unsubmitted_ == 0 && !wait)
+    {
+        return;
+    }
+    while (true)
+    {
+        long submitted = syscall(__NR_io_uring_enter, ring_, unsubmitted_, wait ? 1u : 0u,
+                                 wait ? IORING_ENTER_GETEVENTS : 0u, nullptr, 0);
+        if (submitted >= 0)
+        {
+            unsubmitted_ -= (unsigned)submitted;
+            inFlight_ += (unsigned)submitted;
+            return;
+        }
+        if (errno == EINTR)
+        {
+            continue;
+        }
+        if (errno == EAGAIN || errno == EBUSY)
+        {
+            // The kernel is short of resources; completions free them up.
+            if (inFlight_ > 0)
+            {
+                _reap();
+            }
+            std::this_thread::yield();
+            continue;
+        }
+        if (error_ == 0)
+        {
+            error_ = errno;
+        }
+        // Nothing more will complete; forget the reads that never made it in.
+        unsubmitted_ = 0;
+        return;
+    }
+}
+
+inline void BlockReader::_reap()
+{
+    unsigned head = *cqHead_;
+    unsigned tail = __atomic_load_n(cqTail_, __ATOMIC_ACQUIRE);
+    for (; head != tail; head++)
+    {
+        const io_uring_cqe &cqe = cqes_[head & *cqMask_];
+        Slot &target = slots_[(size_t)cqe.user_data];
+        int result = cqe.res;
+        inFlight_--;
+        size_t bytes = _blockBytes(target.block);
+        if (result == -EAGAIN || result == -EINTR)
+        {
+            _queueRead((int)cqe.user_data);
+            continue;
+        }
+        if (result < 0)
+        {
+            if (error_ == 0)
+            {
+                error_ = -result;
+            }
+            target.state = SlotState::Ready;
+            continue;
+        }
+        target.filled += (size_t)result;
+        if (result > 0 && target.filled < bytes)
+        {
+            // A short read; ask for the rest of the block.
+            _queueRead((int)cqe.user_data);
+            continue;
+        }
+        if (target.filled > bytes)
+        {
+            target.filled = bytes;
+        }
+        target.state = SlotState::Ready;
+    }
+    __atomic_store_n(cqHead_, head, __ATOMIC_RELEASE);
+}
+
+#endif
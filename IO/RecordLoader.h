@@ -0,0 +1,202 @@
+/**
+ * @file RecordLoader.h
+ * @author Kofi Boateng
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ *
+ */
+
+#pragma once
+#include <cstddef>     // for size_t
+#include <cstring>     // for memchr
+#include <deque>       // batches being parsed
+#include <memory>      // for unique_ptr
+#include <string>      // for the carried partial record
+#include <string_view> // records handed to the parser
+#include <utility>     // for move and pair
+#include <vector>      // parsed batches
+#include "BlockReader.h"
+#include "../Concurrency/ThreadPool.h"
+#include "../Hashing/SeparateChainingHashTable/SeparateChainingHashTable.h"
+#include "../Trees/PrefixTree/PrefixTree.h"
+
+// These functions build containers from large files of delimited records (one per line by default).
+// Loading is a pipeline of three stages that overlap: a BlockReader keeps the next blocks of the file
+// being read while earlier ones are parsed, every block is parsed into a batch of records as a task on a
+// ThreadPool, and the calling thread hands the batches, in file order, to a bulk-insert path such as
+// HashTable::addBatch or PrefixTree::insertBatch. The container is only ever touched by the calling
+// thread, so it needs no locking.
+// A record that straddles two blocks is stitched together on the calling thread: the bytes after the
+// last delimiter of one block are carried over and joined with the bytes before the first delimiter of
+// the next, and the joined record is parsed at the front of the next block's batch. Parsing never waits
+// for reads, and no byte of the file is copied except the stitched records.
+// Batches are finished before the reader gets within one buffer of the oldest block still being parsed,
+// so at least one buffer is always being read, however many blocks a single record spans.
+
+struct LoadOptions
+{
+    // Size of every read, rounded up to BlockReader::alignment.
+    size_t blockSize = 4 << 20;
+    // Number of block buffers.
+    int depth = 8;
+    BlockReader::Backend backend = BlockReader::Backend::IoUring;
+    // Bypasses the page cache with O_DIRECT where the file system allows it.
+    bool direct = false;
+    // Byte that ends every record.
+    char delimiter = '\n';
+    // Pool that parses the blocks, or nullptr for ThreadPool::global().
+    ThreadPool *pool = nullptr;
+};
+
+// Reads every record of the file at path. parse(std::string_view record, Record &out)
+// fills out and returns true, or returns false to skip the record; it runs on
+// pool threads and must not keep the view, which points into a reused buffer.
+// consume(std::vector<Record> &batch) receives the parsed batches in file order
+// on the calling thread. Returns the number of records parsed.
+template <typename Record, typename Parse, typename Consume>
+size_t loadRecords(const std::string &path, Parse parse, Consume consume, const LoadOptions &options = LoadOptions())
+{
+    struct Batch
+    {
+        BlockReader::Block block;
+        // The record that started in the previous block, completed by this one.
+        std::string head;
+        // Whole records of the block, delimiters included.
+        size_t begin;
+        size_t end;
+        std::vector<Record> records;
+        std::unique_ptr<ThreadPool::TaskGroup> group;
+    };
+
+    ThreadPool &pool = options.pool ? *options.pool : ThreadPool::global();
+    BlockReader reader(path, options.blockSize, options.depth, options.backend, options.direct);
+    const char delimiter = options.delimiter;
+    const size_t window = reader.depth() > 1 ? (size_t)reader.depth() - 1 : 1;
+    std::deque<std::unique_ptr<Batch>> pending;
+    std::string carry;
+    size_t total = 0;
+
+    auto parseInto = [&parse](std::string_view record, std::vector<Record> &records)
+    {
+        Record parsed;
+        if (parse(record, parsed))
+        {
+            records.push_back(std::move(parsed));
+        }
+    };
+
+    auto finishOldest = [&]()
+    {
+        Batch &batch = *pending.front();
+        batch.group->wait();
+        reader.release(batch.block);
+        total += batch.records.size();
+        consume(batch.records);
+        pending.pop_front();
+    };
+
+    BlockReader::Block block;
+    // Index of the block next() hands out next.
+    uint64_t nextIndex = 0;
+    while (true)
+    {
+        // The window is counted in blocks, not batches. Blocks inside a long
+        // record are released at once but still move the reader along, and
+        // the next block goes into the buffer of the block depth places back.
+        while (!pending.empty() && nextIndex - pending.front()->block.index >= window)
+        {
+            finishOldest();
+        }
+        if (!reader.next(block))
+        {
+            break;
+        }
+        nextIndex = block.index + 1;
+        const char *first = static_cast<const char *>(std::memchr(block.data, delimiter, block.size));
+        if (!first)
+        {
+            // The block lies inside one long record.
+            carry.append(block.data, block.size);
+            reader.release(block);
+            continue;
+        }
+        size_t last = block.size - 1;
+        while (block.data[last] != delimiter)
+        {
+            last--;
+        }
+
+        std::unique_ptr<Batch> batch(new Batch());
+        batch->block = block;
+        batch->head.swap(carry);
+        batch->head.append(block.data, first - block.data);
+        batch->begin = (size_t)(first - block.data) + 1;
+        batch->end = last + 1;
+        carry.assign(block.data + last + 1, block.size - last - 1);
+
+        Batch *task = batch.get();
+        task->group.reset(new ThreadPool::TaskGroup(pool));
+        pending.push_back(std::move(batch));
+        task->group->run([task, delimiter, &parseInto]()
+                         {
+            parseInto(task->head, task->records);
+            const char *cursor = task->block.data + task->begin;
+            const char *end = task->block.data + task->end;
+            while (cursor < end)
+            {
+                const char *next = static_cast<const char *>(std::memchr(cursor, delimiter, end - cursor));
+                parseInto(std::string_view(cursor, next - cursor), task->records);
+                cursor = next + 1;
+            } });
+    }
+    while (!pending.empty())
+    {
+        finishOldest();
+    }
+
+    // The file may not end with a delimiter.
+    if (!carry.empty())
+    {
+        std::vector<Record> records;
+        parseInto(carry, records);
+        total += records.size();
+        consume(records);
+    }
+    return total;
+}
+
+// Adds the key/value pairs parsed from every record of the file at path to
+// table; parse(std::string_view record, std::pair<K, V> &out) works as for
+// loadRecords. Later records override earlier ones with the same key.
+template <typename K, typename V, typename Hash, typename Allocator, typename Parse>
+size_t loadHashTable(const std::string &path, HashTable<K, V, Hash, Allocator> &table, Parse parse,
+                     const LoadOptions &options = LoadOptions())
+{
+    return loadRecords<std::pair<K, V>>(
+        path, parse, [&table](std::vector<std::pair<K, V>> &batch)
+        { table.addBatch(std::move(batch)); },
+        options);
+}
+
+// Inserts every line of the file at path into tree as a word. Carriage returns
+// at the end of a line are dropped and empty lines are skipped.
+inline size_t loadPrefixTree(const std::string &path, PrefixTree &tree, const LoadOptions &options = LoadOptions())
+{
+    return loadRecords<std::string>(
+        path, [](std::string_view line, std::string &word)
+        {
+            if (!line.empty() && line.back() == '\r')
+            {
+                line.remove_suffix(1);
+            }
+            if (line.empty())
+            {
+                return false;
+            }
+            word.assign(line.data(), line.size());
+            return true; },
+        [&tree](std::vector<std::string> &batch)
+        { tree.insertBatch(std::move(batch)); },
+        options);
+}
@@ -12,6 +12,8 @@
 #include <iostream>  // for cout & cerr
 #include <stdexcept> // for runtime_error
 #include <ostream>   // for::ostream
+#include <utility>   // for swap
+#include "../Serialization/BinaryStream.h"
 
 // This is an implementation of a Doubly-Linked List. Since it is a doubly linked list, it can be treated similarly
 // to a double ended queue.
@@ -96,24 +98,51 @@ public:
     // Returns a boolean value based on the existence of the head pointer
     bool isEmpty() const { return !head_; }
 
-    // pushes element to the front of the list
-    void pushFront(const T &elem);
-    // Pushes element to the back of the list
-    void pushBack(const T &elem);
+    // pushes element to the front of the list. Returns the new node so callers
+    // can keep a stable handle to it.
+    Node *pushFront(const T &elem);
+    // Pushes element to the back of the list. Returns the new node so callers
+    // can keep a stable handle to it.
+    Node *pushBack(const T &elem);
     // Delete the front element of the list;
     void popFront();
     // Delete the back element of the list;
     void popBack();
 
-    // Delete all items in the list, leaving it empty
+    // The functions below work on node handles returned by pushFront/pushBack.
+    // A node stays at the same address for its whole life, so another structure
+    // (e.g. a hash table of Node pointers) can find it in O(1) and then splice it
+    // out of the middle of the list without walking it.
+
+    // Detaches node from this list without deallocating it. The node keeps its
+    // data and can be linked back in with linkFront/linkBack, in this list or
+    // another one. O(1).
+    void unlink(Node *node);
+    // Links a detached node at the front of the list. O(1).
+    void linkFront(Node *node);
+    // Links a detached node at the back of the list. O(1).
+    void linkBack(Node *node);
+    // Unlinks node from this list and deallocates it. O(1).
+    void erase(Node *node);
+    // Moves a node of this list to the front. O(1).
+    void moveToFront(Node *node);
+    // Moves a node of this list to the back. O(1).
+    void moveToBack(Node *node);
+
+    // Delete all items in the list, leaving it empty. The nodes are freed in
+    // one walk from the front rather than relinking the tail after every pop.
     void clear()
     {
-        while (head_)
+        Node *cur = head_;
+        while (cur)
         {
-            popBack();
+            Node *next = cur->next;
+            delete cur;
+            cur = next;
         }
-        if (size_ != 0)
-            throw new std::runtime_error("Error in clear: elements still exist on the heap... please check");
+        head_ = nullptr;
+        tail_ = nullptr;
+        size_ = 0;
     }
 
     // Checks for equality between two list.
@@ -187,9 +216,15 @@ public:
     // This is used by the operator<< overload defined in this file.
     std::ostream &print(std::ostream &os) const;
 
+    // Writes the list to writer (Refer to Serialization/BinaryStream.h).
+    void serialize(BinaryWriter &writer) const;
+    // Replaces the contents of the list with one read from reader.
+    void deserialize(BinaryReader &reader);
+
     // Checks for pointer correctness in list. If a cycle is detected in the list,
     // we will through an error.
     // We will implement the runner algorithm (Tortoise-Haire) for cycle detection.
+    // It walks the whole list, so it is a debugging check; no operation calls it.
     void hasCycle();
 
     // was previously sorted. The item should be inserted before the earliest
@@ -245,6 +280,11 @@ public:
     // for this copy of the list.
     LinkedList<T> &operator=(const LinkedList<T> &other)
     {
+        // Clearing first would empty the source too when copying onto itself.
+        if (this == &other)
+        {
+            return *this;
+        }
         // Clear the current list.
         clear();
 
@@ -321,14 +361,14 @@ void LinkedList<T>::hasCycle()
     Node *tortoise = this->head_;
     Node *haire = this->head_;
 
-    // While will run until the haire breaks the loop or cycle detection is confirmed
-    while (tortoise && haire)
+    // While will run until the haire reaches the end of the list or cycle detection is confirmed
+    while (haire && haire->next)
     {
         tortoise = tortoise->next;
         haire = haire->next->next;
         // Checking for same memory address instead of data duplication.
-        if (tortoise->data == haire->data)
-            throw new std::runtime_error("Error: Cycle has been detected");
+        if (tortoise == haire)
+            throw std::runtime_error("Error: Cycle has been detected");
     }
 }
 
@@ -360,7 +400,7 @@ bool LinkedList<T>::equals(const LinkedList<T> &other) const
 }
 
 template <typename T>
-void LinkedList<T>::pushBack(const T &elem)
+typename LinkedList<T>::Node *LinkedList<T>::pushBack(const T &elem)
 {
     Node *newNode = new Node(elem);
 
@@ -378,10 +418,11 @@ void LinkedList<T>::pushBack(const T &elem)
     }
 
     this->size_++;
+    return newNode;
 }
 
 template <typename T>
-void LinkedList<T>::pushFront(const T &elem)
+typename LinkedList<T>::Node *LinkedList<T>::pushFront(const T &elem)
 {
     Node *newNode = new Node(elem);
 
@@ -395,10 +436,10 @@ void LinkedList<T>::pushFront(const T &elem)
         Node *oldHead = this->head_;
         oldHead->prev = newNode;
         newNode->next = oldHead;
-        oldHead = newNode;
+        this->head_ = newNode;
     }
-    hasCycle();
     this->size_++;
+    return newNode;
 }
 
 template <typename T>
@@ -442,7 +483,7 @@ void LinkedList<T>::popBack()
         return;
     }
 
-    Node *currTail = this->head_;
+    Node *currTail = this->tail_;
     tail_ = currTail->prev;
     tail_->next = nullptr;
     delete currTail;
@@ -450,6 +491,75 @@ void LinkedList<T>::popBack()
     this->size_--;
 }
 
+template <typename T>
+void LinkedList<T>::unlink(Node *node)
+{
+    if (node->prev)
+        node->prev->next = node->next;
+    else
+        head_ = node->next;
+
+    if (node->next)
+        node->next->prev = node->prev;
+    else
+        tail_ = node->prev;
+
+    node->next = nullptr;
+    node->prev = nullptr;
+    this->size_--;
+}
+
+template <typename T>
+void LinkedList<T>::linkFront(Node *node)
+{
+    node->prev = nullptr;
+    node->next = head_;
+    if (head_)
+        head_->prev = node;
+    else
+        tail_ = node;
+    head_ = node;
+    this->size_++;
+}
+
+template <typename T>
+void LinkedList<T>::linkBack(Node *node)
+{
+    node->next = nullptr;
+    node->prev = tail_;
+    if (tail_)
+        tail_->next = node;
+    else
+        head_ = node;
+    tail_ = node;
+    this->size_++;
+}
+
+template <typename T>
+void LinkedList<T>::erase(Node *node)
+{
+    unlink(node);
+    delete node;
+}
+
+template <typename T>
+void LinkedList<T>::moveToFront(Node *node)
+{
+    if (node == head_)
+        return;
+    unlink(node);
+    linkFront(node);
+}
+
+template <typename T>
+void LinkedList<T>::moveToBack(Node *node)
+{
+    if (node == tail_)
+        return;
+    unlink(node);
+    linkBack(node);
+}
+
 template <typename T>
 void LinkedList<T>::insertOrdered(const T &elem)
 {
@@ -471,8 +581,6 @@ void LinkedList<T>::insertOrdered(const T &elem)
     newNode->prev = currNode->prev;
     currNode->prev = newNode;
 
-    hasCycle();
-
     this->size_++;
 }
 
@@ -641,3 +749,33 @@ LinkedList<T> LinkedList<T>::mergeSort(const std::string &type) const
     }
     return mergeSortIterative();
 }
+
+template <typename T>
+void LinkedList<T>::serialize(BinaryWriter &writer) const
+{
+    writer.beginObject("LLST", 1);
+    writer.writeSize(size_);
+    for (const Node *cur = head_; cur; cur = cur->next)
+    {
+        writer.write(cur->data);
+    }
+}
+
+template <typename T>
+void LinkedList<T>::deserialize(BinaryReader &reader)
+{
+    reader.beginObject("LLST", 1);
+    size_t count = reader.readSize();
+    // Decode into a separate list, so a truncated or corrupt stream leaves
+    // this one as it was.
+    LinkedList<T> fresh;
+    for (size_t i = 0; i < count; i++)
+    {
+        T value;
+        reader.read(value);
+        fresh.pushBack(value);
+    }
+    std::swap(head_, fresh.head_);
+    std::swap(tail_, fresh.tail_);
+    std::swap(size_, fresh.size_);
+}
@@ -0,0 +1,54 @@
+/**
+ * @file ArenaAllocator.h
+ * @author Kofi Boateng
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ *
+ */
+
+#pragma once
+#include <cstddef> // for size_t
+#include "HugePageArena.h"
+
+// This is a standard allocator that hands out memory from a HugePageArena, so that any container taking
+// an allocator (std::vector, std::list, HashTable, KDTree) keeps its nodes or arrays in the arena's huge
+// pages. deallocate() does nothing: the memory comes back when the arena is reset or destroyed, so a
+// container that grows by reallocating (a vector doubling, a hash table rehashing) leaves its old arrays
+// behind in the arena. Because growth is geometric that costs at most as much again as the final size;
+// reserving up front avoids it. Nothing removed is ever reused either, so this fits containers that are
+// built once and then only read (or frozen); a container that keeps inserting and removing should use
+// RecyclingAllocator (RecyclingAllocator.h) instead.
+// Copies of an allocator, including ones rebound to another type, share the arena and compare equal, so
+// containers on the same arena can splice nodes between each other. The arena must outlive every
+// container that uses it.
+
+template <typename T>
+class ArenaAllocator
+{
+private:
+    HugePageArena *arena_;
+
+    template <typename U>
+    friend class ArenaAllocator;
+
+public:
+    typedef T value_type;
+
+    T *allocate(size_t count) { return static_cast<T *>(arena_->allocate(count * sizeof(T), alignof(T))); }
+
+    void deallocate(T *, size_t) {}
+
+    // Returns the arena this allocator draws from.
+    HugePageArena &arena() const { return *arena_; }
+
+    template <typename U>
+    bool operator==(const ArenaAllocator<U> &other) const { return arena_ == other.arena_; }
+    template <typename U>
+    bool operator!=(const ArenaAllocator<U> &other) const { return arena_ != other.arena_; }
+
+    explicit ArenaAllocator(HugePageArena &arena) : arena_(&arena) {}
+
+    template <typename U>
+    ArenaAllocator(const ArenaAllocator<U> &other) : arena_(other.arena_) {}
+};
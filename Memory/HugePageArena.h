@@ -0,0 +1,214 @@
+/**
+ * @file HugePageArena.h
+ * @author Kofi Boateng
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ *
+ */
+
+#pragma once
+#include <stdexcept> // for runtime_error
+#include <cstddef>   // for size_t and max_align_t
+#include <cstdint>   // for uintptr_t
+#include <new>       // for operator new (non-Linux fallback)
+#include <vector>    // node lists for the NUMA policy
+#if defined(__linux__)
+#include <linux/mempolicy.h> // for MPOL_BIND and MPOL_INTERLEAVE
+#include <sys/mman.h>        // for mmap, munmap and madvise
+#include <sys/syscall.h>     // for SYS_mbind
+#include <unistd.h>          // for syscall
+#endif
+
+// This is an implementation of an Arena that backs very large containers with huge pages. A hash table
+// or tree of several GB touches its nodes at random, and with 4 KB pages every lookup is likely to miss
+// the TLB and walk the page tables as well as miss the cache. With 2 MB pages one TLB entry covers 512
+// times as much memory, so most of those walks disappear.
+// The arena reserves one range of address space up front with mmap (MAP_NORESERVE, so nothing is
+// committed until it is touched) and hands out chunks of it with a bump pointer: allocate() rounds the
+// offset up to the requested alignment and advances it, which is a few instructions and never calls the
+// system allocator. Chunks are never freed one at a time; reset() forgets every allocation at once, and
+// the destructor returns the whole range with a single munmap. That fits containers that are built,
+// queried and then dropped together. Use ArenaAllocator (ArenaAllocator.h) to place a container's node
+// pool in an arena.
+// PageMode picks the page size:
+//     Transparent - the range is aligned to 2 MB and marked with MADV_HUGEPAGE, so the kernel backs it
+//                   with transparent huge pages when it can (the default).
+//     Explicit    - the range is mapped with MAP_HUGETLB from the hugetlbfs pool. If the pool has no
+//                   free pages (vm.nr_hugepages is 0 by default) the arena falls back to Transparent.
+//     Normal      - 4 KB pages, marked MADV_NOHUGEPAGE, as a baseline to compare against.
+// pageMode() reports the mode that was actually obtained. On systems without mmap the arena is one
+// plain allocation and the page mode is only a request. The arena is not thread-safe.
+// On a NUMA machine bindToNode() places every page of the arena on one node and interleave() spreads
+// them round-robin over a list of nodes, whichever thread touches them first. Nodes are the kernel's
+// ids (Refer to Concurrency/NumaTopology.h), which need not be dense. They call mbind directly, so
+// there is no dependency on libnuma.
+
+class HugePageArena
+{
+public:
+    enum class PageMode
+    {
+        Normal,
+        Transparent,
+        Explicit
+    };
+
+    // The huge page size on x86-64 and the default on AArch64.
+    static constexpr size_t hugePageSize = (size_t)2 << 20;
+
+private:
+    char *base_;
+    size_t capacity_;
+    size_t used_;
+    void *mapping_;
+    size_t mappingBytes_;
+    PageMode mode_;
+
+    static size_t _roundUp(size_t value, size_t multiple) { return (value + multiple - 1) / multiple * multiple; }
+
+    // Reserves capacity_ bytes, trying the requested mode first.
+    void _reserve(PageMode mode);
+
+    // Applies a NUMA memory policy over nodes to the range.
+    bool _setPolicy(int policy, const std::vector<int> &nodes);
+
+public:
+    // Returns bytes of memory aligned to alignment (a power of two). Throws
+    // if the arena is exhausted.
+    void *allocate(size_t bytes, size_t alignment = alignof(std::max_align_t))
+    {
+        uintptr_t start = ((uintptr_t)base_ + used_ + alignment - 1) & ~(uintptr_t)(alignment - 1);
+        size_t offset = (size_t)(start - (uintptr_t)base_);
+        if (offset > capacity_ || bytes > capacity_ - offset)
+        {
+            throw std::runtime_error("Error: HugePageArena is out of memory.");
+        }
+        used_ = offset + bytes;
+        return base_ + offset;
+    }
+
+    // Forgets every allocation, so the memory is handed out again. Objects
+    // in the arena are not destroyed.
+    void reset() { used_ = 0; }
+
+    // Returns the number of bytes handed out so far, including alignment padding.
+    size_t used() const { return used_; }
+
+    // Returns the number of bytes reserved.
+    size_t capacity() const { return capacity_; }
+
+    // Returns the page mode that was actually obtained.
+    PageMode pageMode() const { return mode_; }
+
+#if defined(__linux__)
+    // Places the arena's pages on NUMA node. Pages already touched stay
+    // where they are, so call it before handing out memory. Returns false if
+    // the kernel refused (for example, without NUMA support).
+    bool bindToNode(int node) { return _setPolicy(MPOL_BIND, std::vector<int>(1, node)); }
+
+    // Spreads the arena's pages round-robin over nodes, such as NumaTopology::nodes().
+    bool interleave(const std::vector<int> &nodes) { return _setPolicy(MPOL_INTERLEAVE, nodes); }
+#else
+    bool bindToNode(int) { return false; }
+    bool interleave(const std::vector<int> &) { return false; }
+#endif
+
+    // Reserves capacity bytes of address space (rounded up to whole huge pages).
+    explicit HugePageArena(size_t capacity, PageMode mode = PageMode::Transparent)
+        : base_(nullptr), capacity_(_roundUp(capacity > 0 ? capacity : 1, hugePageSize)), used_(0),
+          mapping_(nullptr), mappingBytes_(0), mode_(mode)
+    {
+        _reserve(mode);
+    }
+
+    HugePageArena(const HugePageArena &) = delete;
+    HugePageArena &operator=(const HugePageArena &) = delete;
+
+    ~HugePageArena()
+    {
+#if defined(__linux__)
+        munmap(mapping_, mappingBytes_);
+#else
+        ::operator delete(mapping_);
+#endif
+    }
+};
+
+// ===================================================================================
+// Implementation Section
+// ===================================================================================
+
+inline bool HugePageArena::_setPolicy(int policy, const std::vector<int> &nodes)
+{
+#if defined(__linux__) && defined(SYS_mbind)
+    const int bits = 8 * sizeof(unsigned long);
+    unsigned long mask[1024 / (8 * sizeof(unsigned long))] = {};
+    if (nodes.empty())
+    {
+        return false;
+    }
+    for (int node : nodes)
+    {
+        if (node < 0 || node >= 1024)
+        {
+            return false;
+        }
+        mask[node / bits] |= 1UL << (node % bits);
+    }
+    return syscall(SYS_mbind, base_, capacity_, policy, mask, (unsigned long)1024, 0) == 0;
+#else
+    (void)policy;
+    (void)nodes;
+    return false;
+#endif
+}
+
+inline void HugePageArena::_reserve(PageMode mode)
+{
+#if defined(__linux__)
+#if defined(MAP_HUGETLB)
+    if (mode == PageMode::Explicit)
+    {
+        // No MAP_NORESERVE here: the pool pages must be reserved now, or the
+        // mapping would succeed and the first touch past the pool would SIGBUS.
+        void *mapping = mmap(nullptr, capacity_, PROT_READ | PROT_WRITE,
+                             MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        if (mapping != MAP_FAILED)
+        {
+            mapping_ = mapping;
+            mappingBytes_ = capacity_;
+            base_ = static_cast<char *>(mapping);
+            mode_ = PageMode::Explicit;
+            return;
+        }
+        mode = PageMode::Transparent;
+    }
+#else
+    if (mode == PageMode::Explicit)
+    {
+        mode = PageMode::Transparent;
+    }
+#endif
+    // Over-reserve by one huge page so the range can start on a 2 MB boundary,
+    // which the kernel needs before it can map huge pages at all.
+    size_t bytes = capacity_ + hugePageSize;
+    void *mapping = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    if (mapping == MAP_FAILED)
+    {
+        throw std::runtime_error("Error: HugePageArena could not reserve memory.");
+    }
+    mapping_ = mapping;
+    mappingBytes_ = bytes;
+    base_ = reinterpret_cast<char *>(_roundUp((uintptr_t)mapping, hugePageSize));
+    mode_ = mode;
+#if defined(MADV_HUGEPAGE) && defined(MADV_NOHUGEPAGE)
+    madvise(base_, capacity_, mode == PageMode::Normal ? MADV_NOHUGEPAGE : MADV_HUGEPAGE);
+#endif
+#else
+    (void)mode;
+    mapping_ = ::operator new(capacity_);
+    mappingBytes_ = capacity_;
+    base_ = static_cast<char *>(mapping_);
+#endif
+}
@@ -0,0 +1,49 @@
+/**
+ * @file RecyclingAllocator.h
+ * @author Kofi Boateng
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ *
+ */
+
+#pragma once
+#include <cstddef> // for size_t
+#include "RecyclingArena.h"
+
+// This is a standard allocator that hands out memory from a RecyclingArena. Unlike ArenaAllocator,
+// deallocate() returns the block to the arena's free lists, so a container that removes as much as it
+// inserts (a HashTable under churn) keeps reusing the same nodes rather than exhausting the arena.
+// Copies of an allocator, including ones rebound to another type, share the arena and compare equal, so
+// containers on the same arena can splice nodes between each other. The arena must outlive every
+// container that uses it.
+
+template <typename T>
+class RecyclingAllocator
+{
+private:
+    RecyclingArena *arena_;
+
+    template <typename U>
+    friend class RecyclingAllocator;
+
+public:
+    typedef T value_type;
+
+    T *allocate(size_t count) { return static_cast<T *>(arena_->allocate(count * sizeof(T), alignof(T))); }
+
+    void deallocate(T *pointer, size_t count) { arena_->deallocate(pointer, count * sizeof(T), alignof(T)); }
+
+    // Returns the arena this allocator draws from.
+    RecyclingArena &arena() const { return *arena_; }
+
+    template <typename U>
+    bool operator==(const RecyclingAllocator<U> &other) const { return arena_ == other.arena_; }
+    template <typename U>
+    bool operator!=(const RecyclingAllocator<U> &other) const { return arena_ != other.arena_; }
+
+    explicit RecyclingAllocator(RecyclingArena &arena) : arena_(&arena) {}
+
+    template <typename U>
+    RecyclingAllocator(const RecyclingAllocator<U> &other) : arena_(other.arena_) {}
+};
@@ -0,0 +1,92 @@
+/**
+ * @file RecyclingArena.h
+ * @author Kofi Boateng
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ *
+ */
+
+#pragma once
+#include <cstddef> // for size_t and max_align_t
+#include <map>     // free lists of large blocks
+#include <vector>  // free lists of small blocks
+#include "HugePageArena.h"
+
+// This is a Recycling Arena: free lists over a HugePageArena, so that containers that keep removing as
+// well as adding (a hash table under insert/remove churn) reuse their freed memory instead of bumping
+// through the arena until it runs out.
+// Freed blocks are kept in a free list per size, rounded up to 16 bytes, and the next allocation of the
+// same size pops one off before asking the arena for new memory. The link to the next free block is
+// stored in the freed block itself, so the free lists cost no memory of their own. Small sizes (every
+// list node) index a vector of lists directly; the few large sizes (bucket arrays left behind by a
+// rehash) are kept in a map. Memory never goes back to the arena itself, so the arena only has to hold
+// the most the container ever had live at once.
+// Blocks are aligned to max_align_t. Allocations that need a stricter alignment come straight from the
+// arena and are not recycled. Like the arena, it is not thread-safe. Use RecyclingAllocator
+// (RecyclingAllocator.h) to place a container in it.
+
+class RecyclingArena
+{
+private:
+    HugePageArena &arena_;
+    // Heads of the free lists for sizes up to smallLimit, by size / granularity.
+    std::vector<void *> small_;
+    std::map<size_t, void *> large_;
+
+    static constexpr size_t granularity = 16;
+    static constexpr size_t smallLimit = 1024;
+
+    static size_t _roundUp(size_t bytes) { return (bytes + granularity - 1) / granularity * granularity; }
+
+    // Returns the head of the free list for blocks of bytes (already rounded).
+    void *&_head(size_t bytes)
+    {
+        if (bytes <= smallLimit)
+        {
+            return small_[bytes / granularity];
+        }
+        return large_[bytes];
+    }
+
+public:
+    // Returns bytes of memory aligned to alignment (a power of two), reusing
+    // a freed block of the same size if there is one.
+    void *allocate(size_t bytes, size_t alignment = alignof(std::max_align_t))
+    {
+        size_t rounded = _roundUp(bytes > 0 ? bytes : 1);
+        if (alignment > alignof(std::max_align_t))
+        {
+            return arena_.allocate(rounded, alignment);
+        }
+        void *&head = _head(rounded);
+        if (head)
+        {
+            void *block = head;
+            head = *static_cast<void **>(block);
+            return block;
+        }
+        return arena_.allocate(rounded, alignof(std::max_align_t));
+    }
+
+    // Puts a block returned by allocate(bytes, alignment) on its free list.
+    void deallocate(void *block, size_t bytes, size_t alignment = alignof(std::max_align_t))
+    {
+        if (!block || alignment > alignof(std::max_align_t))
+        {
+            return;
+        }
+        void *&head = _head(_roundUp(bytes > 0 ? bytes : 1));
+        *static_cast<void **>(block) = head;
+        head = block;
+    }
+
+    // Returns the arena the blocks come from.
+    HugePageArena &arena() const { return arena_; }
+
+    // Recycles blocks on top of arena, which must outlive this object.
+    explicit RecyclingArena(HugePageArena &arena) : arena_(arena), small_(smallLimit / granularity + 1, nullptr) {}
+
+    RecyclingArena(const RecyclingArena &) = delete;
+    RecyclingArena &operator=(const RecyclingArena &) = delete;
+};
@@ -0,0 +1,99 @@
+/**
+ * @file MonotonicDeque.h
+ * @author Kofi Boateng
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ *
+ */
+
+#pragma once
+#include <stdexcept>  // for runtime_error
+#include <cstdint>    // for fixed width integers
+#include <functional> // for std::less
+#include "RingBuffer.h"
+
+// This is an implementation of a Monotonic Deque, which keeps the minimum (or, with std::greater, the
+// maximum) of a sliding window over a stream in amortized O(1) per element instead of rescanning the
+// window. Every element carries a key, such as its position in the stream or its timestamp, and keys
+// must not decrease. Elements leave the window from the front with expireBefore(key).
+// The trick is that an element can be forgotten as soon as a newer element that is at least as good
+// arrives: the newer one stays in the window longer and beats it for as long as both are there. So
+// push() first pops every element from the back that the new one beats, and the deque is always sorted
+// by Compare from front to back. The front is then the answer, and each element is pushed and popped
+// at most once.
+// The candidates are kept in a RingBuffer, so the deque works in one contiguous array with no
+// allocation per element.
+
+template <typename T, typename Compare = std::less<T>, typename Key = uint64_t>
+class MonotonicDeque
+{
+private:
+    struct Entry
+    {
+        Key key;
+        T value;
+    };
+
+    RingBuffer<Entry> entries_;
+    Compare compare_;
+
+public:
+    // Adds value to the window with key, which must be at least the last key pushed.
+    void push(const Key &key, const T &value)
+    {
+        if (!entries_.isEmpty() && key < entries_.back().key)
+        {
+            throw std::runtime_error("Error: MonotonicDeque keys must not decrease.");
+        }
+        // Older values the new one beats can never be the answer again.
+        while (!entries_.isEmpty() && !compare_(entries_.back().value, value))
+        {
+            entries_.popBack();
+        }
+        entries_.pushBack(Entry{key, value});
+    }
+
+    // Drops every element whose key is less than key from the window.
+    void expireBefore(const Key &key)
+    {
+        while (!entries_.isEmpty() && entries_.front().key < key)
+        {
+            entries_.popFront();
+        }
+    }
+
+    // Returns the best value in the window: the minimum under Compare.
+    const T &peek() const
+    {
+        if (entries_.isEmpty())
+        {
+            throw std::runtime_error("Error: peek() called on an empty MonotonicDeque.");
+        }
+        return entries_.front().value;
+    }
+
+    // Returns the key of the value peek() returns.
+    const Key &peekKey() const
+    {
+        if (entries_.isEmpty())
+        {
+            throw std::runtime_error("Error: peekKey() called on an empty MonotonicDeque.");
+        }
+        return entries_.front().key;
+    }
+
+    // Returns a boolean signifying if the window is empty or not.
+    bool isEmpty() const { return entries_.isEmpty(); }
+
+    // Returns the number of candidates held, at most the window size.
+    size_t size() const { return entries_.size(); }
+
+    // Removes every element.
+    void clear() { entries_.clear(); }
+
+    explicit MonotonicDeque(const Compare &compare = Compare()) : entries_(), compare_(compare) {}
+
+    MonotonicDeque(const MonotonicDeque &) = delete;
+    MonotonicDeque &operator=(const MonotonicDeque &) = delete;
+};
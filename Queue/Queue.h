@@ -12,6 +12,8 @@
 #include <iostream>  // for cout & cerr
 #include <stdexcept> // for runtime_error
 #include <ostream>   // for::ostream
+#include <utility>   // for swap
+#include "../Serialization/BinaryStream.h"
 
 // This is an implementation of a Queue ADT. A Queue is a a structure that
 // follows the LIFO principles. Therefore, we can use a doubly linked list
@@ -167,6 +169,11 @@ public:
     // This is used by the operator<< overload defined in this file.
     std::ostream &print(std::ostream &os) const;
 
+    // Writes the queue to writer (Refer to Serialization/BinaryStream.h).
+    void serialize(BinaryWriter &writer) const;
+    // Replaces the contents of the queue with one read from reader.
+    void deserialize(BinaryReader &reader);
+
     // Default constructor: The list will be empty.
     QueueADT() : head_(nullptr), tail_(nullptr), size_(0) {}
 
@@ -259,11 +266,16 @@ void QueueADT<T>::dequeue()
     {
         Node *oldHead = this->head_;
         head_ = oldHead->next;
+        if (head_)
+        {
+            head_->prev = nullptr;
+        }
+        else
+        {
+            tail_ = nullptr;
+        }
 
         delete oldHead;
-
-        oldHead->next = nullptr;
-        oldHead->prev = nullptr;
     }
     this->size_--;
 }
@@ -295,3 +307,33 @@ bool QueueADT<T>::equals(const QueueADT<T> &other) const
 
     return true;
 }
+
+template <typename T>
+void QueueADT<T>::serialize(BinaryWriter &writer) const
+{
+    writer.beginObject("QUEU", 1);
+    writer.writeSize(size_);
+    for (const Node *cur = head_; cur; cur = cur->next)
+    {
+        writer.write(cur->data);
+    }
+}
+
+template <typename T>
+void QueueADT<T>::deserialize(BinaryReader &reader)
+{
+    reader.beginObject("QUEU", 1);
+    size_t count = reader.readSize();
+    // Decode into a separate queue, so a truncated or corrupt stream leaves
+    // this one as it was.
+    QueueADT<T> fresh;
+    for (size_t i = 0; i < count; i++)
+    {
+        T value;
+        reader.read(value);
+        fresh.enqueue(value);
+    }
+    std::swap(head_, fresh.head_);
+    std::swap(tail_, fresh.tail_);
+    std::swap(size_, fresh.size_);
+}
@@ -0,0 +1,238 @@
+/**
+ * @file RingBuffer.h
+ * @author Kofi Boateng
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ *
+ */
+
+#pragma once
+#include <stdexcept>   // for runtime_error
+#include <cstddef>     // for size_t
+#include <cstring>     // for memcpy
+#include <new>         // for placement new
+#include <type_traits> // for is_trivially_copyable
+#include <utility>     // for move
+
+// This is an implementation of a Ring Buffer, a double-ended queue stored in one contiguous array.
+// QueueADT allocates a node for every element and follows a pointer for every step; here the elements
+// sit next to each other, and head_ marks where the front is. Pushing and popping at either end only
+// moves head_ or the size, wrapping around the end of the array, so every operation is O(1) and never
+// allocates until the buffer is full. A full buffer doubles, moving the elements to the new array in
+// order (amortized O(1) per push).
+// The capacity is always a power of two, so wrapping an index is a mask rather than a modulo.
+// Trivially copyable elements are moved by at most two memcpy calls when the buffer grows, and
+// clearing a buffer of trivially destructible elements skips the destructor loop.
+// When a push finds the buffer full, the new element is constructed in the new array before the old
+// one is released, so pushing one of the buffer's own elements (pushBack(front())) is safe.
+
+template <typename T>
+class RingBuffer
+{
+private:
+    T *buffer_;
+    size_t capacity_;
+    size_t head_;
+    size_t size_;
+
+    // Returns the array slot of the i-th element from the front.
+    size_t _slot(size_t i) const { return (head_ + i) & (capacity_ - 1); }
+
+    // Doubles the capacity and adds an element constructed from args, at the
+    // front if atFront or else at the back. The elements move to the front
+    // of the new array, with a new front element in its last slot.
+    template <typename... Args>
+    void _growAndPush(bool atFront, Args &&...args);
+
+public:
+    // Constructs an element from args at the back.
+    template <typename... Args>
+    void emplaceBack(Args &&...args)
+    {
+        if (size_ == capacity_)
+        {
+            _growAndPush(false, std::forward<Args>(args)...);
+            return;
+        }
+        new (&buffer_[_slot(size_)]) T(std::forward<Args>(args)...);
+        size_++;
+    }
+
+    // Constructs an element from args at the front.
+    template <typename... Args>
+    void emplaceFront(Args &&...args)
+    {
+        if (size_ == capacity_)
+        {
+            _growAndPush(true, std::forward<Args>(args)...);
+            return;
+        }
+        size_t slot = (head_ - 1) & (capacity_ - 1);
+        new (&buffer_[slot]) T(std::forward<Args>(args)...);
+        head_ = slot;
+        size_++;
+    }
+
+    // Appends an element at the back.
+    void pushBack(const T &value) { emplaceBack(value); }
+    void pushBack(T &&value) { emplaceBack(std::move(value)); }
+
+    // Prepends an element at the front.
+    void pushFront(const T &value) { emplaceFront(value); }
+    void pushFront(T &&value) { emplaceFront(std::move(value)); }
+
+    // Removes the front element.
+    void popFront()
+    {
+        if (size_ == 0)
+        {
+            throw std::runtime_error("Error: popFront() called on an empty RingBuffer.");
+        }
+        buffer_[head_].~T();
+        head_ = _slot(1);
+        size_--;
+    }
+
+    // Removes the back element.
+    void popBack()
+    {
+        if (size_ == 0)
+        {
+            throw std::runtime_error("Error: popBack() called on an empty RingBuffer.");
+        }
+        buffer_[_slot(size_ - 1)].~T();
+        size_--;
+    }
+
+    T &front()
+    {
+        if (size_ == 0)
+        {
+            throw std::runtime_error("Error: front() called on an empty RingBuffer.");
+        }
+        return buffer_[head_];
+    }
+
+    const T &front() const
+    {
+        if (size_ == 0)
+        {
+            throw std::runtime_error("Error: front() called on an empty RingBuffer.");
+        }
+        return buffer_[head_];
+    }
+
+    T &back()
+    {
+        if (size_ == 0)
+        {
+            throw std::runtime_error("Error: back() called on an empty RingBuffer.");
+        }
+        return buffer_[_slot(size_ - 1)];
+    }
+
+    const T &back() const
+    {
+        if (size_ == 0)
+        {
+            throw std::runtime_error("Error: back() called on an empty RingBuffer.");
+        }
+        return buffer_[_slot(size_ - 1)];
+    }
+
+    // Returns the i-th element from the front. Does not check bounds.
+    T &operator[](size_t i) { return buffer_[_slot(i)]; }
+    const T &operator[](size_t i) const { return buffer_[_slot(i)]; }
+
+    // Returns the number of elements.
+    size_t size() const { return size_; }
+
+    // Returns the number of elements that fit before the buffer grows.
+    size_t capacity() const { return capacity_; }
+
+    // Returns a boolean signifying if the buffer is empty or not.
+    bool isEmpty() const { return size_ == 0; }
+
+    // Removes every element, keeping the capacity.
+    void clear()
+    {
+        if constexpr (std::is_trivially_destructible<T>::value)
+        {
+            size_ = 0;
+        }
+        else
+        {
+            while (size_ > 0)
+            {
+                popBack();
+            }
+        }
+        head_ = 0;
+    }
+
+    // Creates an empty buffer with room for at least initialCapacity elements.
+    explicit RingBuffer(size_t initialCapacity = 16) : buffer_(nullptr), capacity_(1), head_(0), size_(0)
+    {
+        while (capacity_ < initialCapacity)
+        {
+            capacity_ <<= 1;
+        }
+        buffer_ = static_cast<T *>(::operator new(capacity_ * sizeof(T)));
+    }
+
+    RingBuffer(const RingBuffer &) = delete;
+    RingBuffer &operator=(const RingBuffer &) = delete;
+
+    ~RingBuffer()
+    {
+        clear();
+        ::operator delete(buffer_);
+    }
+};
+
+// ===================================================================================
+// Implementation Section
+// ===================================================================================
+
+template <typename T>
+template <typename... Args>
+void RingBuffer<T>::_growAndPush(bool atFront, Args &&...args)
+{
+    size_t capacity = capacity_ << 1;
+    T *buffer = static_cast<T *>(::operator new(capacity * sizeof(T)));
+    // The new element comes first: args may refer to an element of the old
+    // array, which must still be alive while it is copied.
+    size_t slot = atFront ? capacity - 1 : size_;
+    try
+    {
+        new (&buffer[slot]) T(std::forward<Args>(args)...);
+    }
+    catch (...)
+    {
+        ::operator delete(buffer);
+        throw;
+    }
+    if constexpr (std::is_trivially_copyable<T>::value)
+    {
+        // The elements run from head_ to the end of the array and then wrap
+        // around to its start.
+        size_t first = capacity_ - head_ < size_ ? capacity_ - head_ : size_;
+        std::memcpy(buffer, buffer_ + head_, first * sizeof(T));
+        std::memcpy(buffer + first, buffer_, (size_ - first) * sizeof(T));
+    }
+    else
+    {
+        for (size_t i = 0; i < size_; i++)
+        {
+            T &element = buffer_[_slot(i)];
+            new (&buffer[i]) T(std::move(element));
+            element.~T();
+        }
+    }
+    ::operator delete(buffer_);
+    buffer_ = buffer;
+    capacity_ = capacity;
+    head_ = atFront ? slot : 0;
+    size_++;
+}
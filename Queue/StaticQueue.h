@@ -0,0 +1,110 @@
+/**
+ * @file StaticQueue.h
+ * @author Kofi Boateng
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ *
+ */
+
+#pragma once
+#include <stdexcept> // for runtime_error
+#include <cstddef>   // for size_t
+
+// This is an implementation of a fixed-capacity Queue for loops whose bounds are known at compile time.
+// It is the RingBuffer layout with the array inside the object: head_ marks the front, the elements wrap
+// around the end of the array, and nothing is ever allocated. N must be a power of two so that wrapping
+// an index is a mask rather than a modulo, and every member function is constexpr, so a queue can be
+// used while the compiler evaluates a constant expression (a BFS over a constant graph, for example).
+// Enqueueing onto a full queue throws instead of growing; in a constant expression that is a compile
+// error. T must be default constructible, since the array holds N elements from the start.
+
+template <typename T, size_t N>
+class StaticQueue
+{
+    static_assert(N > 0 && (N & (N - 1)) == 0, "StaticQueue capacity must be a power of two.");
+
+private:
+    static constexpr size_t mask_ = N - 1;
+
+    T data_[N]{};
+    size_t head_ = 0;
+    size_t size_ = 0;
+
+public:
+    // Adds an element to the back of the queue.
+    constexpr void enqueue(const T &value)
+    {
+        if (size_ == N)
+        {
+            throw std::runtime_error("Error: enqueue() called on a full StaticQueue.");
+        }
+        data_[(head_ + size_) & mask_] = value;
+        size_++;
+    }
+
+    // Removes the front element.
+    constexpr void dequeue()
+    {
+        if (size_ == 0)
+        {
+            throw std::runtime_error("Error: dequeue() called on an empty StaticQueue.");
+        }
+        head_ = (head_ + 1) & mask_;
+        size_--;
+    }
+
+    constexpr T &front()
+    {
+        if (size_ == 0)
+        {
+            throw std::runtime_error("Error: front() called on an empty StaticQueue.");
+        }
+        return data_[head_];
+    }
+
+    constexpr const T &front() const
+    {
+        if (size_ == 0)
+        {
+            throw std::runtime_error("Error: front() called on an empty StaticQueue.");
+        }
+        return data_[head_];
+    }
+
+    constexpr T &back()
+    {
+        if (size_ == 0)
+        {
+            throw std::runtime_error("Error: back() called on an empty StaticQueue.");
+        }
+        return data_[(head_ + size_ - 1) & mask_];
+    }
+
+    constexpr const T &back() const
+    {
+        if (size_ == 0)
+        {
+            throw std::runtime_error("Error: back() called on an empty StaticQueue.");
+        }
+        return data_[(head_ + size_ - 1) & mask_];
+    }
+
+    // Returns the i-th element from the front. Does not check bounds.
+    constexpr T &operator[](size_t i) { return data_[(head_ + i) & mask_]; }
+    constexpr const T &operator[](size_t i) const { return data_[(head_ + i) & mask_]; }
+
+    constexpr size_t size() const { return size_; }
+    static constexpr size_t capacity() { return N; }
+    constexpr bool isEmpty() const { return size_ == 0; }
+    constexpr bool isFull() const { return size_ == N; }
+
+    // Removes every element.
+    constexpr void clear()
+    {
+        head_ = 0;
+        size_ = 0;
+    }
+
+    constexpr StaticQueue() = default;
+};
@@ -0,0 +1,446 @@
+/**
+ * @file BinaryStream.h
+ * @author Kofi Boateng
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ *
+ */
+
+#pragma once
+#include <stdexcept>   // for runtime_error
+#include <cstddef>     // for size_t
+#include <cstdint>     // for fixed width integers
+#include <cstring>     // for memcpy
+#include <istream>     // for reading from streams
+#include <ostream>     // for writing to streams
+#include <string>      // for strings and tags
+#include <type_traits> // for picking an encoding per type
+#include <utility>     // for pair
+#include <vector>      // for buffers
+
+// This is the binary serialization layer that every container's serialize(writer) and deserialize(reader)
+// is written against. A BinaryWriter streams values into a std::ostream (a file, a socket wrapper, an
+// ostringstream) or appends them to a std::vector<char>; a BinaryReader streams them back from a
+// std::istream or reads them straight out of a block of memory. Both go through a 64 KB buffer, so a
+// container of any size is written and read in constant memory, one element at a time, and never has to
+// be materialized as a whole.
+// The format is fixed regardless of the machine: integers are little-endian and exactly as wide as their
+// type, floating point values are their IEEE-754 bit patterns, bool is one byte, sizes are 64-bit, and a
+// string is its length followed by its bytes. A std::pair is its two members, and any type with its own
+// serialize(BinaryWriter &) const / deserialize(BinaryReader &) members (every container here) nests, so
+// a LinkedList<HashTable<int, std::string>> just works. Any other trivially copyable type is written as
+// its raw bytes, which is only portable between machines with the same layout and byte order.
+// writeArray/readArray copy a contiguous array of integers, floats or other trivially copyable values
+// with one memcpy on little-endian machines (the common case) instead of encoding element by element.
+// Every container starts its data with beginObject(tag, version): a four-character tag that says what
+// follows and a format version, so a reader can refuse data meant for another type and future versions
+// can keep loading old files.
+
+class BinaryReader;
+
+class BinaryWriter;
+
+namespace serialization_detail
+{
+#if defined(__BYTE_ORDER__) && defined(__ORDER_BIG_ENDIAN__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    static constexpr bool hostLittleEndian = false;
+#else
+    static constexpr bool hostLittleEndian = true;
+#endif
+
+    // Detects member serialize(BinaryWriter &) const.
+    template <typename T, typename = void>
+    struct HasSerialize : std::false_type
+    {
+    };
+
+    template <typename T>
+    struct HasSerialize<T, decltype(std::declval<const T &>().serialize(std::declval<BinaryWriter &>()), void())> : std::true_type
+    {
+    };
+
+    // Numbers that are stored little-endian with their own width.
+    template <typename T>
+    struct IsNumber : std::integral_constant<bool, (std::is_arithmetic<T>::value || std::is_enum<T>::value) && !std::is_same<T, bool>::value>
+    {
+    };
+
+    // Types whose array can be copied with one memcpy on this machine.
+    template <typename T>
+    struct IsBulkCopyable : std::integral_constant<bool, std::is_trivially_copyable<T>::value && !std::is_same<T, bool>::value &&
+                                                             !HasSerialize<T>::value && (hostLittleEndian || !IsNumber<T>::value)>
+    {
+    };
+
+    template <typename T>
+    struct IsPair : std::false_type
+    {
+    };
+
+    template <typename A, typename B>
+    struct IsPair<std::pair<A, B>> : std::true_type
+    {
+    };
+}
+
+class BinaryWriter
+{
+private:
+    std::ostream *stream_;
+    std::vector<char> *vector_;
+    std::vector<char> buffer_;
+    size_t used_;
+
+    static const size_t bufferSize = 64 * 1024;
+
+    void _append(const void *data, size_t bytes);
+
+    // Writes the low bytes bytes of value, least significant first.
+    void _writeUnsigned(uint64_t value, size_t bytes)
+    {
+        char encoded[8];
+        for (size_t i = 0; i < bytes; i++)
+        {
+            encoded[i] = (char)(value >> (8 * i));
+        }
+        _append(encoded, bytes);
+    }
+
+public:
+    // Writes one value (Refer to the comment above for the encoding).
+    template <typename T>
+    void write(const T &value);
+
+    // Writes count values from a contiguous array, in bulk when possible.
+    template <typename T>
+    void writeArray(const T *values, size_t count);
+
+    // Writes a size or count as a 64-bit integer.
+    void writeSize(size_t size) { _writeUnsigned((uint64_t)size, 8); }
+
+    // Writes the tag (four characters) and version that open a serialized object.
+    void beginObject(const char *tag, uint16_t version)
+    {
+        _append(tag, 4);
+        _writeUnsigned(version, 2);
+    }
+
+    // Hands the buffered bytes to the stream or vector.
+    void flush();
+
+    // Streams into stream.
+    explicit BinaryWriter(std::ostream &stream) : stream_(&stream), vector_(nullptr), buffer_(bufferSize), used_(0) {}
+
+    // Appends to output.
+    explicit BinaryWriter(std::vector<char> &output) : stream_(nullptr), vector_(&output), buffer_(bufferSize), used_(0) {}
+
+    BinaryWriter(const BinaryWriter &) = delete;
+    BinaryWriter &operator=(const BinaryWriter &) = delete;
+
+    // Flushes whatever is still buffered. Call flush() first to see errors.
+    ~BinaryWriter()
+    {
+        try
+        {
+            flush();
+        }
+        catch (...)
+        {
+        }
+    }
+};
+
+class BinaryReader
+{
+private:
+    std::istream *stream_;
+    std::vector<char> buffer_;
+    const char *cursor_;
+    const char *end_;
+
+    static const size_t bufferSize = 64 * 1024;
+
+    // Refills the buffer from the stream. Returns false at the end of the data.
+    bool _refill();
+
+    void _take(void *data, size_t bytes);
+
+    uint64_t _readUnsigned(size_t bytes)
+    {
+        unsigned char encoded[8];
+        _take(encoded, bytes);
+        uint64_t value = 0;
+        for (size_t i = 0; i < bytes; i++)
+        {
+            value |= (uint64_t)encoded[i] << (8 * i);
+        }
+        return value;
+    }
+
+public:
+    // Reads one value written by BinaryWriter::write.
+    template <typename T>
+    void read(T &value);
+
+    template <typename T>
+    T read()
+    {
+        T value;
+        read(value);
+        return value;
+    }
+
+    // Reads count values into a contiguous array.
+    template <typename T>
+    void readArray(T *values, size_t count);
+
+    // Reads a size written by writeSize.
+    size_t readSize()
+    {
+        uint64_t size = _readUnsigned(8);
+        if (size > (uint64_t)SIZE_MAX)
+        {
+            throw std::runtime_error("Error: serialized size does not fit in memory.");
+        }
+        return (size_t)size;
+    }
+
+    // Checks that an object with tag follows and returns its version. Throws
+    // if the tag differs or the version is newer than maxVersion.
+    uint16_t beginObject(const char *tag, uint16_t maxVersion)
+    {
+        char found[4];
+        _take(found, 4);
+        if (std::memcmp(found, tag, 4) != 0)
+        {
+            throw std::runtime_error(std::string("Error: expected serialized ") + std::string(tag, 4) + " data.");
+        }
+        uint16_t version = (uint16_t)_readUnsigned(2);
+        if (version > maxVersion)
+        {
+            throw std::runtime_error(std::string("Error: ") + std::string(tag, 4) + " data has an unsupported version.");
+        }
+        return version;
+    }
+
+    // Returns whether every byte has been read.
+    bool atEnd() { return cursor_ == end_ && !_refill(); }
+
+    // Streams from stream.
+    explicit BinaryReader(std::istream &stream) : stream_(&stream), buffer_(bufferSize), cursor_(nullptr), end_(nullptr) {}
+
+    // Reads from size bytes at data, which must stay valid while reading.
+    BinaryReader(const void *data, size_t size)
+        : stream_(nullptr), cursor_(static_cast<const char *>(data)), end_(static_cast<const char *>(data) + size) {}
+
+    BinaryReader(const BinaryReader &) = delete;
+    BinaryReader &operator=(const BinaryReader &) = delete;
+};
+
+// ===================================================================================
+// Implementation Section
+// ===================================================================================
+
+inline void BinaryWriter::_append(const void *data, size_t bytes)
+{
+    const char *source = static_cast<const char *>(data);
+    while (bytes > 0)
+    {
+        if (used_ == buffer_.size())
+        {
+            flush();
+        }
+        size_t chunk = buffer_.size() - used_ < bytes ? buffer_.size() - used_ : bytes;
+        std::memcpy(buffer_.data() + used_, source, chunk);
+        used_ += chunk;
+        source += chunk;
+        bytes -= chunk;
+    }
+}
+
+inline void BinaryWriter::flush()
+{
+    if (used_ == 0)
+    {
+        return;
+    }
+    if (vector_)
+    {
+        vector_->insert(vector_->end(), buffer_.data(), buffer_.data() + used_);
+    }
+    else if (!stream_->write(buffer_.data(), (std::streamsize)used_))
+    {
+        throw std::runtime_error("Error: could not write serialized data to the stream.");
+    }
+    used_ = 0;
+}
+
+template <typename T>
+void BinaryWriter::write(const T &value)
+{
+    using namespace serialization_detail;
+    if constexpr (std::is_same<T, bool>::value)
+    {
+        _writeUnsigned(value ? 1 : 0, 1);
+    }
+    else if constexpr (std::is_floating_point<T>::value)
+    {
+        static_assert(sizeof(T) == 4 || sizeof(T) == 8, "Only 32 and 64-bit floating point values can be serialized.");
+        if constexpr (sizeof(T) == 4)
+        {
+            uint32_t bits;
+            std::memcpy(&bits, &value, 4);
+            _writeUnsigned(bits, 4);
+        }
+        else
+        {
+            uint64_t bits;
+            std::memcpy(&bits, &value, 8);
+            _writeUnsigned(bits, 8);
+        }
+    }
+    else if constexpr (std::is_integral<T>::value || std::is_enum<T>::value)
+    {
+        _writeUnsigned((uint64_t)value, sizeof(T));
+    }
+    else if constexpr (std::is_same<T, std::string>::value)
+    {
+        writeSize(value.size());
+        _append(value.data(), value.size());
+    }
+    else if constexpr (IsPair<T>::value)
+    {
+        write(value.first);
+        write(value.second);
+    }
+    else if constexpr (HasSerialize<T>::value)
+    {
+        value.serialize(*this);
+    }
+    else
+    {
+        static_assert(std::is_trivially_copyable<T>::value,
+                      "This type needs serialize(BinaryWriter &) const and deserialize(BinaryReader &) members.");
+        _append(&value, sizeof(T));
+    }
+}
+
+template <typename T>
+void BinaryWriter::writeArray(const T *values, size_t count)
+{
+    if constexpr (serialization_detail::IsBulkCopyable<T>::value)
+    {
+        _append(values, count * sizeof(T));
+    }
+    else
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            write(values[i]);
+        }
+    }
+}
+
+inline bool BinaryReader::_refill()
+{
+    if (!stream_)
+    {
+        return false;
+    }
+    stream_->read(buffer_.data(), (std::streamsize)buffer_.size());
+    size_t got = (size_t)stream_->gcount();
+    cursor_ = buffer_.data();
+    end_ = buffer_.data() + got;
+    return got > 0;
+}
+
+inline void BinaryReader::_take(void *data, size_t bytes)
+{
+    char *target = static_cast<char *>(data);
+    while (bytes > 0)
+    {
+        if (cursor_ == end_ && !_refill())
+        {
+            throw std::runtime_error("Error: serialized data ended unexpectedly.");
+        }
+        size_t chunk = (size_t)(end_ - cursor_) < bytes ? (size_t)(end_ - cursor_) : bytes;
+        std::memcpy(target, cursor_, chunk);
+        cursor_ += chunk;
+        target += chunk;
+        bytes -= chunk;
+    }
+}
+
+template <typename T>
+void BinaryReader::read(T &value)
+{
+    using namespace serialization_detail;
+    if constexpr (std::is_same<T, bool>::value)
+    {
+        value = _readUnsigned(1) != 0;
+    }
+    else if constexpr (std::is_floating_point<T>::value)
+    {
+        static_assert(sizeof(T) == 4 || sizeof(T) == 8, "Only 32 and 64-bit floating point values can be serialized.");
+        if constexpr (sizeof(T) == 4)
+        {
+            uint32_t bits = (uint32_t)_readUnsigned(4);
+            std::memcpy(&value, &bits, 4);
+        }
+        else
+        {
+            uint64_t bits = _readUnsigned(8);
+            std::memcpy(&value, &bits, 8);
+        }
+    }
+    else if constexpr (std::is_integral<T>::value || std::is_enum<T>::value)
+    {
+        value = (T)_readUnsigned(sizeof(T));
+    }
+    else if constexpr (std::is_same<T, std::string>::value)
+    {
+        size_t size = readSize();
+        value.clear();
+        // Grow with the data actually present rather than trusting the size.
+        char chunk[4096];
+        while (size > 0)
+        {
+            size_t part = size < sizeof(chunk) ? size : sizeof(chunk);
+            _take(chunk, part);
+            value.append(chunk, part);
+            size -= part;
+        }
+    }
+    else if constexpr (IsPair<T>::value)
+    {
+        read(value.first);
+        read(value.second);
+    }
+    else if constexpr (HasSerialize<T>::value)
+    {
+        value.deserialize(*this);
+    }
+    else
+    {
+        static_assert(std::is_trivially_copyable<T>::value,
+                      "This type needs serialize(BinaryWriter &) const and deserialize(BinaryReader &) members.");
+        _take(&value, sizeof(T));
+    }
+}
+
+template <typename T>
+void BinaryReader::readArray(T *values, size_t count)
+{
+    if constexpr (serialization_detail::IsBulkCopyable<T>::value)
+    {
+        _take(values, count * sizeof(T));
+    }
+    else
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            read(values[i]);
+        }
+    }
+}
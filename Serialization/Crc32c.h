@@ -0,0 +1,94 @@
+/**
+ * @file Crc32c.h
+ * @author Kofi Boateng
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ *
+ */
+
+#pragma once
+#include <cstddef> // for size_t
+#include <cstdint> // for fixed width integers
+#include <cstring> // for memcpy
+#if defined(__SSE4_2__)
+#include <nmmintrin.h> // for the crc32 instructions
+#endif
+
+// crc32c computes the CRC-32C (Castagnoli) checksum that guards records written to disk, such as the
+// entries of a write-ahead log, so that a torn or corrupted record is detected instead of replayed.
+// With SSE4.2 the processor's crc32 instruction consumes eight bytes at a time. Without it, a
+// slice-by-8 table lookup does the same eight bytes with eight table reads. Both give the same result,
+// so checksums written by one build verify in the other. A checksum can be computed in pieces by
+// passing the result of one call as crc to the next.
+
+namespace crc32c_detail
+{
+    // Eight tables of 256 entries: tables[0] is the classic byte table and
+    // tables[k][b] advances b by k further zero bytes.
+    struct Tables
+    {
+        uint32_t entries[8][256];
+
+        Tables()
+        {
+            for (uint32_t byte = 0; byte < 256; byte++)
+            {
+                uint32_t crc = byte;
+                for (int bit = 0; bit < 8; bit++)
+                {
+                    crc = (crc >> 1) ^ (0x82f63b78u & (0u - (crc & 1u)));
+                }
+                entries[0][byte] = crc;
+            }
+            for (uint32_t byte = 0; byte < 256; byte++)
+            {
+                for (int k = 1; k < 8; k++)
+                {
+                    uint32_t previous = entries[k - 1][byte];
+                    entries[k][byte] = (previous >> 8) ^ entries[0][previous & 0xff];
+                }
+            }
+        }
+    };
+
+    inline const Tables &tables()
+    {
+        static const Tables instance;
+        return instance;
+    }
+}
+
+// Returns the CRC-32C of bytes bytes at data, continuing from crc.
+inline uint32_t crc32c(const void *data, size_t bytes, uint32_t crc = 0)
+{
+    const unsigned char *cursor = static_cast<const unsigned char *>(data);
+    crc = ~crc;
+#if defined(__SSE4_2__) && defined(__x86_64__)
+    uint64_t wide = crc;
+    for (; bytes >= 8; bytes -= 8, cursor += 8)
+    {
+        uint64_t word;
+        std::memcpy(&word, cursor, 8);
+        wide = _mm_crc32_u64(wide, word);
+    }
+    crc = (uint32_t)wide;
+    for (; bytes > 0; bytes--, cursor++)
+    {
+        crc = _mm_crc32_u8(crc, *cursor);
+    }
+#else
+    const uint32_t(*table)[256] = crc32c_detail::tables().entries;
+    for (; bytes >= 8; bytes -= 8, cursor += 8)
+    {
+        uint32_t low = crc ^ ((uint32_t)cursor[0] | (uint32_t)cursor[1] << 8 | (uint32_t)cursor[2] << 16 | (uint32_t)cursor[3] << 24);
+        crc = table[7][low & 0xff] ^ table[6][(low >> 8) & 0xff] ^ table[5][(low >> 16) & 0xff] ^ table[4][low >> 24] ^
+              table[3][cursor[4]] ^ table[2][cursor[5]] ^ table[1][cursor[6]] ^ table[0][cursor[7]];
+    }
+    for (; bytes > 0; bytes--, cursor++)
+    {
+        crc = (crc >> 8) ^ table[0][(crc ^ *cursor) & 0xff];
+    }
+#endif
+    return ~crc;
+}
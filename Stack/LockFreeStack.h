@@ -0,0 +1,94 @@
+/**
+ * @file LockFreeStack.h
+ * @author Kofi Boateng
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ *
+ */
+
+#pragma once
+#include <atomic> // for the head pointer
+#include "../Concurrency/EpochReclamation.h"
+
+// This is a lock-free version of Stack.h (a Treiber stack) that any number of threads can push to and pop
+// from at once. The stack is the same linked list of nodes, but the head is an atomic pointer and both
+// push and pop swing it with a compare-and-swap, retrying if another thread changed it in between.
+// The hard part is freeing a popped node: another thread may have read the same head a moment earlier
+// and be about to read its next pointer. Popped nodes are therefore retired to an EpochDomain
+// (EpochReclamation.h) and only deleted once no thread can still hold them. This also prevents the ABA
+// problem, since a node's address cannot be reused while a thread that read it is still pinned.
+// Every thread that pops needs an EpochDomain::Handle on the stack's domain.
+
+template <typename T>
+class LockFreeStack
+{
+private:
+    struct Node
+    {
+        Node *next;
+        T data;
+
+        Node(const T &dataArg) : next(nullptr), data(dataArg) {}
+    };
+
+    std::atomic<Node *> head_;
+    EpochDomain &domain_;
+
+public:
+    // Pushes a copy of dataArg. Pushing never reads another node, so it needs no handle.
+    void push(const T &dataArg)
+    {
+        Node *node = new Node(dataArg);
+        node->next = head_.load(std::memory_order_relaxed);
+        while (!head_.compare_exchange_weak(node->next, node, std::memory_order_release, std::memory_order_relaxed))
+        {
+        }
+    }
+
+    // Pops the top element into out. Returns false if the stack was empty.
+    // handle must belong to the calling thread and to this stack's domain.
+    bool pop(EpochDomain::Handle &handle, T &out)
+    {
+        Node *node;
+        {
+            EpochDomain::Guard guard(handle);
+            node = head_.load(std::memory_order_acquire);
+            while (node && !head_.compare_exchange_weak(node, node->next, std::memory_order_acquire,
+                                                        std::memory_order_acquire))
+            {
+            }
+            if (!node)
+            {
+                return false;
+            }
+            out = node->data;
+        }
+        handle.retire(node);
+        return true;
+    }
+
+    // Returns whether the stack was empty at the moment of the call.
+    bool isEmpty() const { return head_.load(std::memory_order_acquire) == nullptr; }
+
+    // Returns the domain popped nodes are retired to.
+    EpochDomain &domain() { return domain_; }
+
+    // Creates an empty stack that retires nodes to domain.
+    explicit LockFreeStack(EpochDomain &domain) : head_(nullptr), domain_(domain) {}
+
+    LockFreeStack(const LockFreeStack &) = delete;
+    LockFreeStack &operator=(const LockFreeStack &) = delete;
+
+    // No other thread may use the stack while it is destroyed.
+    ~LockFreeStack()
+    {
+        Node *node = head_.load(std::memory_order_relaxed);
+        while (node)
+        {
+            Node *next = node->next;
+            delete node;
+            node = next;
+        }
+    }
+};
@@ -11,6 +11,8 @@
 #include <iostream>  // for cout & cerr
 #include <stdexcept> // for runtime_error
 #include <ostream>   // for::ostream
+#include <utility>   // for swap
+#include "../Serialization/BinaryStream.h"
 
 // This is an implementation of a Stack.
 // The class Stack will have access to a pointer to
@@ -118,6 +120,11 @@ public:
     // This is used by the operator<< overload defined in this file.
     std::ostream &print(std::ostream &os) const;
 
+    // Writes the stack to writer (Refer to Serialization/BinaryStream.h).
+    void serialize(BinaryWriter &writer) const;
+    // Replaces the contents of the stack with one read from reader.
+    void deserialize(BinaryReader &reader);
+
     // Default Stack Destructor
     Stack() : head_(nullptr), size_(0) {}
 
@@ -208,8 +215,8 @@ void Stack<T>::pop()
 
         head_ = oldHead->next;
 
-        delete oldHead;
         oldHead->next = nullptr;
+        delete oldHead;
     }
     size_--;
 }
@@ -249,3 +256,52 @@ T &Stack<T>::peek() const
 
     return head_->data;
 }
+
+template <typename T>
+void Stack<T>::serialize(BinaryWriter &writer) const
+{
+    // Written from the top down.
+    writer.beginObject("STCK", 1);
+    writer.writeSize(size_);
+    for (const Node *cur = head_; cur; cur = cur->next)
+    {
+        writer.write(cur->data);
+    }
+}
+
+template <typename T>
+void Stack<T>::deserialize(BinaryReader &reader)
+{
+    reader.beginObject("STCK", 1);
+    size_t count = reader.readSize();
+    // Decode into a separate stack, so a truncated or corrupt stream leaves
+    // this one as it was.
+    Stack<T> fresh;
+    // The elements arrive top first, so each new node goes below the last.
+    Node *bottom = nullptr;
+    for (size_t i = 0; i < count; i++)
+    {
+        Node *node = new Node();
+        try
+        {
+            reader.read(node->data);
+        }
+        catch (...)
+        {
+            delete node;
+            throw;
+        }
+        if (bottom)
+        {
+            bottom->next = node;
+        }
+        else
+        {
+            fresh.head_ = node;
+        }
+        bottom = node;
+        fresh.size_++;
+    }
+    std::swap(head_, fresh.head_);
+    std::swap(size_, fresh.size_);
+}
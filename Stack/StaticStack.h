@@ -0,0 +1,82 @@
+/**
+ * @file StaticStack.h
+ * @author Kofi Boateng
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ *
+ */
+
+#pragma once
+#include <stdexcept> // for runtime_error
+#include <cstddef>   // for size_t
+
+// This is an implementation of a fixed-capacity Stack for loops whose bounds are known at compile time.
+// The N elements live in an array inside the object, so a StaticStack on the stack or inside another
+// object never touches the heap, and every member function is constexpr, so one can be filled and read
+// while the compiler evaluates a constant expression.
+// Pushing onto a full stack throws instead of growing; in a constant expression that is a compile error.
+// T must be default constructible, since the array holds N elements from the start.
+
+template <typename T, size_t N>
+class StaticStack
+{
+    static_assert(N > 0, "StaticStack needs a capacity of at least one element.");
+
+private:
+    T data_[N]{};
+    size_t size_ = 0;
+
+public:
+    // Pushes an element on top of the stack.
+    constexpr void push(const T &value)
+    {
+        if (size_ == N)
+        {
+            throw std::runtime_error("Error: push() called on a full StaticStack.");
+        }
+        data_[size_++] = value;
+    }
+
+    // Removes the top element.
+    constexpr void pop()
+    {
+        if (size_ == 0)
+        {
+            throw std::runtime_error("Error: pop() called on an empty StaticStack.");
+        }
+        size_--;
+    }
+
+    constexpr T &top()
+    {
+        if (size_ == 0)
+        {
+            throw std::runtime_error("Error: top() called on an empty StaticStack.");
+        }
+        return data_[size_ - 1];
+    }
+
+    constexpr const T &top() const
+    {
+        if (size_ == 0)
+        {
+            throw std::runtime_error("Error: top() called on an empty StaticStack.");
+        }
+        return data_[size_ - 1];
+    }
+
+    // Returns the i-th element from the bottom. Does not check bounds.
+    constexpr T &operator[](size_t i) { return data_[i]; }
+    constexpr const T &operator[](size_t i) const { return data_[i]; }
+
+    constexpr size_t size() const { return size_; }
+    static constexpr size_t capacity() { return N; }
+    constexpr bool isEmpty() const { return size_ == 0; }
+    constexpr bool isFull() const { return size_ == N; }
+
+    // Removes every element.
+    constexpr void clear() { size_ = 0; }
+
+    constexpr StaticStack() = default;
+};
@@ -0,0 +1,147 @@
+/**
+ * @file TwoStackAggregator.h
+ * @author Kofi Boateng
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ *
+ */
+
+#pragma once
+#include <stdexcept> // for runtime_error
+#include "Stack.h"
+
+// This is an implementation of a Two-Stack Aggregator, a FIFO sliding window that answers "combine every
+// element in the window" in O(1) for any associative operation, with amortized O(1) push and pop. Unlike
+// MonotonicDeque it is not limited to min and max: sums, products, gcds, matrix products or any other
+// monoid work, and the operation does not have to be commutative or invertible.
+// The window is a queue made of two Stacks. New elements are pushed on the back stack, and a running
+// aggregate of everything on it is kept alongside. The front stack holds the oldest elements with the
+// oldest on top, and every entry stores the aggregate of itself and everything below it, so the top
+// entry's aggregate covers the whole front stack. The window's aggregate is then the front stack's top
+// aggregate combined with the back stack's running aggregate.
+// When the front stack runs out, pop() moves the back stack over one element at a time, which reverses
+// the order and computes the suffix aggregates on the way. Every element is moved at most once.
+// Monoid is a policy class with static identity() and combine(a, b). SumMonoid and GcdMonoid are
+// provided, and the SumAggregate, MinAggregate and MaxAggregate policies in SegmentTree.h also fit.
+
+// Monoid for sums.
+template <typename T>
+struct SumMonoid
+{
+    static T identity() { return T(); }
+    static T combine(const T &a, const T &b) { return a + b; }
+};
+
+// Monoid for greatest common divisors of non-negative integers.
+template <typename T>
+struct GcdMonoid
+{
+    static T identity() { return T(); }
+    static T combine(T a, T b)
+    {
+        while (b != T())
+        {
+            T remainder = a % b;
+            a = b;
+            b = remainder;
+        }
+        return a;
+    }
+};
+
+template <typename T, typename Monoid>
+class TwoStackAggregator
+{
+private:
+    // A front stack element with the aggregate of itself and every element
+    // newer than it on the front stack.
+    struct Entry
+    {
+        T value;
+        T aggregate;
+    };
+
+    Stack<Entry> front_;
+    Stack<T> back_;
+    T backAggregate_;
+
+    // Moves the back stack onto the front stack, oldest element on top.
+    void _flip()
+    {
+        while (!back_.isEmpty())
+        {
+            const T &value = back_.top();
+            T aggregate = front_.isEmpty() ? value : Monoid::combine(value, front_.top().aggregate);
+            front_.push(Entry{value, aggregate});
+            back_.pop();
+        }
+        backAggregate_ = Monoid::identity();
+    }
+
+public:
+    // Appends value to the back of the window.
+    void push(const T &value)
+    {
+        back_.push(value);
+        backAggregate_ = Monoid::combine(backAggregate_, value);
+    }
+
+    // Removes the oldest value from the window.
+    void pop()
+    {
+        if (front_.isEmpty())
+        {
+            if (back_.isEmpty())
+            {
+                throw std::runtime_error("Error: pop() called on an empty TwoStackAggregator.");
+            }
+            _flip();
+        }
+        front_.pop();
+    }
+
+    // Returns the oldest value in the window.
+    const T &front()
+    {
+        if (front_.isEmpty())
+        {
+            if (back_.isEmpty())
+            {
+                throw std::runtime_error("Error: front() called on an empty TwoStackAggregator.");
+            }
+            _flip();
+        }
+        return front_.top().value;
+    }
+
+    // Returns every value in the window combined oldest to newest, or the
+    // identity if the window is empty.
+    T query() const
+    {
+        if (front_.isEmpty())
+        {
+            return backAggregate_;
+        }
+        return Monoid::combine(front_.top().aggregate, backAggregate_);
+    }
+
+    // Returns the number of values in the window.
+    int size() const { return front_.size() + back_.size(); }
+
+    // Returns a boolean signifying if the window is empty or not.
+    bool isEmpty() const { return front_.isEmpty() && back_.isEmpty(); }
+
+    // Removes every value.
+    void clear()
+    {
+        front_.clear();
+        back_.clear();
+        backAggregate_ = Monoid::identity();
+    }
+
+    TwoStackAggregator() : backAggregate_(Monoid::identity()) {}
+
+    TwoStackAggregator(const TwoStackAggregator &) = delete;
+    TwoStackAggregator &operator=(const TwoStackAggregator &) = delete;
+};
@@ -0,0 +1,188 @@
+/**
+ * @file FMIndex.h
+ * @author Kofi Boateng
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ *
+ */
+
+#pragma once
+#include <stdexcept> // for runtime_error
+#include <cstdint>   // for fixed width integers
+#include <string>    // text and patterns
+#include <vector>    // counts and samples
+#include <algorithm> // for sort
+#include <utility>   // for pair and move
+#include "../SuffixArray/SuffixArray.h"
+#include "../../Trees/WaveletTree/WaveletTree.h"
+#include "../../Succinct/BitVector.h"
+
+// This is an implementation of an FM-index, a compressed full-text index that counts the occurrences of
+// a pattern of length m in O(m log sigma) time, no matter how large the text is, and does not keep the
+// text itself. It stores the Burrows-Wheeler transform (BWT) of the text: the character before each
+// suffix, listed in suffix array order, with a sentinel smaller than every byte marking the end.
+// Backward search matches the pattern one character at a time from its end. The rows of suffixes that
+// start with the matched part always form one range [lo, hi), and prepending character c maps it to
+// [C[c] + rank(c, lo), C[c] + rank(c, hi)), where C[c] is the number of characters smaller than c. The
+// BWT is held in a WaveletTree, so each step is two O(log sigma) rank queries.
+// locate() also needs the positions of the matches. Every sampleRate-th text position is kept, marked
+// in a BitVector over the rows, and the LF mapping (which moves from a suffix to the one starting one
+// character earlier) is walked from each match until a sampled row is reached, at most sampleRate - 1
+// steps. A larger sampleRate uses less memory and makes locate() slower.
+// The index is built from a SuffixArray, which is freed once the BWT and samples have been taken.
+
+template <typename Index = uint32_t>
+class FMIndex
+{
+private:
+    // The BWT alphabet: 0 is the sentinel and byte b is stored as b + 1.
+    static const int alphabetSize = 257;
+
+    size_t rows_;
+    Index sampleRate_;
+    WaveletTree<uint16_t> bwt_;
+
+    // counts_[c] is the number of symbols smaller than c.
+    std::vector<uint64_t> counts_;
+
+    // Rows whose suffix starts at a multiple of sampleRate_, and those starts
+    // in row order.
+    BitVector sampled_;
+    std::vector<Index> samples_;
+
+    // Steps from row to the row of the suffix one character earlier.
+    size_t _lf(size_t row) const
+    {
+        uint16_t symbol = bwt_.access(row);
+        return (size_t)counts_[symbol] + bwt_.rank(symbol, row);
+    }
+
+    // Builds the BWT of the text the suffix array was built over.
+    static std::vector<uint16_t> _transform(const SuffixArray<Index> &suffixArray);
+
+public:
+    // Returns the range of rows whose suffixes start with pattern.
+    std::pair<size_t, size_t> equalRange(const std::string &pattern) const
+    {
+        // Row 0 is the sentinel suffix, which only the empty pattern matches.
+        size_t lo = pattern.empty() ? 1 : 0;
+        size_t hi = rows_;
+        for (size_t i = pattern.size(); i > 0 && lo < hi; i--)
+        {
+            uint16_t symbol = (uint16_t)((unsigned char)pattern[i - 1] + 1);
+            lo = (size_t)counts_[symbol] + bwt_.rank(symbol, lo);
+            hi = (size_t)counts_[symbol] + bwt_.rank(symbol, hi);
+        }
+        if (hi < lo)
+        {
+            hi = lo;
+        }
+        return std::make_pair(lo, hi);
+    }
+
+    // Returns the number of occurrences of pattern in the text.
+    size_t count(const std::string &pattern) const
+    {
+        std::pair<size_t, size_t> range = equalRange(pattern);
+        return range.second - range.first;
+    }
+
+    // Returns whether pattern occurs anywhere in the text.
+    bool contains(const std::string &pattern) const { return count(pattern) > 0; }
+
+    // Returns the start positions of every occurrence of pattern, in
+    // increasing order of position.
+    std::vector<Index> locate(const std::string &pattern) const
+    {
+        std::pair<size_t, size_t> range = equalRange(pattern);
+        std::vector<Index> positions;
+        positions.reserve(range.second - range.first);
+        for (size_t row = range.first; row < range.second; row++)
+        {
+            size_t current = row;
+            Index steps = 0;
+            while (!sampled_.get(current))
+            {
+                current = _lf(current);
+                steps++;
+            }
+            positions.push_back(samples_[sampled_.rank1(current)] + steps);
+        }
+        std::sort(positions.begin(), positions.end());
+        return positions;
+    }
+
+    // Returns the length of the indexed text.
+    size_t size() const { return rows_ - 1; }
+
+    // Returns the memory used by the index, in bytes.
+    size_t memoryBytes() const
+    {
+        return bwt_.memoryBytes() + counts_.size() * sizeof(uint64_t) + sampled_.memoryBytes() +
+               samples_.size() * sizeof(Index);
+    }
+
+    // Indexes text, keeping every sampleRate-th position for locate().
+    explicit FMIndex(std::string text, Index sampleRate = 32) : FMIndex(SuffixArray<Index>(std::move(text)), sampleRate) {}
+
+    // Indexes the text of an existing suffix array.
+    explicit FMIndex(const SuffixArray<Index> &suffixArray, Index sampleRate = 32)
+        : rows_(suffixArray.size() + 1), sampleRate_(sampleRate), bwt_(_transform(suffixArray), alphabetSize),
+          counts_(alphabetSize + 1, 0), sampled_(rows_)
+    {
+        if (sampleRate_ == 0)
+        {
+            throw std::runtime_error("Error: FMIndex sample rate must be positive.");
+        }
+
+        // The sentinel row comes first, then the suffixes in sorted order.
+        const std::string &text = suffixArray.text();
+        counts_[1] = 1;
+        for (size_t i = 0; i < text.size(); i++)
+        {
+            counts_[(unsigned char)text[i] + 2]++;
+        }
+        for (int c = 1; c <= alphabetSize; c++)
+        {
+            counts_[c] += counts_[c - 1];
+        }
+
+        Index n = (Index)suffixArray.size();
+        if (n % sampleRate_ == 0)
+        {
+            sampled_.set(0);
+            samples_.push_back(n);
+        }
+        for (size_t row = 1; row < rows_; row++)
+        {
+            Index position = suffixArray[row - 1];
+            if (position % sampleRate_ == 0)
+            {
+                sampled_.set(row);
+                samples_.push_back(position);
+            }
+        }
+        sampled_.build();
+    }
+};
+
+// ===================================================================================
+// Implementation Section
+// ===================================================================================
+
+template <typename Index>
+std::vector<uint16_t> FMIndex<Index>::_transform(const SuffixArray<Index> &suffixArray)
+{
+    const std::string &text = suffixArray.text();
+    std::vector<uint16_t> bwt(text.size() + 1);
+
+    // The sentinel suffix is preceded by the last character.
+    bwt[0] = text.empty() ? 0 : (uint16_t)((unsigned char)text.back() + 1);
+    for (size_t row = 1; row < bwt.size(); row++)
+    {
+        Index position = suffixArray[row - 1];
+        bwt[row] = position == 0 ? 0 : (uint16_t)((unsigned char)text[position - 1] + 1);
+    }
+    return bwt;
+}
@@ -0,0 +1,344 @@
+/**
+ * @file SuffixArray.h
+ * @author Kofi Boateng
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ *
+ */
+
+#pragma once
+#include <stdexcept> // for runtime_error
+#include <cstdint>   // for fixed width integers
+#include <string>    // text and patterns
+#include <vector>    // suffix and LCP arrays
+#include <algorithm> // for fill and copy
+#include <utility>   // for pair and move
+
+// This is an implementation of a Suffix Array: the starting positions of all suffixes of a text, sorted
+// lexicographically. Every substring of the text is a prefix of some suffix, and suffixes sharing a
+// prefix are adjacent, so finding a pattern anywhere in the text (not only at the start, as in
+// PrefixTree) is a binary search over the array, O(m log n) for a pattern of length m.
+// The array is built in O(n) with SA-IS (Nong, Zhang and Chan). Suffixes are classified as S (smaller
+// than the next suffix) or L (larger); the leftmost S suffixes of each run (LMS suffixes) are sorted
+// first, and the order of every other suffix is then induced from them in two linear scans. If two LMS
+// substrings are equal, the LMS suffixes are renamed to a shorter string and sorted recursively, which
+// at most halves the input at each level.
+// computeLcp() uses Kasai's algorithm to find, in O(n), the length of the longest common prefix of
+// every pair of neighbouring suffixes; that is the basis of repeat and distinct-substring queries.
+// Index sets the width of positions: uint32_t handles texts up to 4 GB at 4 bytes per character, and
+// uint64_t anything larger. Construction needs about 3 Index-sized words per character at its peak.
+
+template <typename Index = uint32_t>
+class SuffixArray
+{
+private:
+    // Marks an empty slot during induced sorting.
+    static constexpr Index none = (Index)-1;
+
+    std::string text_;
+    std::vector<Index> suffixes_;
+
+    // Reads the bytes of the text as unsigned symbols.
+    struct ByteSequence
+    {
+        const std::string &text;
+
+        Index operator[](size_t i) const { return (Index)(unsigned char)text[i]; }
+        size_t size() const { return text.size(); }
+    };
+
+    // Returns the suffix array of s, whose symbols are all in [0, upper].
+    template <typename Sequence>
+    static std::vector<Index> _saIs(const Sequence &s, Index upper);
+
+    // Returns text_.compare(position, length, pattern) without going past the end.
+    int _compareSuffix(Index position, const std::string &pattern) const
+    {
+        return text_.compare((size_t)position, pattern.size(), pattern);
+    }
+
+public:
+    // Returns the text the array was built over.
+    const std::string &text() const { return text_; }
+
+    // Returns the sorted suffix start positions.
+    const std::vector<Index> &suffixes() const { return suffixes_; }
+
+    // Returns the start of the i-th smallest suffix.
+    Index operator[](size_t i) const { return suffixes_[i]; }
+
+    // Returns the number of suffixes, the length of the text.
+    size_t size() const { return suffixes_.size(); }
+
+    // Returns the range [first, last) of suffixes that start with pattern.
+    std::pair<size_t, size_t> equalRange(const std::string &pattern) const;
+
+    // Returns the number of occurrences of pattern in the text.
+    size_t count(const std::string &pattern) const
+    {
+        std::pair<size_t, size_t> range = equalRange(pattern);
+        return range.second - range.first;
+    }
+
+    // Returns whether pattern occurs anywhere in the text.
+    bool contains(const std::string &pattern) const { return count(pattern) > 0; }
+
+    // Returns the start positions of every occurrence of pattern, in
+    // increasing order of position.
+    std::vector<Index> locate(const std::string &pattern) const
+    {
+        std::pair<size_t, size_t> range = equalRange(pattern);
+        std::vector<Index> positions(suffixes_.begin() + range.first, suffixes_.begin() + range.second);
+        std::sort(positions.begin(), positions.end());
+        return positions;
+    }
+
+    // Returns the LCP array: lcp[i] is the length of the longest common prefix
+    // of suffixes i - 1 and i, and lcp[0] is 0. O(n) time (Kasai et al.).
+    std::vector<Index> computeLcp() const;
+
+    // Builds the suffix array of text in O(n). The text is moved in and kept
+    // for searching.
+    explicit SuffixArray(std::string text) : text_(std::move(text))
+    {
+        if ((uint64_t)text_.size() >= (uint64_t)none)
+        {
+            throw std::runtime_error("Error: Text is too long for the SuffixArray index type.");
+        }
+        suffixes_ = _saIs(ByteSequence{text_}, (Index)255);
+    }
+};
+
+// ===================================================================================
+// Implementation Section
+// ===================================================================================
+
+template <typename Index>
+template <typename Sequence>
+std::vector<Index> SuffixArray<Index>::_saIs(const Sequence &s, Index upper)
+{
+    Index n = (Index)s.size();
+    if (n == 0)
+    {
+        return std::vector<Index>();
+    }
+    if (n == 1)
+    {
+        return std::vector<Index>(1, 0);
+    }
+    if (n == 2)
+    {
+        return s[0] < s[1] ? std::vector<Index>{0, 1} : std::vector<Index>{1, 0};
+    }
+
+    // Classify every suffix as S (true) or L (false). The last one is L.
+    std::vector<Index> sa(n);
+    std::vector<bool> isS(n, false);
+    for (Index i = n - 1; i > 0; i--)
+    {
+        isS[i - 1] = s[i - 1] == s[i] ? isS[i] : s[i - 1] < s[i];
+    }
+
+    // Bucket boundaries: sumL[c] is where the L suffixes starting with c
+    // begin, and sumS[c] where the S suffixes starting with c begin.
+    std::vector<Index> sumL((size_t)upper + 1, 0);
+    std::vector<Index> sumS((size_t)upper + 1, 0);
+    for (Index i = 0; i < n; i++)
+    {
+        if (!isS[i])
+        {
+            sumS[s[i]]++;
+        }
+        else if (s[i] < upper)
+        {
+            sumL[s[i] + 1]++;
+        }
+    }
+    for (Index c = 0; c <= upper; c++)
+    {
+        sumS[c] += sumL[c];
+        if (c < upper)
+        {
+            sumL[c + 1] += sumS[c];
+        }
+    }
+
+    // Places the LMS suffixes in lms order at the ends of their buckets, then
+    // induces L suffixes left to right and S suffixes right to left.
+    std::vector<Index> bucket((size_t)upper + 1);
+    auto induce = [&](const std::vector<Index> &lms)
+    {
+        std::fill(sa.begin(), sa.end(), none);
+        std::copy(sumS.begin(), sumS.end(), bucket.begin());
+        for (Index d : lms)
+        {
+            if (d != n)
+            {
+                sa[bucket[s[d]]++] = d;
+            }
+        }
+        std::copy(sumL.begin(), sumL.end(), bucket.begin());
+        sa[bucket[s[n - 1]]++] = n - 1;
+        for (Index i = 0; i < n; i++)
+        {
+            Index v = sa[i];
+            if (v != none && v >= 1 && !isS[v - 1])
+            {
+                sa[bucket[s[v - 1]]++] = v - 1;
+            }
+        }
+        std::copy(sumL.begin(), sumL.end(), bucket.begin());
+        for (Index i = n; i > 0; i--)
+        {
+            Index v = sa[i - 1];
+            if (v != none && v >= 1 && isS[v - 1])
+            {
+                sa[--bucket[s[v - 1] + 1]] = v - 1;
+            }
+        }
+    };
+
+    // lmsIndex[i] is the rank of LMS position i in text order, or none.
+    std::vector<Index> lmsIndex((size_t)n + 1, none);
+    std::vector<Index> lms;
+    for (Index i = 1; i < n; i++)
+    {
+        if (!isS[i - 1] && isS[i])
+        {
+            lmsIndex[i] = (Index)lms.size();
+            lms.push_back(i);
+        }
+    }
+    Index m = (Index)lms.size();
+    induce(lms);
+
+    if (m > 0)
+    {
+        // The LMS positions in the order induce() sorted their substrings.
+        std::vector<Index> sortedLms;
+        sortedLms.reserve(m);
+        for (Index v : sa)
+        {
+            if (lmsIndex[v] != none)
+            {
+                sortedLms.push_back(v);
+            }
+        }
+
+        // Name each LMS substring; equal substrings share a name.
+        std::vector<Index> reduced(m);
+        Index names = 0;
+        reduced[lmsIndex[sortedLms[0]]] = 0;
+        for (Index i = 1; i < m; i++)
+        {
+            Index l = sortedLms[i - 1];
+            Index r = sortedLms[i];
+            Index endL = lmsIndex[l] + 1 < m ? lms[lmsIndex[l] + 1] : n;
+            Index endR = lmsIndex[r] + 1 < m ? lms[lmsIndex[r] + 1] : n;
+            bool same = true;
+            if (endL - l != endR - r)
+            {
+                same = false;
+            }
+            else
+            {
+                while (l < endL && s[l] == s[r])
+                {
+                    l++;
+                    r++;
+                }
+                if (l == n || s[l] != s[r])
+                {
+                    same = false;
+                }
+            }
+            if (!same)
+            {
+                names++;
+            }
+            reduced[lmsIndex[sortedLms[i]]] = names;
+        }
+
+        // Sort the reduced string recursively, which orders the LMS suffixes.
+        std::vector<Index> reducedSa = _saIs(reduced, names);
+        for (Index i = 0; i < m; i++)
+        {
+            sortedLms[i] = lms[reducedSa[i]];
+        }
+        induce(sortedLms);
+    }
+    return sa;
+}
+
+template <typename Index>
+std::pair<size_t, size_t> SuffixArray<Index>::equalRange(const std::string &pattern) const
+{
+    // First suffix whose prefix is not less than pattern.
+    size_t lo = 0;
+    size_t hi = suffixes_.size();
+    while (lo < hi)
+    {
+        size_t mid = lo + (hi - lo) / 2;
+        if (_compareSuffix(suffixes_[mid], pattern) < 0)
+        {
+            lo = mid + 1;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+    size_t first = lo;
+
+    // First suffix whose prefix is greater than pattern.
+    hi = suffixes_.size();
+    while (lo < hi)
+    {
+        size_t mid = lo + (hi - lo) / 2;
+        if (_compareSuffix(suffixes_[mid], pattern) <= 0)
+        {
+            lo = mid + 1;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+    return std::make_pair(first, lo);
+}
+
+template <typename Index>
+std::vector<Index> SuffixArray<Index>::computeLcp() const
+{
+    size_t n = suffixes_.size();
+    std::vector<Index> rank(n);
+    for (size_t i = 0; i < n; i++)
+    {
+        rank[suffixes_[i]] = (Index)i;
+    }
+
+    // Walking the suffixes in text order, the common prefix with the previous
+    // suffix in sorted order shrinks by at most one per step.
+    std::vector<Index> lcp(n, 0);
+    size_t h = 0;
+    for (size_t i = 0; i < n; i++)
+    {
+        if (rank[i] == 0)
+        {
+            h = 0;
+            continue;
+        }
+        size_t j = suffixes_[rank[i] - 1];
+        while (i + h < n && j + h < n && text_[i + h] == text_[j + h])
+        {
+            h++;
+        }
+        lcp[rank[i]] = (Index)h;
+        if (h > 0)
+        {
+            h--;
+        }
+    }
+    return lcp;
+}
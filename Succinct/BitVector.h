@@ -0,0 +1,320 @@
+/**
+ * @file BitVector.h
+ * @author Kofi Boateng
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ *
+ */
+
+#pragma once
+#include <stdexcept> // for runtime_error
+#include <cstdint>   // for fixed width integers
+#include <vector>    // word and count arrays
+#if defined(__BMI2__)
+#include <immintrin.h> // for pdep
+#endif
+
+// This is an implementation of a Bit Vector with constant-time rank and select, the basic block of
+// succinct data structures such as WaveletTree.h and EliasFano.h. rank1(i) counts the set bits before
+// position i, and select1(k) finds the position of the k-th set bit (counting from 0). The bits are packed
+// 64 to a word, and after the bits are written, build() stores the number of set bits before every
+// 512-bit block. A rank query is then one stored count plus the popcount of at most eight words in the
+// same cache line, for an overhead of 64 bits per 512 (12.5%).
+// For select, build() splits the set bits (and separately the clear bits, for select0) into groups of
+// 512. A group spanning 2^16 positions or more is sparse, and the position of each of its bits is
+// stored outright, which costs at most half a bit per bit of the vector. For a shorter group only the
+// position of its first bit is stored. A query starts there, so fewer than 2^16 positions lie ahead of
+// it: it steps over at most 128 block counts to the right block, finds the word by popcount, and then
+// selects inside the word with broadword arithmetic: the bytes are popcounted in parallel, the byte
+// holding the bit is found with one subtraction over all eight prefix sums, and only that byte is
+// scanned. With BMI2 the in-word step is a single pdep instead.
+// The vector is written first (set) and queried afterwards; changing bits after build() requires
+// calling it again.
+
+class BitVector
+{
+private:
+    static const size_t wordsPerBlock = 8;
+
+    size_t size_;
+    std::vector<uint64_t> words_;
+
+    // Set bits before each block, then with a sentinel at the end.
+    std::vector<uint64_t> blockRanks_;
+
+    // Bits per select group, and the span from which a group's positions are
+    // stored outright.
+    static const size_t selectSample = 512;
+    static const uint64_t longSpan = 1ULL << 16;
+
+    // The select index over the set bits, or over the clear bits.
+    struct Inventory
+    {
+        // Per group: the position of its first bit, or for a long group
+        // -1 - the index of its first bit in positions.
+        std::vector<int64_t> groups;
+        // Every bit of the long groups.
+        std::vector<uint64_t> positions;
+    };
+
+    Inventory selectOnes_;
+    Inventory selectZeros_;
+    size_t ones_;
+
+    // Clear bits before block b.
+    uint64_t _blockZeros(size_t b) const { return (uint64_t)b * wordsPerBlock * 64 - blockRanks_[b]; }
+
+    // Word w of the set bits, or of the clear bits below size_.
+    uint64_t _indexedWord(size_t w, bool ones) const
+    {
+        uint64_t bits = ones ? words_[w] : ~words_[w];
+        if (w + 1 == words_.size())
+        {
+            bits &= (1ULL << (size_ & 63)) - 1;
+        }
+        return bits;
+    }
+
+    // Fills inventory for the set bits, or the clear bits.
+    void _buildInventory(Inventory &inventory, bool ones);
+
+    // Looks up the k-th bit in inventory. Returns true with its position when
+    // its group is long, and false with the position of the group's first bit
+    // otherwise.
+    static bool _lookup(const Inventory &inventory, size_t k, size_t &position)
+    {
+        int64_t group = inventory.groups[k / selectSample];
+        if (group < 0)
+        {
+            position = (size_t)inventory.positions[(size_t)(-1 - group) + k % selectSample];
+            return true;
+        }
+        position = (size_t)group;
+        return false;
+    }
+
+    // Returns the position of the k-th set bit of word, which must have more than k.
+    static int _selectInWord(uint64_t word, int k)
+    {
+#if defined(__BMI2__)
+        return __builtin_ctzll(_pdep_u64(1ULL << k, word));
+#else
+        const uint64_t ones8 = 0x0101010101010101ULL;
+        const uint64_t high8 = 0x8080808080808080ULL;
+        // Popcount of each byte, then the running totals up to each byte.
+        uint64_t counts = word - ((word >> 1) & 0x5555555555555555ULL);
+        counts = (counts & 0x3333333333333333ULL) + ((counts >> 2) & 0x3333333333333333ULL);
+        counts = (counts + (counts >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+        uint64_t prefix = counts * ones8;
+        // A byte's high bit survives when its running total is at most k, so
+        // counting them gives the index of the byte holding the bit.
+        uint64_t atMostK = (((uint64_t)k * ones8) | high8) - prefix;
+        int shift = __builtin_popcountll(atMostK & high8) * 8;
+        int remaining = k - (int)(((prefix << 8) >> shift) & 0xFF);
+        uint64_t byte = (word >> shift) & 0xFF;
+        for (int i = 0; i < remaining; i++)
+        {
+            byte &= byte - 1;
+        }
+        return shift + __builtin_ctzll(byte);
+#endif
+    }
+
+public:
+    // Sets bit i to value.
+    void set(size_t i, bool value = true)
+    {
+        if (value)
+        {
+            words_[i >> 6] |= 1ULL << (i & 63);
+        }
+        else
+        {
+            words_[i >> 6] &= ~(1ULL << (i & 63));
+        }
+    }
+
+    // Returns bit i.
+    bool get(size_t i) const { return (words_[i >> 6] >> (i & 63)) & 1; }
+    bool operator[](size_t i) const { return get(i); }
+
+    // Prepares the rank counts and select samples. Call after the last set().
+    void build();
+
+    // Returns the number of set bits in [0, i). Requires build().
+    size_t rank1(size_t i) const
+    {
+        size_t word = i >> 6;
+        size_t block = word / wordsPerBlock;
+        uint64_t count = blockRanks_[block];
+        for (size_t w = block * wordsPerBlock; w < word; w++)
+        {
+            count += (uint64_t)__builtin_popcountll(words_[w]);
+        }
+        if (i & 63)
+        {
+            count += (uint64_t)__builtin_popcountll(words_[word] & ((1ULL << (i & 63)) - 1));
+        }
+        return (size_t)count;
+    }
+
+    // Returns the number of clear bits in [0, i).
+    size_t rank0(size_t i) const { return i - rank1(i); }
+
+    // Returns the position of the k-th set bit, counting from 0. Requires build().
+    size_t select1(size_t k) const;
+
+    // Returns the position of the k-th clear bit, counting from 0. Requires build().
+    size_t select0(size_t k) const;
+
+    // Returns the number of set bits. Requires build().
+    size_t ones() const { return ones_; }
+
+    // Returns the number of bits.
+    size_t size() const { return size_; }
+
+    // Returns the memory used by the bits, the rank counts and the select inventories, in bytes.
+    size_t memoryBytes() const
+    {
+        size_t bytes = (words_.size() + blockRanks_.size()) * sizeof(uint64_t);
+        for (const Inventory *inventory : {&selectOnes_, &selectZeros_})
+        {
+            bytes += (inventory->groups.size() + inventory->positions.size()) * sizeof(uint64_t);
+        }
+        return bytes;
+    }
+
+    // Creates a vector of n clear bits.
+    explicit BitVector(size_t n = 0) : size_(n), words_(n / 64 + 1, 0), ones_(0) {}
+};
+
+// ===================================================================================
+// Implementation Section
+// ===================================================================================
+
+inline void BitVector::build()
+{
+    // Only bits below size_ count, so clear any set past the end.
+    words_.back() &= (1ULL << (size_ & 63)) - 1;
+
+    size_t blocks = (words_.size() + wordsPerBlock - 1) / wordsPerBlock;
+    blockRanks_.assign(blocks + 1, 0);
+    uint64_t ones = 0;
+    for (size_t b = 0; b < blocks; b++)
+    {
+        blockRanks_[b] = ones;
+        for (size_t w = b * wordsPerBlock; w < (b + 1) * wordsPerBlock && w < words_.size(); w++)
+        {
+            ones += (uint64_t)__builtin_popcountll(words_[w]);
+        }
+    }
+    blockRanks_[blocks] = ones;
+    ones_ = (size_t)ones;
+    _buildInventory(selectOnes_, true);
+    _buildInventory(selectZeros_, false);
+}
+
+inline void BitVector::_buildInventory(Inventory &inventory, bool ones)
+{
+    // The position of the first bit of every group.
+    std::vector<uint64_t> firsts;
+    uint64_t count = 0;
+    for (size_t w = 0; w < words_.size(); w++)
+    {
+        uint64_t bits = _indexedWord(w, ones);
+        uint64_t wordCount = (uint64_t)__builtin_popcountll(bits);
+        while (firsts.size() * selectSample < count + wordCount)
+        {
+            firsts.push_back(w * 64 + (uint64_t)_selectInWord(bits, (int)(firsts.size() * selectSample - count)));
+        }
+        count += wordCount;
+    }
+
+    inventory.groups.clear();
+    inventory.positions.clear();
+    for (size_t g = 0; g < firsts.size(); g++)
+    {
+        uint64_t first = firsts[g];
+        uint64_t end = g + 1 < firsts.size() ? firsts[g + 1] : (uint64_t)size_;
+        if (end - first < longSpan)
+        {
+            inventory.groups.push_back((int64_t)first);
+            continue;
+        }
+        inventory.groups.push_back(-1 - (int64_t)inventory.positions.size());
+        for (size_t w = (size_t)(first >> 6); w * 64 < end; w++)
+        {
+            uint64_t bits = _indexedWord(w, ones);
+            if (w == (size_t)(first >> 6))
+            {
+                bits &= ~0ULL << (first & 63);
+            }
+            for (; bits != 0 && w * 64 + (uint64_t)__builtin_ctzll(bits) < end; bits &= bits - 1)
+            {
+                inventory.positions.push_back(w * 64 + (uint64_t)__builtin_ctzll(bits));
+            }
+        }
+    }
+}
+
+inline size_t BitVector::select1(size_t k) const
+{
+    if (k >= ones_)
+    {
+        throw std::runtime_error("Error: BitVector select1 is past the last set bit.");
+    }
+    size_t position;
+    if (_lookup(selectOnes_, k, position))
+    {
+        return position;
+    }
+    size_t block = position / (wordsPerBlock * 64);
+    while (blockRanks_[block + 1] <= k)
+    {
+        block++;
+    }
+    size_t remaining = k - (size_t)blockRanks_[block];
+    size_t w = block * wordsPerBlock;
+    for (;; w++)
+    {
+        size_t count = (size_t)__builtin_popcountll(words_[w]);
+        if (remaining < count)
+        {
+            break;
+        }
+        remaining -= count;
+    }
+    return w * 64 + (size_t)_selectInWord(words_[w], (int)remaining);
+}
+
+inline size_t BitVector::select0(size_t k) const
+{
+    if (k >= size_ - ones_)
+    {
+        throw std::runtime_error("Error: BitVector select0 is past the last clear bit.");
+    }
+    size_t position;
+    if (_lookup(selectZeros_, k, position))
+    {
+        return position;
+    }
+    size_t block = position / (wordsPerBlock * 64);
+    size_t blocks = blockRanks_.size() - 1;
+    while (block + 1 < blocks && _blockZeros(block + 1) <= k)
+    {
+        block++;
+    }
+    size_t remaining = k - (size_t)_blockZeros(block);
+    size_t w = block * wordsPerBlock;
+    for (;; w++)
+    {
+        size_t count = (size_t)__builtin_popcountll(~words_[w]);
+        if (remaining < count)
+        {
+            break;
+        }
+        remaining -= count;
+    }
+    return w * 64 + (size_t)_selectInWord(~words_[w], (int)remaining);
+}
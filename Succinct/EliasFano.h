@@ -0,0 +1,180 @@
+/**
+ * @file EliasFano.h
+ * @author Kofi Boateng
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ *
+ */
+
+#pragma once
+#include <stdexcept> // for runtime_error
+#include <cstdint>   // for fixed width integers
+#include <vector>    // input values and low bits
+#include "BitVector.h"
+
+// This is an implementation of Elias-Fano encoding for a static, sorted sequence of integers, such as a
+// posting list of document ids. n values below a universe u take about 2 + log2(u / n) bits each,
+// within 2 bits per element of the information-theoretic minimum, and unlike delta or varint coding any
+// element can be read directly without decoding the ones before it. That makes it a compressed
+// replacement for a frozen BinarySearchTree<int> or a sorted array searched by binary search.
+// Each value is split into its lowBits_ low bits and the remaining high part. The low bits are packed
+// back to back in a plain array. The high parts are written in unary into a BitVector: the i-th value
+// sets bit high + i, so the high part of value i is select1(i) - i. The bit vector has n + u / 2^lowBits_
+// bits, about 2n, and choosing lowBits_ = floor(log2(u / n)) balances the two halves.
+// nextGEQ(x) finds the first value >= x. select0(high(x) - 1) jumps to the first value that shares x's
+// high part or exceeds it, and only the values in that bucket (about two on average) are compared, so
+// a skip costs O(1) on average however far ahead x is. List intersection is built on this operation.
+
+class EliasFano
+{
+private:
+    size_t size_;
+    uint64_t universe_;
+    int lowBits_;
+
+    std::vector<uint64_t> lows_;
+    BitVector highs_;
+
+    uint64_t _low(size_t i) const
+    {
+        if (lowBits_ == 0)
+        {
+            return 0;
+        }
+        size_t bit = i * (size_t)lowBits_;
+        size_t word = bit >> 6;
+        int offset = (int)(bit & 63);
+        uint64_t value = lows_[word] >> offset;
+        if (offset + lowBits_ > 64)
+        {
+            value |= lows_[word + 1] << (64 - offset);
+        }
+        return value & ((1ULL << lowBits_) - 1);
+    }
+
+    void _setLow(size_t i, uint64_t low)
+    {
+        size_t bit = i * (size_t)lowBits_;
+        size_t word = bit >> 6;
+        int offset = (int)(bit & 63);
+        lows_[word] |= low << offset;
+        if (offset + lowBits_ > 64)
+        {
+            lows_[word + 1] |= low >> (64 - offset);
+        }
+    }
+
+    // Returns value i given the position of its bit in highs_.
+    uint64_t _value(size_t i, size_t highPosition) const
+    {
+        return ((uint64_t)(highPosition - i) << lowBits_) | _low(i);
+    }
+
+public:
+    // Returns the i-th value.
+    uint64_t operator[](size_t i) const { return get(i); }
+
+    uint64_t get(size_t i) const
+    {
+        if (i >= size_)
+        {
+            throw std::runtime_error("Error: EliasFano index is out of range.");
+        }
+        return _value(i, highs_.select1(i));
+    }
+
+    // Returns the index of the first value >= x, or size() if there is none.
+    size_t nextGEQ(uint64_t x) const
+    {
+        if (size_ == 0 || x >= universe_)
+        {
+            return size_;
+        }
+        uint64_t high = x >> lowBits_;
+
+        // The values with a smaller high part end at the (high - 1)-th 0.
+        size_t position = high == 0 ? 0 : highs_.select0((size_t)high - 1) + 1;
+        size_t i = position - (size_t)high;
+        for (; i < size_; position++)
+        {
+            if (!highs_.get(position))
+            {
+                continue;
+            }
+            if (_value(i, position) >= x)
+            {
+                return i;
+            }
+            i++;
+        }
+        return size_;
+    }
+
+    // Returns whether x is in the sequence.
+    bool contains(uint64_t x) const
+    {
+        size_t i = nextGEQ(x);
+        return i < size_ && get(i) == x;
+    }
+
+    // Calls callback(uint64_t) on every value in order, decoding sequentially.
+    template <typename Callback>
+    void forEach(Callback callback) const
+    {
+        size_t position = 0;
+        for (size_t i = 0; i < size_; position++)
+        {
+            if (highs_.get(position))
+            {
+                callback(_value(i, position));
+                i++;
+            }
+        }
+    }
+
+    // Returns the number of values.
+    size_t size() const { return size_; }
+
+    // Returns a boolean signifying if the sequence is empty or not.
+    bool isEmpty() const { return size_ == 0; }
+
+    // Returns the memory used by the encoding, in bytes.
+    size_t memoryBytes() const { return lows_.size() * sizeof(uint64_t) + highs_.memoryBytes(); }
+
+    // Encodes values, which must be sorted in non-decreasing order.
+    explicit EliasFano(const std::vector<uint64_t> &values) : size_(values.size()), universe_(0), lowBits_(0)
+    {
+        for (size_t i = 1; i < size_; i++)
+        {
+            if (values[i] < values[i - 1])
+            {
+                throw std::runtime_error("Error: EliasFano values must be sorted.");
+            }
+        }
+        if (size_ > 0)
+        {
+            universe_ = values.back() + 1;
+            if (universe_ == 0)
+            {
+                throw std::runtime_error("Error: EliasFano values must be below 2^64 - 1.");
+            }
+        }
+        while (size_ > 0 && lowBits_ < 63 && (universe_ >> (lowBits_ + 1)) >= size_)
+        {
+            lowBits_++;
+        }
+
+        lows_.assign(size_ * (size_t)lowBits_ / 64 + 2, 0);
+        highs_ = BitVector(size_ + (size_t)(universe_ >> lowBits_) + 1);
+        for (size_t i = 0; i < size_; i++)
+        {
+            if (lowBits_ > 0)
+            {
+                _setLow(i, values[i] & ((1ULL << lowBits_) - 1));
+            }
+            highs_.set((size_t)(values[i] >> lowBits_) + i);
+        }
+        highs_.build();
+    }
+};
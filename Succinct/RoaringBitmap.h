@@ -0,0 +1,705 @@
+/**
+ * @file RoaringBitmap.h
+ * @author Kofi Boateng
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ *
+ */
+
+#pragma once
+#include <cstdint>   // for fixed width integers
+#include <vector>    // keys and containers
+#include <algorithm> // for lower_bound and merges
+#include <utility>   // for move
+#include <iterator>  // for back_inserter
+#if defined(__AVX2__)
+#include <immintrin.h> // for AVX2 word operations
+#endif
+
+// This is an implementation of a Roaring Bitmap, a compressed set of 32-bit integers. Storing an ID set
+// in a HashTable<int, bool> or an AVLBinaryTree<int> costs a node and a few pointers per element; a
+// Roaring bitmap usually needs 2 bytes per element or less, and its set operations work on whole
+// machine words at a time.
+// A value is split into its upper 16 bits, the key, and its lower 16 bits. Values sharing a key go in
+// the same container, and the keys are kept sorted alongside their containers. A container is one of:
+//   Array  - a sorted array of up to 4096 16-bit values (2 bytes each),
+//   Bitmap - 65536 bits in 1024 words (8 KB, whatever the count), used above 4096 values,
+//   Run    - sorted [start, start + length] runs, for long consecutive stretches.
+// Array and bitmap containers switch into each other automatically as values are added and removed.
+// Run containers are only created by runOptimize(), which picks the smallest of the three encodings for
+// every container; a run container that is modified or combined is first expanded back.
+// Union, intersection and difference walk the two key lists in step and combine matching containers:
+// two bitmaps are combined word by word (four words per AVX2 instruction when available), an array and
+// a bitmap by testing or setting the array's bits, and two arrays by a merge, or by galloping when one
+// is much smaller than the other. Every container keeps its cardinality, so cardinality() is a sum over
+// the containers.
+
+class RoaringBitmap
+{
+private:
+    // Largest array container; a bitmap holding this many values is as big.
+    static const uint32_t arrayLimit = 4096;
+    static const size_t bitmapWords = 1024;
+
+    enum class Kind : uint8_t
+    {
+        Array,
+        Bitmap,
+        Run
+    };
+
+    // The values [start, start + length].
+    struct Run
+    {
+        uint16_t start;
+        uint16_t length;
+    };
+
+    struct Container
+    {
+        Kind kind = Kind::Array;
+        uint32_t cardinality = 0;
+        std::vector<uint16_t> values; // Array
+        std::vector<uint64_t> words;  // Bitmap
+        std::vector<Run> runs;        // Run
+    };
+
+    std::vector<uint16_t> keys_;
+    std::vector<Container> containers_;
+
+    enum class Operation
+    {
+        And,
+        Or,
+        AndNot
+    };
+
+    // Returns the position of key in keys_, or where it would be inserted.
+    size_t _find(uint16_t key) const { return std::lower_bound(keys_.begin(), keys_.end(), key) - keys_.begin(); }
+
+    static bool _testBit(const std::vector<uint64_t> &words, uint16_t low) { return (words[low >> 6] >> (low & 63)) & 1; }
+
+    static bool _contains(const Container &container, uint16_t low);
+
+    // Converts an array or run container to a bitmap.
+    static void _toBitmap(Container &container);
+
+    // Converts a bitmap or run container to an array.
+    static void _toArray(Container &container);
+
+    // Turns a run container back into an array or bitmap.
+    static void _expand(Container &container)
+    {
+        if (container.kind != Kind::Run)
+        {
+            return;
+        }
+        if (container.cardinality <= arrayLimit)
+        {
+            _toArray(container);
+        }
+        else
+        {
+            _toBitmap(container);
+        }
+    }
+
+    // Turns a bitmap that has become small back into an array.
+    static void _shrink(Container &container)
+    {
+        if (container.kind == Kind::Bitmap && container.cardinality <= arrayLimit)
+        {
+            _toArray(container);
+        }
+    }
+
+    // Combines two bitmaps word by word into out, returning the number of set bits.
+    template <Operation Op>
+    static uint32_t _combineWords(const uint64_t *a, const uint64_t *b, uint64_t *out);
+
+    // Combines two containers with the same key.
+    template <Operation Op>
+    static Container _combine(const Container &a, const Container &b);
+
+    template <Operation Op>
+    static Container _combineArrays(const std::vector<uint16_t> &a, const std::vector<uint16_t> &b);
+
+    // Applies Op to every key of both bitmaps.
+    template <Operation Op>
+    static RoaringBitmap _apply(const RoaringBitmap &a, const RoaringBitmap &b);
+
+public:
+    // Adds value. Returns false if it was already present.
+    bool add(uint32_t value);
+
+    // Removes value. Returns false if it was not present.
+    bool remove(uint32_t value);
+
+    // Returns whether value is in the set.
+    bool contains(uint32_t value) const
+    {
+        uint16_t key = (uint16_t)(value >> 16);
+        size_t i = _find(key);
+        return i < keys_.size() && keys_[i] == key && _contains(containers_[i], (uint16_t)value);
+    }
+
+    // Returns the number of values in the set.
+    uint64_t cardinality() const
+    {
+        uint64_t total = 0;
+        for (const Container &container : containers_)
+        {
+            total += container.cardinality;
+        }
+        return total;
+    }
+
+    // Returns a boolean signifying if the set is empty or not.
+    bool isEmpty() const { return keys_.empty(); }
+
+    // Removes every value.
+    void clear()
+    {
+        keys_.clear();
+        containers_.clear();
+    }
+
+    // Calls callback(uint32_t) on every value in increasing order.
+    template <typename Callback>
+    void forEach(Callback callback) const;
+
+    // Returns the values in increasing order.
+    std::vector<uint32_t> toVector() const
+    {
+        std::vector<uint32_t> result;
+        result.reserve((size_t)cardinality());
+        forEach([&result](uint32_t value)
+                { result.push_back(value); });
+        return result;
+    }
+
+    // Re-encodes every container as whichever of array, bitmap or runs is smallest.
+    void runOptimize();
+
+    // Returns the memory used by the containers' contents, in bytes.
+    size_t memoryBytes() const
+    {
+        size_t bytes = keys_.size() * (sizeof(uint16_t) + sizeof(Container));
+        for (const Container &container : containers_)
+        {
+            bytes += container.values.size() * sizeof(uint16_t) + container.words.size() * sizeof(uint64_t) +
+                     container.runs.size() * sizeof(Run);
+        }
+        return bytes;
+    }
+
+    RoaringBitmap &operator|=(const RoaringBitmap &other)
+    {
+        *this = _apply<Operation::Or>(*this, other);
+        return *this;
+    }
+
+    RoaringBitmap &operator&=(const RoaringBitmap &other)
+    {
+        *this = _apply<Operation::And>(*this, other);
+        return *this;
+    }
+
+    RoaringBitmap &operator-=(const RoaringBitmap &other)
+    {
+        *this = _apply<Operation::AndNot>(*this, other);
+        return *this;
+    }
+
+    // Union.
+    friend RoaringBitmap operator|(const RoaringBitmap &a, const RoaringBitmap &b) { return _apply<Operation::Or>(a, b); }
+
+    // Intersection.
+    friend RoaringBitmap operator&(const RoaringBitmap &a, const RoaringBitmap &b) { return _apply<Operation::And>(a, b); }
+
+    // Difference: the values of a that are not in b.
+    friend RoaringBitmap operator-(const RoaringBitmap &a, const RoaringBitmap &b) { return _apply<Operation::AndNot>(a, b); }
+
+    RoaringBitmap() {}
+};
+
+// ===================================================================================
+// Implementation Section
+// ===================================================================================
+
+inline bool RoaringBitmap::_contains(const Container &container, uint16_t low)
+{
+    switch (container.kind)
+    {
+    case Kind::Array:
+        return std::binary_search(container.values.begin(), container.values.end(), low);
+    case Kind::Bitmap:
+        return _testBit(container.words, low);
+    default:
+    {
+        // The last run starting at or before low.
+        auto it = std::upper_bound(container.runs.begin(), container.runs.end(), low,
+                                   [](uint16_t value, const Run &run)
+                                   { return value < run.start; });
+        if (it == container.runs.begin())
+        {
+            return false;
+        }
+        --it;
+        return (uint32_t)low <= (uint32_t)it->start + it->length;
+    }
+    }
+}
+
+inline void RoaringBitmap::_toBitmap(Container &container)
+{
+    std::vector<uint64_t> words(bitmapWords, 0);
+    if (container.kind == Kind::Array)
+    {
+        for (uint16_t low : container.values)
+        {
+            words[low >> 6] |= 1ULL << (low & 63);
+        }
+    }
+    else if (container.kind == Kind::Run)
+    {
+        for (const Run &run : container.runs)
+        {
+            for (uint32_t low = run.start; low <= (uint32_t)run.start + run.length; low++)
+            {
+                words[low >> 6] |= 1ULL << (low & 63);
+            }
+        }
+    }
+    else
+    {
+        return;
+    }
+    container.words.swap(words);
+    container.values = std::vector<uint16_t>();
+    container.runs = std::vector<Run>();
+    container.kind = Kind::Bitmap;
+}
+
+inline void RoaringBitmap::_toArray(Container &container)
+{
+    std::vector<uint16_t> values;
+    values.reserve(container.cardinality);
+    if (container.kind == Kind::Bitmap)
+    {
+        for (size_t w = 0; w < bitmapWords; w++)
+        {
+            uint64_t word = container.words[w];
+            while (word)
+            {
+                values.push_back((uint16_t)(w * 64 + __builtin_ctzll(word)));
+                word &= word - 1;
+            }
+        }
+    }
+    else if (container.kind == Kind::Run)
+    {
+        for (const Run &run : container.runs)
+        {
+            for (uint32_t low = run.start; low <= (uint32_t)run.start + run.length; low++)
+            {
+                values.push_back((uint16_t)low);
+            }
+        }
+    }
+    else
+    {
+        return;
+    }
+    container.values.swap(values);
+    container.words = std::vector<uint64_t>();
+    container.runs = std::vector<Run>();
+    container.kind = Kind::Array;
+}
+
+inline bool RoaringBitmap::add(uint32_t value)
+{
+    uint16_t key = (uint16_t)(value >> 16);
+    uint16_t low = (uint16_t)value;
+    size_t i = _find(key);
+    if (i == keys_.size() || keys_[i] != key)
+    {
+        keys_.insert(keys_.begin() + i, key);
+        containers_.insert(containers_.begin() + i, Container());
+    }
+    Container &container = containers_[i];
+    _expand(container);
+
+    if (container.kind == Kind::Array)
+    {
+        auto it = std::lower_bound(container.values.begin(), container.values.end(), low);
+        if (it != container.values.end() && *it == low)
+        {
+            return false;
+        }
+        container.values.insert(it, low);
+        container.cardinality++;
+        if (container.cardinality > arrayLimit)
+        {
+            _toBitmap(container);
+        }
+        return true;
+    }
+
+    uint64_t &word = container.words[low >> 6];
+    uint64_t bit = 1ULL << (low & 63);
+    if (word & bit)
+    {
+        return false;
+    }
+    word |= bit;
+    container.cardinality++;
+    return true;
+}
+
+inline bool RoaringBitmap::remove(uint32_t value)
+{
+    uint16_t key = (uint16_t)(value >> 16);
+    uint16_t low = (uint16_t)value;
+    size_t i = _find(key);
+    if (i == keys_.size() || keys_[i] != key || !_contains(containers_[i], low))
+    {
+        return false;
+    }
+    Container &container = containers_[i];
+    _expand(container);
+
+    if (container.kind == Kind::Array)
+    {
+        container.values.erase(std::lower_bound(container.values.begin(), container.values.end(), low));
+    }
+    else
+    {
+        container.words[low >> 6] &= ~(1ULL << (low & 63));
+    }
+    container.cardinality--;
+    _shrink(container);
+
+    if (container.cardinality == 0)
+    {
+        keys_.erase(keys_.begin() + i);
+        containers_.erase(containers_.begin() + i);
+    }
+    return true;
+}
+
+template <typename Callback>
+void RoaringBitmap::forEach(Callback callback) const
+{
+    for (size_t i = 0; i < keys_.size(); i++)
+    {
+        uint32_t high = (uint32_t)keys_[i] << 16;
+        const Container &container = containers_[i];
+        if (container.kind == Kind::Array)
+        {
+            for (uint16_t low : container.values)
+            {
+                callback(high | low);
+            }
+        }
+        else if (container.kind == Kind::Bitmap)
+        {
+            for (size_t w = 0; w < bitmapWords; w++)
+            {
+                uint64_t word = container.words[w];
+                while (word)
+                {
+                    callback(high | (uint32_t)(w * 64 + __builtin_ctzll(word)));
+                    word &= word - 1;
+                }
+            }
+        }
+        else
+        {
+            for (const Run &run : container.runs)
+            {
+                for (uint32_t low = run.start; low <= (uint32_t)run.start + run.length; low++)
+                {
+                    callback(high | low);
+                }
+            }
+        }
+    }
+}
+
+inline void RoaringBitmap::runOptimize()
+{
+    for (Container &container : containers_)
+    {
+        _expand(container);
+
+        // Collect the runs of consecutive values.
+        std::vector<Run> runs;
+        auto extend = [&runs](uint16_t low)
+        {
+            if (!runs.empty() && (uint32_t)runs.back().start + runs.back().length + 1 == low)
+            {
+                runs.back().length++;
+            }
+            else
+            {
+                runs.push_back(Run{low, 0});
+            }
+        };
+        if (container.kind == Kind::Array)
+        {
+            for (uint16_t low : container.values)
+            {
+                extend(low);
+            }
+        }
+        else
+        {
+            for (size_t w = 0; w < bitmapWords; w++)
+            {
+                uint64_t word = container.words[w];
+                while (word)
+                {
+                    extend((uint16_t)(w * 64 + __builtin_ctzll(word)));
+                    word &= word - 1;
+                }
+            }
+        }
+
+        size_t runBytes = runs.size() * sizeof(Run);
+        size_t currentBytes = container.kind == Kind::Array ? container.values.size() * sizeof(uint16_t)
+                                                            : bitmapWords * sizeof(uint64_t);
+        if (runBytes < currentBytes)
+        {
+            runs.shrink_to_fit();
+            container.runs.swap(runs);
+            container.values = std::vector<uint16_t>();
+            container.words = std::vector<uint64_t>();
+            container.kind = Kind::Run;
+        }
+    }
+}
+
+template <RoaringBitmap::Operation Op>
+uint32_t RoaringBitmap::_combineWords(const uint64_t *a, const uint64_t *b, uint64_t *out)
+{
+#if defined(__AVX2__)
+    // bitmapWords is a multiple of four, so there is no scalar tail.
+    for (size_t w = 0; w < bitmapWords; w += 4)
+    {
+        __m256i x = _mm256_loadu_si256((const __m256i *)(a + w));
+        __m256i y = _mm256_loadu_si256((const __m256i *)(b + w));
+        __m256i result;
+        if (Op == Operation::And)
+        {
+            result = _mm256_and_si256(x, y);
+        }
+        else if (Op == Operation::Or)
+        {
+            result = _mm256_or_si256(x, y);
+        }
+        else
+        {
+            // andnot computes ~first & second.
+            result = _mm256_andnot_si256(y, x);
+        }
+        _mm256_storeu_si256((__m256i *)(out + w), result);
+    }
+#else
+    for (size_t w = 0; w < bitmapWords; w++)
+    {
+        out[w] = Op == Operation::And ? a[w] & b[w] : Op == Operation::Or ? a[w] | b[w]
+                                                                          : a[w] & ~b[w];
+    }
+#endif
+
+    uint32_t count = 0;
+    for (size_t w = 0; w < bitmapWords; w++)
+    {
+        count += (uint32_t)__builtin_popcountll(out[w]);
+    }
+    return count;
+}
+
+template <RoaringBitmap::Operation Op>
+RoaringBitmap::Container RoaringBitmap::_combineArrays(const std::vector<uint16_t> &a, const std::vector<uint16_t> &b)
+{
+    Container result;
+    std::vector<uint16_t> &out = result.values;
+    if (Op == Operation::Or)
+    {
+        out.reserve(a.size() + b.size());
+        std::set_union(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(out));
+    }
+    else if (Op == Operation::And && (a.size() * 32 < b.size() || b.size() * 32 < a.size()))
+    {
+        // Gallop through the larger array for each value of the smaller one.
+        const std::vector<uint16_t> &small = a.size() < b.size() ? a : b;
+        const std::vector<uint16_t> &large = a.size() < b.size() ? b : a;
+        auto position = large.begin();
+        for (uint16_t low : small)
+        {
+            size_t step = 1;
+            auto bound = position;
+            while (bound != large.end() && *bound < low)
+            {
+                position = bound;
+                bound = (size_t)(large.end() - bound) > step ? bound + step : large.end();
+                step *= 2;
+            }
+            position = std::lower_bound(position, bound, low);
+            if (position == large.end())
+            {
+                break;
+            }
+            if (*position == low)
+            {
+                out.push_back(low);
+            }
+        }
+    }
+    else if (Op == Operation::And)
+    {
+        std::set_intersection(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(out));
+    }
+    else
+    {
+        std::set_difference(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(out));
+    }
+    result.cardinality = (uint32_t)out.size();
+    if (result.cardinality > arrayLimit)
+    {
+        _toBitmap(result);
+    }
+    return result;
+}
+
+template <RoaringBitmap::Operation Op>
+RoaringBitmap::Container RoaringBitmap::_combine(const Container &a, const Container &b)
+{
+    // Run containers are expanded into temporaries first.
+    Container expandedA;
+    Container expandedB;
+    const Container *x = &a;
+    const Container *y = &b;
+    if (a.kind == Kind::Run)
+    {
+        expandedA = a;
+        _expand(expandedA);
+        x = &expandedA;
+    }
+    if (b.kind == Kind::Run)
+    {
+        expandedB = b;
+        _expand(expandedB);
+        y = &expandedB;
+    }
+
+    if (x->kind == Kind::Array && y->kind == Kind::Array)
+    {
+        return _combineArrays<Op>(x->values, y->values);
+    }
+
+    Container result;
+    if (x->kind == Kind::Bitmap && y->kind == Kind::Bitmap)
+    {
+        result.kind = Kind::Bitmap;
+        result.words.resize(bitmapWords);
+        result.cardinality = _combineWords<Op>(x->words.data(), y->words.data(), result.words.data());
+        _shrink(result);
+        return result;
+    }
+
+    // One array and one bitmap.
+    if (Op == Operation::Or)
+    {
+        result = x->kind == Kind::Bitmap ? *x : *y;
+        const std::vector<uint16_t> &values = x->kind == Kind::Array ? x->values : y->values;
+        for (uint16_t low : values)
+        {
+            uint64_t bit = 1ULL << (low & 63);
+            if (!(result.words[low >> 6] & bit))
+            {
+                result.words[low >> 6] |= bit;
+                result.cardinality++;
+            }
+        }
+    }
+    else if (Op == Operation::And || x->kind == Kind::Array)
+    {
+        // Keep the array's values whose bit is set (And) or clear (AndNot).
+        const std::vector<uint16_t> &values = x->kind == Kind::Array ? x->values : y->values;
+        const std::vector<uint64_t> &words = x->kind == Kind::Bitmap ? x->words : y->words;
+        bool keepIfSet = Op == Operation::And;
+        for (uint16_t low : values)
+        {
+            if (_testBit(words, low) == keepIfSet)
+            {
+                result.values.push_back(low);
+            }
+        }
+        result.cardinality = (uint32_t)result.values.size();
+    }
+    else
+    {
+        // Bitmap minus array: clear the array's bits.
+        result = *x;
+        for (uint16_t low : y->values)
+        {
+            uint64_t bit = 1ULL << (low & 63);
+            if (result.words[low >> 6] & bit)
+            {
+                result.words[low >> 6] &= ~bit;
+                result.cardinality--;
+            }
+        }
+        _shrink(result);
+    }
+    return result;
+}
+
+template <RoaringBitmap::Operation Op>
+RoaringBitmap RoaringBitmap::_apply(const RoaringBitmap &a, const RoaringBitmap &b)
+{
+    RoaringBitmap result;
+    size_t i = 0;
+    size_t j = 0;
+    while (i < a.keys_.size() || j < b.keys_.size())
+    {
+        bool hasA = i < a.keys_.size();
+        bool hasB = j < b.keys_.size();
+        if (hasA && (!hasB || a.keys_[i] < b.keys_[j]))
+        {
+            // Only in a.
+            if (Op != Operation::And)
+            {
+                result.keys_.push_back(a.keys_[i]);
+                result.containers_.push_back(a.containers_[i]);
+            }
+            i++;
+        }
+        else if (hasB && (!hasA || b.keys_[j] < a.keys_[i]))
+        {
+            // Only in b.
+            if (Op == Operation::Or)
+            {
+                result.keys_.push_back(b.keys_[j]);
+                result.containers_.push_back(b.containers_[j]);
+            }
+            j++;
+        }
+        else
+        {
+            Container combined = _combine<Op>(a.containers_[i], b.containers_[j]);
+            if (combined.cardinality > 0)
+            {
+                result.keys_.push_back(a.keys_[i]);
+                result.containers_.push_back(std::move(combined));
+            }
+            i++;
+            j++;
+        }
+    }
+    return result;
+}
@@ -0,0 +1,146 @@
+/**
+ * @file AVLTreeTest.cpp
+ * @author Kofi Boateng
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * Build and run: g++ -std=c++17 Tests/AVLTreeTest.cpp -o AVLTreeTest && ./AVLTreeTest
+ *
+ */
+
+#include <algorithm> // for max
+#include <cassert>   // for assert
+#include <iostream>  // for cout
+#include <map>       // reference multiset of values
+#include <sstream>   // to silence the tree's progress output
+#include <vector>    // for collected intervals
+#include "../Trees/AVLTree/AVLTree.h"
+#include "../Trees/IntervalTree/IntervalTree.h"
+
+// Augmentation that counts the nodes of a subtree.
+struct SubtreeSize
+{
+    typedef int Value;
+
+    template <typename Node>
+    static void update(Node *node)
+    {
+        node->augment = 1 + (node->left ? node->left->augment : 0) + (node->right ? node->right->augment : 0);
+    }
+};
+
+typedef AVLBinaryTree<int, SubtreeSize> CountingTree;
+
+// Checks order, heights, balance and the subtree sizes under node, and returns
+// its height.
+static int checkSubtree(const CountingTree::Node *node, const int *low, const int *high)
+{
+    if (!node)
+    {
+        return -1;
+    }
+    assert(!low || *low <= node->data);
+    assert(!high || node->data <= *high);
+    int left = checkSubtree(node->left, low, &node->data);
+    int right = checkSubtree(node->right, &node->data, high);
+    assert(node->height == std::max(left, right) + 1);
+    assert(right - left >= -1 && right - left <= 1);
+    assert(node->augment == 1 + (node->left ? node->left->augment : 0) + (node->right ? node->right->augment : 0));
+    return node->height;
+}
+
+// Random inserts and removes, with duplicates, keep the tree ordered and
+// balanced and its augmentation exact.
+static void testRemoveKeepsTreeBalancedAndAugmented()
+{
+    CountingTree tree;
+    std::map<int, int> reference;
+    unsigned state = 3;
+    for (int step = 0; step < 20000; step++)
+    {
+        state = state * 1103515245u + 12345u;
+        int value = (int)((state >> 16) % 500);
+        if ((state >> 8) % 3 != 0)
+        {
+            tree.insert(value);
+            reference[value]++;
+        }
+        else
+        {
+            tree.remove(value);
+            if (reference.count(value) && --reference[value] == 0)
+            {
+                reference.erase(value);
+            }
+        }
+        if (step % 97 == 0)
+        {
+            checkSubtree(tree.getRoot(), nullptr, nullptr);
+        }
+    }
+    int expected = 0;
+    for (const auto &entry : reference)
+    {
+        expected += entry.second;
+    }
+    checkSubtree(tree.getRoot(), nullptr, nullptr);
+    assert(tree.size() == expected);
+    assert(tree.getRoot()->augment == expected);
+
+    // Removing everything leaves an empty tree.
+    for (const auto &entry : reference)
+    {
+        for (int i = 0; i < entry.second; i++)
+        {
+            tree.remove(entry.first);
+        }
+    }
+    assert(tree.size() == 0 && !tree.getRoot());
+    tree.remove(1);
+    assert(tree.size() == 0);
+}
+
+// IntervalTree removes through the same path and still answers overlap queries.
+static void testIntervalTreeRemove()
+{
+    IntervalTree<int, int> tree;
+    std::vector<std::pair<int, int>> live;
+    for (int i = 0; i < 300; i++)
+    {
+        int low = (i * 37) % 1000;
+        tree.insert(low, low + i % 50, i);
+        live.emplace_back(low, low + i % 50);
+    }
+    for (int i = 0; i < 300; i += 3)
+    {
+        int low = (i * 37) % 1000;
+        assert(tree.remove(low, low + i % 50));
+        live[i] = std::make_pair(-1, -1);
+    }
+    assert(!tree.remove(5000, 5001));
+    assert(tree.size() == 200);
+    for (int point = 0; point < 1100; point += 7)
+    {
+        int found = 0;
+        tree.containing(point, [&found](const Interval<int, int> &)
+                        { found++; });
+        int expected = 0;
+        for (const std::pair<int, int> &interval : live)
+        {
+            expected += interval.first >= 0 && interval.first <= point && point <= interval.second ? 1 : 0;
+        }
+        assert(found == expected);
+    }
+}
+
+int main()
+{
+    // The tree reports every insert and remove on cout.
+    std::ostringstream progress;
+    std::streambuf *console = std::cout.rdbuf(progress.rdbuf());
+    testRemoveKeepsTreeBalancedAndAugmented();
+    testIntervalTreeRemove();
+    std::cout.rdbuf(console);
+    std::cout << "AVLTreeTest passed" << std::endl;
+    return 0;
+}
@@ -0,0 +1,99 @@
+/**
+ * @file BucketQueueTest.cpp
+ * @author Kofi Boateng
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * Build and run: g++ -std=c++17 -pthread Tests/BucketQueueTest.cpp -o BucketQueueTest && ./BucketQueueTest
+ *
+ */
+
+#include <algorithm> // for sort
+#include <cassert>   // for assert
+#include <cstdint>   // for uint32_t
+#include <iostream>  // for cout
+#include <utility>   // for pair
+#include <vector>    // for buckets and edges
+#include "../Heap/BucketQueue.h"
+#include "../Graph/GraphAnalytics.h"
+
+// Monotone priorities with jumps far past the window come out in order, a
+// whole bucket at a time, whether they were stored in the window or beyond it.
+static void testBucketsComeOutInOrder()
+{
+    BucketQueue<int> queue(64);
+    std::vector<std::pair<size_t, int>> expected;
+    unsigned state = 7;
+    size_t current = 0;
+    int item = 0;
+    std::vector<std::pair<size_t, int>> taken;
+    for (int round = 0; round < 2000; round++)
+    {
+        for (int i = 0; i < 5; i++)
+        {
+            state = state * 1103515245u + 12345u;
+            size_t jump = (state >> 16) % 10 == 0 ? (state >> 8) % 100000 : (state >> 16) % 100;
+            queue.insert(current + jump, item);
+            expected.emplace_back(current + jump, item);
+            item++;
+        }
+        size_t next = queue.minPriority();
+        assert(next >= current);
+        assert(queue.bucketSize(next) > 0);
+        std::vector<int> bucket;
+        queue.takeBucket(next, bucket);
+        for (int value : bucket)
+        {
+            taken.emplace_back(next, value);
+        }
+        current = next;
+    }
+    while (!queue.isEmpty())
+    {
+        size_t next = queue.minPriority();
+        std::vector<int> bucket;
+        queue.takeBucket(next, bucket);
+        for (int value : bucket)
+        {
+            taken.emplace_back(next, value);
+        }
+    }
+    assert(queue.minPriority() == (size_t)-1);
+    for (size_t i = 1; i < taken.size(); i++)
+    {
+        assert(taken[i - 1].first <= taken[i].first);
+    }
+    std::sort(expected.begin(), expected.end());
+    std::sort(taken.begin(), taken.end());
+    assert(taken == expected);
+}
+
+// Weights many orders of magnitude above delta neither blow up memory nor
+// overflow the bucket index, and the distances match Dijkstra.
+static void testDeltaSteppingWithHugeWeights()
+{
+    std::vector<CSRGraph<double>::Edge> edges;
+    const int n = 2000;
+    unsigned state = 11;
+    for (int v = 1; v < n; v++)
+    {
+        state = state * 1103515245u + 12345u;
+        edges.push_back({(uint32_t)((state >> 8) % v), (uint32_t)v, (double)((state >> 16) % 1000) * 1e12});
+        edges.push_back({(uint32_t)v, (uint32_t)((state >> 4) % n), 1e300});
+    }
+    CSRGraph<double> graph(n, edges, true, true);
+    std::vector<double> distance = deltaSteppingShortestPaths(graph, 0, 1e-3, 4);
+    ShortestPathResult<double> reference = dijkstra(graph, 0);
+    for (int v = 0; v < n; v++)
+    {
+        assert(distance[v] == reference.distance[v]);
+    }
+}
+
+int main()
+{
+    testBucketsComeOutInOrder();
+    testDeltaSteppingWithHugeWeights();
+    std::cout << "BucketQueueTest passed" << std::endl;
+    return 0;
+}
@@ -0,0 +1,200 @@
+/**
+ * @file CacheTest.cpp
+ * @author Kofi Boateng
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * Build and run: g++ -std=c++17 -O2 -pthread Tests/CacheTest.cpp -o CacheTest && ./CacheTest
+ *
+ */
+
+#include <algorithm> // for upper_bound
+#include <cassert>   // for assert
+#include <chrono>    // for timing
+#include <cmath>     // for pow
+#include <cstdint>   // for fixed width integers
+#include <iostream>  // for cout
+#include <random>    // for the trace
+#include <string>    // for string keys
+#include <thread>    // for the sharded run
+#include <vector>    // for the trace
+#include "../Cache/LRUCache.h"
+#include "../Cache/SLRUCache.h"
+#include "../Cache/TinyLFUCache.h"
+#include "../Cache/ShardedCache.h"
+
+// A key with no std::hash specialization, so it only works where the hasher is passed through.
+struct Point
+{
+    int x;
+    int y;
+
+    bool operator==(const Point &other) const { return x == other.x && y == other.y; }
+    bool operator!=(const Point &other) const { return !(*this == other); }
+};
+
+struct PointHash
+{
+    size_t operator()(const Point &point) const { return (size_t)point.x * 1000003u + (size_t)point.y; }
+};
+
+// A read trace: Zipf(0.99) popularity over a key space, with a scan of keys
+// that are never seen again after every few thousand requests.
+static std::vector<int> makeTrace(int keys, int requests)
+{
+    std::vector<double> cdf(keys);
+    double sum = 0;
+    for (int k = 0; k < keys; k++)
+    {
+        sum += 1.0 / std::pow(k + 1, 0.99);
+        cdf[k] = sum;
+    }
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<double> uniform(0, sum);
+    std::vector<int> trace;
+    int scanKey = keys;
+    for (int i = 0; i < requests; i++)
+    {
+        if (i % 5000 == 4999)
+        {
+            for (int s = 0; s < 2000; s++)
+            {
+                trace.push_back(scanKey++);
+            }
+        }
+        trace.push_back((int)(std::upper_bound(cdf.begin(), cdf.end(), uniform(gen)) - cdf.begin()));
+    }
+    return trace;
+}
+
+// Replays the trace read-through: a miss loads the key into the cache.
+template <typename Cache>
+static double replay(Cache &cache, const std::vector<int> &trace, const char *name)
+{
+    auto start = std::chrono::steady_clock::now();
+    int value;
+    for (int key : trace)
+    {
+        if (!cache.get(key, value))
+        {
+            cache.put(key, key);
+        }
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::cout << name << ": hit rate " << cache.hitRate() << ", " << (trace.size() / seconds / 1e6) << "M requests/s"
+              << std::endl;
+    return cache.hitRate();
+}
+
+static void testEviction()
+{
+    int value;
+    LRUCache<int, int> lru(2);
+    lru.put(1, 1);
+    lru.put(2, 2);
+    assert(lru.get(1, value) && value == 1);
+    lru.put(3, 3);
+    assert(!lru.contains(2) && lru.contains(1) && lru.contains(3));
+    lru.remove(1);
+    assert(lru.size() == 1);
+
+    // A key touched twice is protected from a burst of one-time keys.
+    SLRUCache<int, int> slru(10);
+    slru.put(100, 100);
+    assert(slru.get(100, value));
+    for (int i = 0; i < 50; i++)
+    {
+        slru.put(i, i);
+    }
+    assert(slru.size() == 10 && slru.contains(100));
+
+    TinyLFUCache<std::string, int> tiny(100);
+    for (int i = 0; i < 1000; i++)
+    {
+        tiny.put(std::to_string(i), i);
+    }
+    assert(tiny.size() == 100);
+}
+
+static void testCustomHasher()
+{
+    int value;
+    LRUCache<Point, int, PointHash> lru(4);
+    SLRUCache<Point, int, PointHash> slru(4, PointHash());
+    TinyLFUCache<Point, int, PointHash> tiny(4, PointHash());
+    lru.put(Point{1, 2}, 3);
+    slru.put(Point{1, 2}, 3);
+    tiny.put(Point{1, 2}, 3);
+    assert(lru.get(Point{1, 2}, value) && value == 3);
+    assert(slru.get(Point{1, 2}, value) && value == 3);
+    assert(tiny.get(Point{1, 2}, value) && value == 3);
+
+    ShardedCache<Point, int, PointHash> sharded(64, 4);
+    ShardedCache<Point, int, PointHash, TinyLFUCache<Point, int, PointHash>> shardedTiny(64, 4);
+    for (int i = 0; i < 32; i++)
+    {
+        sharded.put(Point{i, -i}, i);
+        shardedTiny.put(Point{i, -i}, i);
+    }
+    assert(sharded.get(Point{7, -7}, value) && value == 7);
+    assert(shardedTiny.contains(Point{7, -7}));
+}
+
+// TinyLFU keeps the popular keys through the scans, and SLRU keeps some.
+static void testTraceHitRates()
+{
+    std::vector<int> trace = makeTrace(100000, 400000);
+    const int capacity = 2000;
+    LRUCache<int, int> lru(capacity);
+    SLRUCache<int, int> slru(capacity);
+    TinyLFUCache<int, int> tiny(capacity);
+    double lruRate = replay(lru, trace, "LRU");
+    double slruRate = replay(slru, trace, "SLRU");
+    double tinyRate = replay(tiny, trace, "W-TinyLFU");
+    assert(slruRate > lruRate && tinyRate > slruRate);
+}
+
+// Four threads replay the trace against one sharded cache.
+static void testShardedTrace()
+{
+    std::vector<int> trace = makeTrace(100000, 200000);
+    ShardedCache<int, int, std::hash<int>, TinyLFUCache<int, int>> cache(8000, 16);
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; t++)
+    {
+        threads.emplace_back([&cache, &trace, t]()
+                             {
+            int value;
+            for (size_t i = t; i < trace.size(); i += 4)
+            {
+                if (!cache.get(trace[i], value))
+                {
+                    cache.put(trace[i], trace[i]);
+                }
+                else
+                {
+                    assert(value == trace[i]);
+                }
+            } });
+    }
+    for (std::thread &thread : threads)
+    {
+        thread.join();
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    long long total = cache.hits() + cache.misses();
+    assert(total == (long long)trace.size() && cache.size() <= 8000);
+    std::cout << "Sharded W-TinyLFU, 4 threads: hit rate " << (double)cache.hits() / (double)total << ", "
+              << (trace.size() / seconds / 1e6) << "M requests/s" << std::endl;
+}
+
+int main()
+{
+    testEviction();
+    testCustomHasher();
+    testTraceHitRates();
+    testShardedTrace();
+    std::cout << "CacheTest passed" << std::endl;
+    return 0;
+}
@@ -0,0 +1,216 @@
+/**
+ * @file CoroutineTest.cpp
+ * @author Kofi Boateng
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * Build and run: g++ -std=c++20 -O2 -pthread Tests/CoroutineTest.cpp -o CoroutineTest && ./CoroutineTest
+ *
+ */
+
+#include <atomic>    // for sums shared across pool threads
+#include <cassert>   // for assert
+#include <chrono>    // for timing
+#include <iostream>  // for cout
+#include <stdexcept> // for runtime_error
+#include "../Concurrency/Coroutines/Channel.h"
+#include "../Concurrency/Coroutines/Executors.h"
+
+static const int items = 100000;
+
+static Task<int> square(int x) { co_return (int)((unsigned)x * (unsigned)x); }
+
+static Task<> produce(Channel<int> &out, int count)
+{
+    for (int i = 0; i < count; i++)
+    {
+        bool sent = co_await out.enqueue(i);
+        assert(sent);
+    }
+    out.close();
+}
+
+static Task<> squareStage(Channel<int> &in, Channel<int> &out)
+{
+    while (auto value = co_await in.dequeue())
+    {
+        int squared = co_await square(*value);
+        co_await out.enqueue(squared);
+    }
+    out.close();
+}
+
+static Task<> consume(Channel<int> &in, long &sum)
+{
+    while (auto value = co_await in.dequeue())
+    {
+        sum += *value;
+    }
+}
+
+static Task<> ping(Channel<int> &out, Channel<int> &back, int count)
+{
+    for (int i = 0; i < count; i++)
+    {
+        co_await out.enqueue(i);
+        co_await back.dequeue();
+    }
+    out.close();
+}
+
+static Task<> pong(Channel<int> &in, Channel<int> &back)
+{
+    while (auto value = co_await in.dequeue())
+    {
+        co_await back.enqueue(*value);
+    }
+}
+
+static Task<> yieldRepeatedly(int count)
+{
+    for (int i = 0; i < count; i++)
+    {
+        co_await yieldNow();
+    }
+}
+
+static Task<> sendOnes(Channel<int> &out, int count)
+{
+    for (int i = 0; i < count; i++)
+    {
+        co_await out.enqueue(1);
+    }
+}
+
+static Task<> addAll(Channel<int> &in, std::atomic<long> &sum)
+{
+    while (auto value = co_await in.dequeue())
+    {
+        sum += *value;
+    }
+}
+
+static Task<> fail()
+{
+    throw std::runtime_error("Error: task failed.");
+    co_return;
+}
+
+static double secondsSince(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+// A three-stage pipeline over small bounded channels delivers every item,
+// and reports the items per second and the cost of a switch.
+static void testPipeline()
+{
+    {
+        SingleThreadExecutor executor;
+        Channel<int> raw(4);
+        Channel<int> squared(4);
+        long sum = 0;
+        executor.spawn(produce(raw, items));
+        executor.spawn(squareStage(raw, squared));
+        executor.spawn(consume(squared, sum));
+        auto start = std::chrono::steady_clock::now();
+        assert(executor.run() == 0);
+        double seconds = secondsSince(start);
+        long expected = 0;
+        for (long i = 0; i < items; i++)
+        {
+            expected += (int)((unsigned)i * (unsigned)i);
+        }
+        assert(sum == expected);
+        std::cout << "Three-stage pipeline: " << items / seconds << " items/s" << std::endl;
+    }
+    {
+        SingleThreadExecutor executor;
+        Channel<int> out(1);
+        Channel<int> back(1);
+        executor.spawn(ping(out, back, items));
+        executor.spawn(pong(out, back));
+        auto start = std::chrono::steady_clock::now();
+        assert(executor.run() == 0);
+        std::cout << "Ping-pong round trip: " << secondsSince(start) / items * 1e9 << " ns" << std::endl;
+    }
+    {
+        SingleThreadExecutor executor;
+        executor.spawn(yieldRepeatedly(1000000));
+        auto start = std::chrono::steady_clock::now();
+        executor.run();
+        std::cout << "Yield: " << secondsSince(start) / 1000000 * 1e9 << " ns" << std::endl;
+    }
+}
+
+// More receivers than senders on an unbounded channel: run() returns with the
+// receivers still parked, and closing the channel lets them finish.
+static void testParkedReceivers()
+{
+    SingleThreadExecutor executor;
+    Channel<int> channel;
+    std::atomic<long> sum(0);
+    for (int i = 0; i < 2000; i++)
+    {
+        executor.spawn(addAll(channel, sum));
+    }
+    for (int i = 0; i < 1000; i++)
+    {
+        executor.spawn(sendOnes(channel, 10));
+    }
+    executor.run();
+    assert(sum == 10000);
+    channel.close();
+    assert(executor.run() == 0);
+}
+
+// An exception thrown in a task comes out of run().
+static void testTaskException()
+{
+    SingleThreadExecutor executor;
+    executor.spawn(fail());
+    bool thrown = false;
+    try
+    {
+        executor.run();
+    }
+    catch (const std::runtime_error &)
+    {
+        thrown = true;
+    }
+    assert(thrown);
+}
+
+// Senders and receivers on two executors sharing one ThreadPool.
+static void testThreadPoolExecutors()
+{
+    ThreadPool pool(4);
+    ThreadPoolExecutor receivers(pool);
+    ThreadPoolExecutor senders(pool);
+    Channel<int> channel(8);
+    std::atomic<long> sum(0);
+    for (int i = 0; i < 100; i++)
+    {
+        receivers.spawn(addAll(channel, sum));
+    }
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < 50; i++)
+    {
+        senders.spawn(sendOnes(channel, 1000));
+    }
+    senders.join();
+    channel.close();
+    receivers.join();
+    assert(sum == 50000);
+    std::cout << "ThreadPoolExecutor, 4 threads: " << 50000 / secondsSince(start) << " items/s" << std::endl;
+}
+
+int main()
+{
+    testPipeline();
+    testParkedReceivers();
+    testTaskException();
+    testThreadPoolExecutors();
+    std::cout << "CoroutineTest passed" << std::endl;
+    return 0;
+}
@@ -0,0 +1,199 @@
+/**
+ * @file EliasFanoTest.cpp
+ * @author Kofi Boateng
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * Build and run: g++ -std=c++17 -O2 Tests/EliasFanoTest.cpp -o EliasFanoTest && ./EliasFanoTest
+ *
+ */
+
+#include <algorithm> // for sort and lower_bound
+#include <cassert>   // for assert
+#include <chrono>    // for timing
+#include <cstdint>   // for fixed width integers
+#include <iostream>  // for cout
+#include <random>    // for random bits and values
+#include <vector>    // for reference positions
+#include "../Succinct/EliasFano.h"
+
+static std::mt19937_64 gen(9);
+
+// Checks rank and select of a built vector against the bits it was given.
+static void checkBitVector(const BitVector &bits, const std::vector<bool> &expected)
+{
+    std::vector<size_t> ones;
+    std::vector<size_t> zeros;
+    for (size_t i = 0; i < expected.size(); i++)
+    {
+        assert(bits.rank1(i) == ones.size());
+        (expected[i] ? ones : zeros).push_back(i);
+    }
+    assert(bits.ones() == ones.size() && bits.rank1(expected.size()) == ones.size());
+    for (size_t k = 0; k < ones.size(); k++)
+    {
+        assert(bits.select1(k) == ones[k]);
+    }
+    for (size_t k = 0; k < zeros.size(); k++)
+    {
+        assert(bits.select0(k) == zeros[k]);
+    }
+}
+
+// Short vectors of every density, including a clear last bit.
+static void testSmallBitVectors()
+{
+    for (int round = 0; round < 400; round++)
+    {
+        size_t n = gen() % 5000;
+        uint64_t density = gen() % 1000 + 1;
+        BitVector bits(n);
+        std::vector<bool> expected(n);
+        for (size_t i = 0; i < n; i++)
+        {
+            if (gen() % 1000 < density && !(round % 5 == 0 && i == n - 1))
+            {
+                bits.set(i);
+                expected[i] = true;
+            }
+        }
+        bits.build();
+        checkBitVector(bits, expected);
+    }
+}
+
+// Stretches where the set bits are dense alternate with stretches where they
+// are far apart, so both kinds of select group occur for both bit values.
+static void testMixedDensity()
+{
+    const size_t n = 1 << 22;
+    BitVector bits(n);
+    std::vector<bool> expected(n);
+    for (size_t start = 0; start < n; start += 1 << 18)
+    {
+        uint64_t gap = (start >> 18) % 3 == 0 ? 4000 : (start >> 18) % 3 == 1 ? 2 : 1;
+        for (size_t i = start; i < start + (1 << 18); i++)
+        {
+            bool value = gap == 1 ? gen() % 5000 != 0 : gen() % gap == 0;
+            if (value)
+            {
+                bits.set(i);
+                expected[i] = true;
+            }
+        }
+    }
+    bits.build();
+    checkBitVector(bits, expected);
+}
+
+// A few set bits scattered over a long vector with a dense block at each end,
+// where select used to walk every block count in between.
+static void testSparseSelectTime()
+{
+    const size_t n = (size_t)1 << 28;
+    BitVector bits(n);
+    std::vector<size_t> ones;
+    for (size_t i = 0; i < 600; i++)
+    {
+        ones.push_back(i);
+    }
+    for (size_t i = 0; i < 2000; i++)
+    {
+        ones.push_back(1000 + gen() % (n - 2000));
+    }
+    for (size_t i = n - 600; i < n; i++)
+    {
+        ones.push_back(i);
+    }
+    std::sort(ones.begin(), ones.end());
+    ones.erase(std::unique(ones.begin(), ones.end()), ones.end());
+    for (size_t position : ones)
+    {
+        bits.set(position);
+    }
+    bits.build();
+
+    const int queries = 1000000;
+    size_t checksum = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int q = 0; q < queries; q++)
+    {
+        checksum += bits.select1((size_t)(gen() % ones.size()));
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    for (size_t k = 0; k < ones.size(); k++)
+    {
+        assert(bits.select1(k) == ones[k]);
+    }
+    assert(checksum > 0);
+    assert(bits.select0(0) == 600 && bits.select0(n - ones.size() - 1) == n - 601);
+    std::cout << "BitVector select1 on a sparse 2^28-bit vector: " << seconds / queries * 1e9 << " ns/query"
+              << std::endl;
+}
+
+// Access, iteration, nextGEQ and contains against the sorted input, for
+// universes from a little above n up to 2^40.
+static void testEliasFano()
+{
+    for (int round = 0; round < 400; round++)
+    {
+        std::vector<uint64_t> values(gen() % 3000);
+        uint64_t universe = 1 + gen() % (round % 3 == 0 ? (1ULL << 40) : 100000);
+        for (uint64_t &value : values)
+        {
+            value = gen() % universe;
+        }
+        std::sort(values.begin(), values.end());
+        EliasFano encoded(values);
+        assert(encoded.size() == values.size() && encoded.isEmpty() == values.empty());
+        for (size_t i = 0; i < values.size(); i++)
+        {
+            assert(encoded[i] == values[i]);
+        }
+        std::vector<uint64_t> decoded;
+        encoded.forEach([&decoded](uint64_t value)
+                        { decoded.push_back(value); });
+        assert(decoded == values);
+        for (int query = 0; query < 300; query++)
+        {
+            uint64_t x = query % 3 == 0 && !values.empty() ? values[gen() % values.size()] : gen() % (universe + 10);
+            size_t expected = std::lower_bound(values.begin(), values.end(), x) - values.begin();
+            assert(encoded.nextGEQ(x) == expected);
+            assert(encoded.contains(x) == std::binary_search(values.begin(), values.end(), x));
+        }
+    }
+}
+
+// Space and skip speed for a 10M-value posting list over a 2^32 universe.
+static void testPostingList()
+{
+    std::vector<uint64_t> values(10000000);
+    for (uint64_t &value : values)
+    {
+        value = gen() % (1ULL << 32);
+    }
+    std::sort(values.begin(), values.end());
+    EliasFano encoded(values);
+    const int queries = 1000000;
+    size_t checksum = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int q = 0; q < queries; q++)
+    {
+        checksum += encoded.nextGEQ(gen() % (1ULL << 32));
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    assert(checksum > 0 && encoded.nextGEQ(values[values.size() / 2]) <= values.size() / 2);
+    std::cout << "EliasFano: " << 8.0 * encoded.memoryBytes() / values.size() << " bits/value, nextGEQ "
+              << seconds / queries * 1e9 << " ns/query" << std::endl;
+}
+
+int main()
+{
+    testSmallBitVectors();
+    testMixedDensity();
+    testSparseSelectTime();
+    testEliasFano();
+    testPostingList();
+    std::cout << "EliasFanoTest passed" << std::endl;
+    return 0;
+}
@@ -0,0 +1,152 @@
+/**
+ * @file FrozenHashTableTest.cpp
+ * @author Kofi Boateng
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * Build and run: g++ -std=c++17 Tests/FrozenHashTableTest.cpp -o FrozenHashTableTest && ./FrozenHashTableTest
+ *
+ */
+
+#include <cassert>   // for assert
+#include <cstddef>   // for offsetof
+#include <cstdint>   // for fixed width integers
+#include <cstring>   // for memcpy
+#include <cstdio>    // for remove
+#include <fstream>   // for reading and patching saved files
+#include <iostream>  // for cout
+#include <sstream>   // for silencing the table's insert output
+#include <stdexcept> // for runtime_error
+#include <string>    // for file paths
+#include <vector>    // for key lists and file bytes
+#include "../Hashing/PerfectHashing/FrozenHashTable.h"
+
+typedef FrozenHashTable<uint64_t, uint64_t> Frozen;
+
+static const std::string path = "FrozenHashTableTest.bin";
+
+static std::vector<char> readFile(const std::string &file)
+{
+    std::ifstream in(file, std::ios::binary);
+    return std::vector<char>(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+}
+
+static void writeFile(const std::string &file, const std::vector<char> &bytes)
+{
+    std::ofstream out(file, std::ios::binary | std::ios::trunc);
+    out.write(bytes.data(), (std::streamsize)bytes.size());
+}
+
+static bool mapThrows(const std::vector<char> &bytes)
+{
+    writeFile(path, bytes);
+    try
+    {
+        Frozen::mapFile(path);
+    }
+    catch (const std::runtime_error &)
+    {
+        return true;
+    }
+    return false;
+}
+
+// Overwrites a 64-bit header field.
+static std::vector<char> patched(std::vector<char> bytes, size_t offset, uint64_t value)
+{
+    std::memcpy(bytes.data() + offset, &value, sizeof(value));
+    return bytes;
+}
+
+// A frozen table finds every key of the table it was built from, rejects
+// other keys, and stays within 3 bits per key for its hash function.
+static void testFreeze()
+{
+    HashTable<uint64_t, uint64_t> table;
+    const uint64_t count = 100000;
+    std::ostringstream silenced;
+    std::streambuf *console = std::cout.rdbuf(silenced.rdbuf());
+    for (uint64_t i = 0; i < count; i++)
+    {
+        table.insert(i * 2654435761ULL, i);
+    }
+    std::cout.rdbuf(console);
+    Frozen frozen = table.freeze();
+    assert(frozen.size() == (int)count);
+    for (uint64_t i = 0; i < count; i++)
+    {
+        assert(frozen.get(i * 2654435761ULL) == i);
+        assert(!frozen.containsKey(i * 2654435761ULL + 1));
+    }
+    assert(frozen.hashBitsPerKey() < 3.0);
+
+    std::vector<uint64_t> none;
+    Frozen empty(none, none);
+    assert(empty.isEmpty() && !empty.containsKey(7));
+}
+
+// A saved table maps back in, and a file whose sections do not fit is
+// refused instead of being read out of bounds.
+static void testMapFile()
+{
+    std::vector<uint64_t> keys;
+    std::vector<uint64_t> values;
+    for (uint64_t i = 0; i < 50000; i++)
+    {
+        keys.push_back(i * 11 + 3);
+        values.push_back(i);
+    }
+    Frozen(keys, values).save(path);
+    std::vector<char> bytes = readFile(path);
+    {
+        Frozen mapped = Frozen::mapFile(path);
+        for (size_t i = 0; i < keys.size(); i++)
+        {
+            assert(mapped.get(keys[i]) == values[i]);
+        }
+    }
+
+    assert(mapThrows(std::vector<char>(bytes.begin(), bytes.end() - 1)));
+    assert(mapThrows(std::vector<char>(bytes.begin(), bytes.begin() + sizeof(Frozen::Header))));
+    const size_t offsets[] = {offsetof(Frozen::Header, pilotsOffset), offsetof(Frozen::Header, remapOffset),
+                              offsetof(Frozen::Header, overflowOffset), offsetof(Frozen::Header, keysOffset),
+                              offsetof(Frozen::Header, valuesOffset)};
+    for (size_t offset : offsets)
+    {
+        assert(mapThrows(patched(bytes, offset, bytes.size() + 64)));
+        assert(mapThrows(patched(bytes, offset, UINT64_MAX - 7)));
+        assert(mapThrows(patched(bytes, offset, 3)));
+    }
+    const size_t counts[] = {offsetof(Frozen::Header, count), offsetof(Frozen::Header, tableSize),
+                             offsetof(Frozen::Header, bucketCount), offsetof(Frozen::Header, overflowCount)};
+    for (size_t offset : counts)
+    {
+        assert(mapThrows(patched(bytes, offset, bytes.size())));
+        assert(mapThrows(patched(bytes, offset, UINT64_MAX / 2)));
+    }
+    assert(mapThrows(patched(bytes, offsetof(Frozen::Header, bucketCount), 0)));
+
+    // Remap entries pointing past the table are not followed.
+    Frozen::Header header;
+    std::memcpy(&header, bytes.data(), sizeof(header));
+    std::vector<char> damaged = bytes;
+    std::memset(damaged.data() + header.remapOffset, 0xFF, (header.tableSize - header.count) * sizeof(uint32_t));
+    writeFile(path, damaged);
+    {
+        Frozen mapped = Frozen::mapFile(path);
+        for (size_t i = 0; i < keys.size(); i++)
+        {
+            const uint64_t *value = mapped.find(keys[i]);
+            assert(!value || *value == values[i]);
+        }
+    }
+    std::remove(path.c_str());
+}
+
+int main()
+{
+    testFreeze();
+    testMapFile();
+    std::cout << "FrozenHashTableTest passed" << std::endl;
+    return 0;
+}
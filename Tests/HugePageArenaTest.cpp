@@ -0,0 +1,151 @@
+/**
+ * @file HugePageArenaTest.cpp
+ * @author Kofi Boateng
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * Build and run: g++ -std=c++17 -O2 Tests/HugePageArenaTest.cpp -o HugePageArenaTest && ./HugePageArenaTest
+ *
+ */
+
+#include <array>     // for points
+#include <cassert>   // for assert
+#include <chrono>    // for timing
+#include <cstdint>   // for fixed width integers
+#include <fstream>   // for reading /proc
+#include <iostream>  // for cout
+#include <random>    // for keys and points
+#include <stdexcept> // for runtime_error
+#include <string>    // for /proc fields
+#include <vector>    // for keys and points
+#include "../Memory/ArenaAllocator.h"
+#include "../Hashing/SeparateChainingHashTable/SeparateChainingHashTable.h"
+#include "../Trees/KDTree/KDTree.h"
+
+typedef ArenaAllocator<pair<uint64_t, uint64_t>> PairAllocator;
+typedef HashTable<uint64_t, uint64_t, std::hash<uint64_t>, PairAllocator> ArenaTable;
+
+// Returns the process's memory in transparent huge pages, in kB, or -1 where
+// the kernel does not report it.
+static long anonHugePagesKb()
+{
+    std::ifstream in("/proc/self/smaps_rollup");
+    std::string field;
+    long value;
+    while (in >> field)
+    {
+        if (field == "AnonHugePages:")
+        {
+            in >> value;
+            return value;
+        }
+    }
+    return -1;
+}
+
+static const char *modeName(HugePageArena::PageMode mode)
+{
+    return mode == HugePageArena::PageMode::Normal ? "Normal" : mode == HugePageArena::PageMode::Transparent ? "Transparent"
+                                                                                                            : "Explicit";
+}
+
+// Allocations are aligned and bump forward, running out throws, and reset()
+// hands the same memory out again.
+static void testAllocate()
+{
+    HugePageArena arena(1);
+    assert(arena.capacity() == HugePageArena::hugePageSize);
+    char *first = static_cast<char *>(arena.allocate(3, 1));
+    char *second = static_cast<char *>(arena.allocate(64, 64));
+    assert(second > first && (uintptr_t)second % 64 == 0 && arena.used() == (size_t)(second - first) + 64);
+    bool thrown = false;
+    try
+    {
+        arena.allocate(arena.capacity());
+    }
+    catch (const std::runtime_error &)
+    {
+        thrown = true;
+    }
+    assert(thrown);
+    arena.reset();
+    assert(arena.used() == 0 && arena.allocate(3, 1) == first);
+
+    // Without a hugetlbfs pool an explicit request falls back to transparent pages.
+    HugePageArena explicitPages(HugePageArena::hugePageSize, HugePageArena::PageMode::Explicit);
+    assert(explicitPages.pageMode() != HugePageArena::PageMode::Normal);
+    static_cast<char *>(explicitPages.allocate(4096))[4095] = 1;
+}
+
+// Containers on an arena hold the same contents as on the heap.
+static void testContainers()
+{
+    HugePageArena arena((size_t)64 << 20);
+    PairAllocator allocator(arena);
+    ArenaTable table(1024, std::hash<uint64_t>(), allocator);
+    for (uint64_t i = 0; i < 50000; i++)
+    {
+        table.add(i * 31, i);
+    }
+    for (uint64_t i = 0; i < 50000; i++)
+    {
+        assert(*table.find(i * 31) == i && !table.find(i * 31 + 1));
+    }
+    assert(arena.used() > 50000 * sizeof(pair<uint64_t, uint64_t>));
+
+    std::mt19937 gen(2);
+    std::uniform_real_distribution<float> uniform(0, 1);
+    std::vector<std::array<float, 3>> points(5000);
+    for (std::array<float, 3> &point : points)
+    {
+        point = {uniform(gen), uniform(gen), uniform(gen)};
+    }
+    KDTree<float, 3, ArenaAllocator<float>> tree(points, 1, ArenaAllocator<float>(arena));
+    KDTree<float, 3> heapTree(points);
+    for (int q = 0; q < 200; q++)
+    {
+        std::array<float, 3> query = {uniform(gen), uniform(gen), uniform(gen)};
+        assert(tree.nearest(query).index == heapTree.nearest(query).index);
+    }
+}
+
+// Random lookups in a table far larger than the TLB covers with 4 KB pages.
+static void testLookupSpeed()
+{
+    const int keys = 4000000;
+    const int lookups = 5000000;
+    for (HugePageArena::PageMode mode : {HugePageArena::PageMode::Normal, HugePageArena::PageMode::Transparent})
+    {
+        HugePageArena arena((size_t)1 << 30, mode);
+        ArenaTable table(keys, std::hash<uint64_t>(), PairAllocator(arena));
+        std::mt19937_64 gen(1);
+        std::vector<uint64_t> inserted(keys);
+        for (uint64_t &key : inserted)
+        {
+            key = gen();
+            table.add(key, key ^ 1);
+        }
+        std::uniform_int_distribution<int> pick(0, keys - 1);
+        uint64_t sum = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < lookups; i++)
+        {
+            uint64_t key = inserted[pick(gen)];
+            sum += *table.find(key) ^ key;
+        }
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        assert(sum == (uint64_t)lookups);
+        std::cout << modeName(arena.pageMode()) << " pages: " << lookups / seconds / 1e6 << "M lookups/s, "
+                  << arena.used() / 1000000 << " MB in the arena, AnonHugePages " << anonHugePagesKb() << " kB"
+                  << std::endl;
+    }
+}
+
+int main()
+{
+    testAllocate();
+    testContainers();
+    testLookupSpeed();
+    std::cout << "HugePageArenaTest passed" << std::endl;
+    return 0;
+}
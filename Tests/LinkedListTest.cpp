@@ -0,0 +1,71 @@
+/**
+ * @file LinkedListTest.cpp
+ * @author Kofi Boateng
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * Build and run: g++ -std=c++17 Tests/LinkedListTest.cpp -o LinkedListTest && ./LinkedListTest
+ *
+ */
+
+#include <cassert>   // for assert
+#include <iostream>  // for cout
+#include <stdexcept> // for runtime_error
+#include "../LinkedList/LinkedList.h"
+
+// Pushing many elements to the front, including equal ones, keeps them all in
+// reverse order with the links intact in both directions.
+static void testPushFront()
+{
+    LinkedList<int> list;
+    for (int i = 0; i < 1000; i++)
+    {
+        list.pushFront(i % 3);
+    }
+    assert(list.size() == 1000);
+    int expected = 999;
+    for (LinkedList<int>::Node *node = list.getHeadPtr(); node; node = node->next)
+    {
+        assert(node->data == expected % 3);
+        assert(!node->next || node->next->prev == node);
+        expected--;
+    }
+    assert(expected == -1);
+    assert(list.getTailPtr()->data == 0 && !list.getTailPtr()->next);
+    list.hasCycle();
+}
+
+// hasCycle() accepts lists of every length, and throws for a list whose tail
+// links back into it.
+static void testHasCycle()
+{
+    LinkedList<int> list;
+    for (int i = 0; i < 7; i++)
+    {
+        list.hasCycle();
+        list.pushBack(1);
+    }
+    list.hasCycle();
+
+    LinkedList<int>::Node *tail = list.getTailPtr();
+    tail->next = list.getHeadPtr()->next->next;
+    bool thrown = false;
+    try
+    {
+        list.hasCycle();
+    }
+    catch (const std::runtime_error &)
+    {
+        thrown = true;
+    }
+    tail->next = nullptr;
+    assert(thrown);
+}
+
+int main()
+{
+    testPushFront();
+    testHasCycle();
+    std::cout << "LinkedListTest passed" << std::endl;
+    return 0;
+}
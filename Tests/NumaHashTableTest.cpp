@@ -0,0 +1,157 @@
+/**
+ * @file NumaHashTableTest.cpp
+ * @author Kofi Boateng
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * Build and run: g++ -std=c++17 -O2 -pthread Tests/NumaHashTableTest.cpp -o NumaHashTableTest && ./NumaHashTableTest
+ *
+ */
+
+#include <algorithm> // for min
+#include <atomic>    // for lookup totals
+#include <cassert>   // for assert
+#include <chrono>    // for timing
+#include <cstdint>   // for fixed width integers
+#include <iostream>  // for cout
+#include <random>    // for lookup keys
+#include <string>    // for string values
+#include <thread>    // for yield
+#include <vector>    // for per-node key lists
+#include "../Hashing/NumaHashTable/NumaHashTable.h"
+#include "../Concurrency/ThreadPool.h"
+
+// Inserting and removing the same small key set many times must not use up a
+// shard: the nodes of removed keys are reused.
+static void testChurnDoesNotExhaustArena()
+{
+    NumaHashTable<long, long> table((size_t)4 << 20, NumaHashTable<long, long>::Placement::Local, 1, 64);
+    for (int round = 0; round < 1000; round++)
+    {
+        for (long key = 0; key < 1000; key++)
+        {
+            table.insert(key, key + round);
+        }
+        assert(table.size() == 1000);
+        assert(table.get(999) == 999 + round);
+        for (long key = 0; key < 1000; key++)
+        {
+            assert(table.remove(key));
+        }
+        assert(table.size() == 0);
+    }
+}
+
+// Values that allocate memory of their own churn the same way.
+static void testChurnWithStringValues()
+{
+    NumaHashTable<int, std::string> table((size_t)4 << 20, NumaHashTable<int, std::string>::Placement::Interleaved, 2, 16);
+    for (int round = 0; round < 200; round++)
+    {
+        for (int key = 0; key < 2000; key++)
+        {
+            table.insert(key, "value " + std::to_string(key));
+        }
+        for (int key = 0; key < 2000; key += 2)
+        {
+            assert(table.remove(key));
+        }
+        assert(table.size() == 1000);
+        assert(table.get(1999) == "value 1999");
+        assert(!table.containsKey(0));
+        for (int key = 1; key < 2000; key += 2)
+        {
+            assert(table.remove(key));
+        }
+        assert(table.size() == 0);
+    }
+}
+
+static double secondsSince(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Parallel inserts, then lookups sent to the node that holds each key, for
+// both placements, on a pool with its workers pinned to their nodes.
+static void testThroughput()
+{
+    typedef NumaHashTable<uint64_t, uint64_t> Table;
+    const size_t keys = 2000000;
+    const int parts = 64;
+    ThreadPool pool(defaultThreadCount(), true);
+    for (Table::Placement placement : {Table::Placement::Local, Table::Placement::Interleaved})
+    {
+        Table table((size_t)64 << 20, placement);
+        auto start = std::chrono::steady_clock::now();
+        {
+            ThreadPool::TaskGroup group(pool);
+            for (int part = 0; part < parts; part++)
+            {
+                group.run([&table, part, keys]()
+                          {
+                    for (size_t i = part; i < keys; i += parts)
+                    {
+                        table.insert(i * 2654435761u, i);
+                    } });
+            }
+            group.wait();
+        }
+        double insertSeconds = secondsSince(start);
+        assert(table.size() == (int)keys);
+
+        // Group the lookup keys by the node that holds them.
+        std::vector<std::vector<uint64_t>> byNode;
+        std::mt19937_64 gen(5);
+        for (size_t i = 0; i < keys; i++)
+        {
+            uint64_t key = (gen() % keys) * 2654435761u;
+            size_t node = (size_t)table.nodeOf(key);
+            if (node >= byNode.size())
+            {
+                byNode.resize(node + 1);
+            }
+            byNode[node].push_back(key);
+        }
+        std::atomic<uint64_t> found(0);
+        std::atomic<size_t> finished(0);
+        size_t tasks = 0;
+        start = std::chrono::steady_clock::now();
+        for (size_t node = 0; node < byNode.size(); node++)
+        {
+            for (size_t begin = 0; begin < byNode[node].size(); begin += 16384, tasks++)
+            {
+                const uint64_t *slice = byNode[node].data() + begin;
+                size_t count = std::min<size_t>(16384, byNode[node].size() - begin);
+                pool.submitToNode((int)node, [&table, &found, &finished, slice, count]()
+                                  {
+                    uint64_t hits = 0;
+                    uint64_t value;
+                    for (size_t i = 0; i < count; i++)
+                    {
+                        hits += table.find(slice[i], value);
+                    }
+                    found += hits;
+                    finished++; });
+            }
+        }
+        while (finished.load() < tasks)
+        {
+            std::this_thread::yield();
+        }
+        double lookupSeconds = secondsSince(start);
+        assert(found == keys);
+        std::cout << (placement == Table::Placement::Local ? "Local" : "Interleaved") << " placement, "
+                  << pool.size() << " threads on " << pool.nodeCount() << " nodes: " << keys / insertSeconds / 1e6
+                  << "M inserts/s, " << keys / lookupSeconds / 1e6 << "M lookups/s" << std::endl;
+    }
+}
+
+int main()
+{
+    testChurnDoesNotExhaustArena();
+    testChurnWithStringValues();
+    testThroughput();
+    std::cout << "NumaHashTableTest passed" << std::endl;
+    return 0;
+}
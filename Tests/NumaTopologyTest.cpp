@@ -0,0 +1,94 @@
+/**
+ * @file NumaTopologyTest.cpp
+ * @author Kofi Boateng
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * Build and run: g++ -std=c++17 -pthread Tests/NumaTopologyTest.cpp -o NumaTopologyTest && ./NumaTopologyTest
+ *
+ */
+
+#include <atomic>   // for the task counter
+#include <cassert>  // for assert
+#include <iostream> // for cout
+#include <thread>   // for yield
+#include <vector>   // for node lists
+#include "../Concurrency/NumaTopology.h"
+#include "../Concurrency/ThreadPool.h"
+#include "../Hashing/NumaHashTable/NumaHashTable.h"
+
+// Returns true if node is one of the online nodes.
+static bool isOnline(int node)
+{
+    for (int online : NumaTopology::nodes())
+    {
+        if (online == node)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+// sysfs lists, as found in node/online and nodeN/cpulist, including sparse ones.
+static void testParseList()
+{
+    assert(NumaTopology::parseList("0") == std::vector<int>({0}));
+    assert(NumaTopology::parseList("0-1,4\n") == std::vector<int>({0, 1, 4}));
+    assert(NumaTopology::parseList("2,5-7,10") == std::vector<int>({2, 5, 6, 7, 10}));
+    assert(NumaTopology::parseList("").empty());
+    assert(NumaTopology::parseList("\n").empty());
+}
+
+// Every id the topology hands out is an online node, and every CPU maps back
+// to the node that lists it.
+static void testNodesAreConsistent()
+{
+    const std::vector<int> &nodes = NumaTopology::nodes();
+    assert(!nodes.empty() && (int)nodes.size() == NumaTopology::nodeCount());
+    for (size_t i = 1; i < nodes.size(); i++)
+    {
+        assert(nodes[i - 1] < nodes[i]);
+    }
+    for (int node : nodes)
+    {
+        for (int cpu : NumaTopology::cpus(node))
+        {
+            assert(NumaTopology::nodeOf(cpu) == node);
+        }
+    }
+    assert(isOnline(NumaTopology::currentNode()));
+    assert(NumaTopology::cpus(-1).empty() && NumaTopology::cpus(1 << 20).empty());
+}
+
+// Shards are placed on online nodes, and work submitted to a shard's node runs.
+static void testShardsUseOnlineNodes()
+{
+    NumaHashTable<int, int> table((size_t)4 << 20);
+    ThreadPool pool(4);
+    std::atomic<int> done(0);
+    for (int key = 0; key < 100; key++)
+    {
+        int node = table.nodeOf(key);
+        assert(isOnline(node) && !NumaTopology::cpus(node).empty());
+        pool.submitToNode(node, [&table, &done, key]()
+                          {
+            table.insert(key, key);
+            done++; });
+    }
+    while (done.load() < 100)
+    {
+        std::this_thread::yield();
+    }
+    assert(table.size() == 100);
+    assert(pool.nodeCount() >= 1 && pool.nodeCount() <= NumaTopology::nodeCount());
+}
+
+int main()
+{
+    testParseList();
+    testNodesAreConsistent();
+    testShardsUseOnlineNodes();
+    std::cout << "NumaTopologyTest passed" << std::endl;
+    return 0;
+}
@@ -0,0 +1,231 @@
+/**
+ * @file PersistentHashTableTest.cpp
+ * @author Kofi Boateng
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * Build and run: g++ -std=c++17 -O2 -pthread Tests/PersistentHashTableTest.cpp -o PersistentHashTableTest && ./PersistentHashTableTest
+ *
+ */
+
+#include <cassert>    // for assert
+#include <chrono>     // for timing
+#include <cstdio>     // for remove and file patching
+#include <iostream>   // for cout
+#include <string>     // for values and paths
+#include <thread>     // for concurrent writers
+#include <vector>     // for the threads
+#include <sys/wait.h> // for waitpid
+#include <unistd.h>   // for fork, _exit and rmdir
+#include "../Hashing/PersistentHashTable/PersistentHashTable.h"
+
+typedef PersistentHashTable<long, std::string> Table;
+
+static const std::string directory = "PersistentHashTableTest.db";
+
+static void removeDirectory()
+{
+    for (const char *name : {"wal", "snapshot", "snapshot.tmp"})
+    {
+        std::remove((directory + "/" + name).c_str());
+    }
+    rmdir(directory.c_str());
+}
+
+static long fileSize(const std::string &path)
+{
+    FILE *file = std::fopen(path.c_str(), "rb");
+    std::fseek(file, 0, SEEK_END);
+    long size = std::ftell(file);
+    std::fclose(file);
+    return size;
+}
+
+static WalOptions withoutCheckpoints()
+{
+    WalOptions options;
+    options.checkpointBytes = 0;
+    return options;
+}
+
+// The table comes back from the log alone, then from a snapshot plus the
+// log written after it.
+static void testReopen()
+{
+    removeDirectory();
+    {
+        Table table(directory, withoutCheckpoints());
+        for (long i = 0; i < 1000; i++)
+        {
+            table.insert(i, "v" + std::to_string(i));
+        }
+        for (long i = 0; i < 1000; i += 3)
+        {
+            assert(table.remove(i));
+        }
+        assert(!table.remove(0));
+        table.insert(5, "five");
+        assert(table.durableLsn() == table.lastLsn());
+    }
+    {
+        Table table(directory);
+        assert(table.size() == 666 && table.get(5) == "five" && table.get(4) == "v4" && !table.containsKey(3));
+        table.checkpoint();
+        assert(table.logBytes() == 0);
+        table.insert(3, "three");
+    }
+    Table table(directory);
+    assert(table.size() == 667 && table.get(3) == "three");
+}
+
+// A process that dies without closing the table loses nothing it was told
+// is durable, a torn record at the end of the log is cut off, and a record
+// whose checksum fails ends the replay there.
+static void testCrashRecovery()
+{
+    pid_t child = fork();
+    if (child == 0)
+    {
+        Table table(directory, withoutCheckpoints());
+        for (long i = 2000; i < 2100; i++)
+        {
+            table.insert(i, "c");
+        }
+        _exit(0);
+    }
+    int status;
+    waitpid(child, &status, 0);
+    assert(WIFEXITED(status));
+
+    // A length field promising more than the file holds.
+    FILE *log = std::fopen((directory + "/wal").c_str(), "ab");
+    std::fwrite("\x30\0\0\0torn", 1, 8, log);
+    std::fclose(log);
+    {
+        Table table(directory);
+        assert(table.size() == 767 && table.get(2099) == "c");
+        table.insert(9999, "after");
+    }
+    {
+        Table table(directory);
+        assert(table.size() == 768 && table.get(9999) == "after");
+    }
+
+    long size = fileSize(directory + "/wal");
+    log = std::fopen((directory + "/wal").c_str(), "r+b");
+    std::fseek(log, size - 3, SEEK_SET);
+    std::fputc('Z', log);
+    std::fclose(log);
+    Table table(directory);
+    assert(table.size() == 767 && !table.containsKey(9999));
+}
+
+// Writers on several threads share fsyncs and trigger checkpoints, and the
+// parallel replay applies their records in LSN order.
+static void testConcurrentWriters()
+{
+    WalOptions options;
+    options.syncEvery = 4;
+    options.checkpointBytes = 64 << 10;
+    options.recoveryThreads = 4;
+    {
+        Table table(directory, options);
+        std::vector<std::thread> threads;
+        for (int t = 0; t < 4; t++)
+        {
+            threads.emplace_back([&table, t]()
+                                 {
+                for (long i = 0; i < 5000; i++)
+                {
+                    long key = 100000 + t * 10000 + i;
+                    table.insert(key, std::to_string(i));
+                    if (i % 7 == 0)
+                    {
+                        table.remove(key);
+                    }
+                } });
+        }
+        for (std::thread &thread : threads)
+        {
+            thread.join();
+        }
+        assert(table.logBytes() < (64 << 10) + 1000);
+    }
+    Table table(directory, options);
+    assert(table.size() == 767 + 4 * (5000 - 715));
+    assert(table.get(100000 + 3 * 10000 + 4999) == "4999" && !table.containsKey(100000 + 7));
+}
+
+// Insert throughput for a few group sizes and writer counts, and the time
+// to recover a 1M-record log.
+static void testThroughput()
+{
+    std::string value(100, 'x');
+    for (size_t every : {1, 64, 0})
+    {
+        removeDirectory();
+        WalOptions options = withoutCheckpoints();
+        options.syncEvery = every;
+        Table table(directory, options);
+        int operations = every == 1 ? 2000 : 100000;
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < operations; i++)
+        {
+            table.insert(i, value);
+        }
+        table.sync();
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        std::cout << "syncEvery " << every << ": " << operations / seconds << " inserts/s" << std::endl;
+    }
+    for (int threadCount : {1, 4})
+    {
+        removeDirectory();
+        Table table(directory, withoutCheckpoints());
+        const int perThread = 1000;
+        auto start = std::chrono::steady_clock::now();
+        std::vector<std::thread> threads;
+        for (int t = 0; t < threadCount; t++)
+        {
+            threads.emplace_back([&table, t, perThread]()
+                                 {
+                for (int i = 0; i < perThread; i++)
+                {
+                    table.insert(t * perThread + i, "v");
+                } });
+        }
+        for (std::thread &thread : threads)
+        {
+            thread.join();
+        }
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        std::cout << "syncEvery 1, " << threadCount << " threads: " << threadCount * perThread / seconds
+                  << " inserts/s" << std::endl;
+    }
+
+    removeDirectory();
+    WalOptions options = withoutCheckpoints();
+    options.syncEvery = 0;
+    {
+        Table table(directory, options);
+        for (int i = 0; i < 1000000; i++)
+        {
+            table.insert(i % 250000, std::to_string(i));
+        }
+    }
+    auto start = std::chrono::steady_clock::now();
+    Table table(directory, options);
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    assert(table.size() == 250000 && table.get(7) == "750007");
+    std::cout << "Recovered 1M log records in " << seconds << " s" << std::endl;
+}
+
+int main()
+{
+    testReopen();
+    testCrashRecovery();
+    testConcurrentWriters();
+    testThroughput();
+    removeDirectory();
+    std::cout << "PersistentHashTableTest passed" << std::endl;
+    return 0;
+}
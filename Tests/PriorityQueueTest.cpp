@@ -0,0 +1,128 @@
+/**
+ * @file PriorityQueueTest.cpp
+ * @author Kofi Boateng
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * Build and run: g++ -std=c++17 Tests/PriorityQueueTest.cpp -o PriorityQueueTest && ./PriorityQueueTest
+ *
+ */
+
+#include <cassert>    // for assert
+#include <functional> // for greater
+#include <iostream>   // for cout
+#include <stdexcept>  // for runtime_error
+#include <string>     // for string elements
+#include <vector>     // for serialized bytes
+#include "../Heap/PriorityQueue.h"
+
+// An element with no default constructor that counts how many of it are alive.
+struct Tracked
+{
+    static int live;
+    int key;
+
+    explicit Tracked(int keyArg) : key(keyArg) { live++; }
+    Tracked(const Tracked &other) : key(other.key) { live++; }
+    Tracked &operator=(const Tracked &other) = default;
+    ~Tracked() { live--; }
+
+    bool operator<(const Tracked &other) const { return key < other.key; }
+};
+int Tracked::live = 0;
+
+// Only the elements in the heap are alive: growth, removal and copies construct
+// and destroy exactly the slots they use.
+static void testOnlyLiveSlotsAreConstructed()
+{
+    {
+        PriorityQueueADT<Tracked> queue;
+        for (int i = 0; i < 100; i++)
+        {
+            queue.insert(Tracked((i * 37) % 100));
+        }
+        assert(Tracked::live == 100);
+        for (int i = 0; i < 40; i++)
+        {
+            assert(queue.peek().key == i);
+            queue.removeMin();
+        }
+        assert(Tracked::live == 60);
+
+        PriorityQueueADT<Tracked> copy(queue);
+        assert(Tracked::live == 120);
+        copy.removeMin();
+        PriorityQueueADT<Tracked> assigned;
+        assigned.insert(Tracked(-1));
+        assigned = copy;
+        assert(Tracked::live == 60 + 59 + 59);
+        assert(assigned.peek().key == 41 && queue.peek().key == 40);
+    }
+    assert(Tracked::live == 0);
+}
+
+// Elements that own memory are moved, not copied bit by bit, when the array
+// grows, and come out in order.
+static void testGrowWithStrings()
+{
+    PriorityQueueADT<std::string, std::greater<std::string>> queue;
+    for (int i = 0; i < 1000; i++)
+    {
+        queue.insert(std::string(20, 'a') + std::to_string(1000 + i));
+    }
+    for (int i = 999; i >= 0; i--)
+    {
+        assert(queue.peek() == std::string(20, 'a') + std::to_string(1000 + i));
+        queue.removeMin();
+    }
+    assert(queue.isEmpty());
+}
+
+// A serialized queue reads back in the same order, and a truncated stream
+// leaves the queue it is read into as it was.
+static void testSerializeRoundTrip()
+{
+    PriorityQueueADT<int> queue;
+    for (int i = 0; i < 1000; i++)
+    {
+        queue.insert((i * 7919) % 1000);
+    }
+    std::vector<char> bytes;
+    {
+        BinaryWriter writer(bytes);
+        queue.serialize(writer);
+    }
+
+    PriorityQueueADT<int> loaded;
+    BinaryReader reader(bytes.data(), bytes.size());
+    loaded.deserialize(reader);
+    assert(loaded.size() == 1000);
+    for (int i = 0; i < 1000; i++)
+    {
+        assert(loaded.peek() == i);
+        loaded.removeMin();
+    }
+
+    PriorityQueueADT<int> untouched;
+    untouched.insert(5);
+    BinaryReader truncated(bytes.data(), bytes.size() / 2);
+    bool thrown = false;
+    try
+    {
+        untouched.deserialize(truncated);
+    }
+    catch (const std::runtime_error &)
+    {
+        thrown = true;
+    }
+    assert(thrown && untouched.size() == 1 && untouched.peek() == 5);
+}
+
+int main()
+{
+    testOnlyLiveSlotsAreConstructed();
+    testGrowWithStrings();
+    testSerializeRoundTrip();
+    std::cout << "PriorityQueueTest passed" << std::endl;
+    return 0;
+}
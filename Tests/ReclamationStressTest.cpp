@@ -0,0 +1,205 @@
+/**
+ * @file ReclamationStressTest.cpp
+ * @author Kofi Boateng
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * Build and run: g++ -std=c++17 -O2 -pthread Tests/ReclamationStressTest.cpp -o ReclamationStressTest && ./ReclamationStressTest
+ * Meant to be run under -fsanitize=address and -fsanitize=thread as well.
+ *
+ */
+
+#include <atomic>   // for the live count and the test stack
+#include <cassert>  // for assert
+#include <chrono>   // for timing
+#include <cstdint>  // for fixed width integers
+#include <iostream> // for cout
+#include <thread>   // for the worker threads
+#include <vector>   // for the threads and their results
+#include "../Stack/LockFreeStack.h"
+#include "../Concurrency/HazardPointers.h"
+
+static const int threadCount = 4;
+static const int pairsPerThread = 100000;
+
+// An element that counts how many of it are alive, so a node that is never
+// freed or freed twice shows up in the total.
+struct Counted
+{
+    static std::atomic<long> live;
+    uint64_t value;
+
+    Counted() : value(0) { live.fetch_add(1, std::memory_order_relaxed); }
+    Counted(uint64_t valueArg) : value(valueArg) { live.fetch_add(1, std::memory_order_relaxed); }
+    Counted(const Counted &other) : value(other.value) { live.fetch_add(1, std::memory_order_relaxed); }
+    Counted &operator=(const Counted &other)
+    {
+        value = other.value;
+        return *this;
+    }
+    ~Counted() { live.fetch_sub(1, std::memory_order_relaxed); }
+};
+
+std::atomic<long> Counted::live(0);
+
+// Runs body(thread, sum) on every thread and returns the total of what the
+// threads popped, after printing the throughput.
+template <typename Body>
+static uint64_t runThreads(const char *name, Body body)
+{
+    std::vector<uint64_t> sums(threadCount, 0);
+    std::vector<std::thread> threads;
+    auto start = std::chrono::steady_clock::now();
+    for (int t = 0; t < threadCount; t++)
+    {
+        threads.emplace_back([&body, &sums, t]()
+                             { body(t, sums[t]); });
+    }
+    for (std::thread &thread : threads)
+    {
+        thread.join();
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::cout << name << ": " << (2.0 * threadCount * pairsPerThread / seconds / 1e6) << "M ops/s" << std::endl;
+    uint64_t total = 0;
+    for (uint64_t sum : sums)
+    {
+        total += sum;
+    }
+    return total;
+}
+
+// The sum of every value pushed: each thread pushes its own range.
+static uint64_t expectedSum()
+{
+    uint64_t n = (uint64_t)threadCount * pairsPerThread;
+    return n * (n - 1) / 2;
+}
+
+// Every thread pushes and pops its share while the others do the same, so
+// popped nodes are retired while other threads may still be reading them.
+static void testEpochChurn()
+{
+    {
+        EpochDomain domain(threadCount);
+        LockFreeStack<Counted> stack(domain);
+        uint64_t total = runThreads("EBR", [&stack, &domain](int t, uint64_t &sum)
+                                    {
+            EpochDomain::Handle handle(domain);
+            for (int i = 0; i < pairsPerThread; i++)
+            {
+                stack.push(Counted((uint64_t)t * pairsPerThread + i));
+                Counted out;
+                assert(stack.pop(handle, out));
+                sum += out.value;
+            } });
+        assert(total == expectedSum() && stack.isEmpty());
+    }
+    assert(Counted::live.load() == 0);
+}
+
+// The same churn with the threads announcing quiescent states instead of
+// pinning around each pop.
+static void testQuiescentChurn()
+{
+    {
+        EpochDomain domain(threadCount);
+        LockFreeStack<Counted> stack(domain);
+        uint64_t total = runThreads("QSBR", [&stack, &domain](int t, uint64_t &sum)
+                                    {
+            EpochDomain::Handle handle(domain);
+            handle.online();
+            for (int i = 0; i < pairsPerThread; i++)
+            {
+                stack.push(Counted((uint64_t)t * pairsPerThread + i));
+                Counted out;
+                assert(stack.pop(handle, out));
+                sum += out.value;
+                handle.quiescent();
+            }
+            handle.offline(); });
+        assert(total == expectedSum() && stack.isEmpty());
+    }
+    assert(Counted::live.load() == 0);
+}
+
+// A Treiber stack on hazard pointers: one hazard covers the popped head.
+class HazardStack
+{
+private:
+    struct Node
+    {
+        Node *next;
+        Counted data;
+    };
+
+    std::atomic<Node *> head_;
+
+public:
+    void push(uint64_t value)
+    {
+        Node *node = new Node{nullptr, Counted(value)};
+        node->next = head_.load(std::memory_order_relaxed);
+        while (!head_.compare_exchange_weak(node->next, node, std::memory_order_release, std::memory_order_relaxed))
+        {
+        }
+    }
+
+    bool pop(HazardPointerDomain::Handle &handle, uint64_t &out)
+    {
+        Node *node;
+        {
+            HazardPointerDomain::Guard guard(handle);
+            while (true)
+            {
+                node = guard.protect(head_);
+                if (!node)
+                {
+                    return false;
+                }
+                if (head_.compare_exchange_strong(node, node->next, std::memory_order_acquire, std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            out = node->data.value;
+        }
+        handle.retire(node);
+        return true;
+    }
+
+    HazardStack() : head_(nullptr) {}
+};
+
+// The churn again on hazard pointers, which also bound how many retired
+// nodes a thread can hold however the others are scheduled.
+static void testHazardPointerChurn()
+{
+    {
+        HazardPointerDomain domain(threadCount, 1);
+        HazardStack stack;
+        const size_t bound = 2 * threadCount;
+        uint64_t total = runThreads("Hazard pointers", [&stack, &domain, bound](int t, uint64_t &sum)
+                                    {
+            HazardPointerDomain::Handle handle(domain);
+            for (int i = 0; i < pairsPerThread; i++)
+            {
+                stack.push((uint64_t)t * pairsPerThread + i);
+                uint64_t out;
+                assert(stack.pop(handle, out));
+                sum += out;
+                assert(handle.pending() <= bound);
+            } });
+        assert(total == expectedSum());
+    }
+    assert(Counted::live.load() == 0);
+}
+
+int main()
+{
+    testEpochChurn();
+    testQuiescentChurn();
+    testHazardPointerChurn();
+    std::cout << "ReclamationStressTest passed" << std::endl;
+    return 0;
+}
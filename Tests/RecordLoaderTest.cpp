@@ -0,0 +1,178 @@
+/**
+ * @file RecordLoaderTest.cpp
+ * @author Kofi Boateng
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * Build and run: g++ -std=c++17 -O2 -pthread Tests/RecordLoaderTest.cpp -o RecordLoaderTest && ./RecordLoaderTest
+ *
+ */
+
+#include <cassert>  // for assert
+#include <charconv> // for from_chars
+#include <chrono>   // for timing
+#include <cstdio>   // for remove
+#include <fstream>  // for writing the input file
+#include <iostream> // for cout
+#include <string>   // for records
+#include <utility>  // for pair
+#include <vector>   // for collected records
+#include "../IO/RecordLoader.h"
+
+// Writes lines to path, one per line.
+static void writeLines(const std::string &path, const std::vector<std::string> &lines)
+{
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    for (const std::string &line : lines)
+    {
+        out << line << '\n';
+    }
+}
+
+// Loads path with options and checks that every line comes back, in order.
+static void expectRecords(const std::string &path, const std::vector<std::string> &lines, const LoadOptions &options)
+{
+    std::vector<std::string> loaded;
+    size_t count = loadRecords<std::string>(
+        path, [](std::string_view line, std::string &record)
+        {
+            record.assign(line.data(), line.size());
+            return true; },
+        [&loaded](std::vector<std::string> &batch)
+        { loaded.insert(loaded.end(), batch.begin(), batch.end()); },
+        options);
+    assert(count == lines.size());
+    assert(loaded == lines);
+}
+
+// One record spanning many more blocks than there are buffers, between runs of
+// short records, so that older batches are still pending while it is carried.
+static void testRecordLongerThanDepth()
+{
+    const std::string path = "RecordLoaderTest.long.txt";
+    std::vector<std::string> lines;
+    for (int i = 0; i < 20000; i++)
+    {
+        lines.push_back("short" + std::to_string(i));
+    }
+    lines.push_back(std::string(64 * 4096 + 123, 'x'));
+    for (int i = 0; i < 5000; i++)
+    {
+        lines.push_back("after" + std::to_string(i));
+    }
+    writeLines(path, lines);
+
+    for (int depth = 1; depth <= 8; depth++)
+    {
+        for (BlockReader::Backend backend : {BlockReader::Backend::IoUring, BlockReader::Backend::PreadThreads})
+        {
+            LoadOptions options;
+            options.blockSize = 4096;
+            options.depth = depth;
+            options.backend = backend;
+            expectRecords(path, lines, options);
+        }
+    }
+
+    PrefixTree tree;
+    LoadOptions options;
+    options.blockSize = 4096;
+    assert(loadPrefixTree(path, tree, options) == lines.size());
+    assert(tree.search("short19999") && tree.search("after0") && tree.search(lines[20000]));
+    std::remove(path.c_str());
+}
+
+// Records of random lengths, some far longer than a block.
+static void testRandomRecordLengths()
+{
+    const std::string path = "RecordLoaderTest.random.txt";
+    unsigned state = 12345;
+    std::vector<std::string> lines;
+    for (int i = 0; i < 3000; i++)
+    {
+        state = state * 1103515245u + 12345u;
+        size_t length = (state >> 16) % 100 == 0 ? (state >> 8) % 50000 : (state >> 16) % 40;
+        lines.push_back(std::string(length, (char)('a' + i % 26)));
+    }
+    writeLines(path, lines);
+
+    for (int depth = 1; depth <= 6; depth++)
+    {
+        LoadOptions options;
+        options.blockSize = 4096;
+        options.depth = depth;
+        expectRecords(path, lines, options);
+    }
+    std::remove(path.c_str());
+}
+
+// Parses "key<TAB>value" into a pair.
+static bool parsePair(std::string_view line, std::pair<long, long> &out)
+{
+    size_t tab = line.find('\t');
+    if (tab == std::string_view::npos)
+    {
+        return false;
+    }
+    std::from_chars(line.data(), line.data() + tab, out.first);
+    std::from_chars(line.data() + tab + 1, line.data() + line.size(), out.second);
+    return true;
+}
+
+// Loads a table of 3M pairs with each backend, against reading the file line
+// by line with std::getline on one thread.
+static void testLoadThroughput()
+{
+    const std::string path = "RecordLoaderTest.pairs.txt";
+    const long count = 3000000;
+    {
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        for (long i = 0; i < count; i++)
+        {
+            out << i << '\t' << i * 3 << '\n';
+        }
+    }
+    double megabytes = (double)BlockReader(path).fileSize() / 1e6;
+
+    auto start = std::chrono::steady_clock::now();
+    {
+        HashTable<long, long> table(16);
+        std::ifstream in(path, std::ios::binary);
+        std::string line;
+        std::pair<long, long> pair;
+        while (std::getline(in, line))
+        {
+            if (parsePair(line, pair))
+            {
+                table.add(pair.first, pair.second);
+            }
+        }
+        assert(table.size() == count);
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::cout << "std::getline: " << megabytes / seconds << " MB/s" << std::endl;
+
+    for (BlockReader::Backend backend : {BlockReader::Backend::IoUring, BlockReader::Backend::PreadThreads})
+    {
+        LoadOptions options;
+        options.backend = backend;
+        HashTable<long, long> table(16);
+        start = std::chrono::steady_clock::now();
+        assert(loadHashTable(path, table, parsePair, options) == (size_t)count);
+        seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        assert(table.size() == count && table.get(count - 1) == (count - 1) * 3);
+        BlockReader reader(path, options.blockSize, options.depth, backend);
+        std::cout << "loadHashTable, " << (reader.backend() == BlockReader::Backend::IoUring ? "io_uring" : "pread threads")
+                  << ": " << megabytes / seconds << " MB/s" << std::endl;
+    }
+    std::remove(path.c_str());
+}
+
+int main()
+{
+    testRecordLongerThanDepth();
+    testRandomRecordLengths();
+    testLoadThroughput();
+    std::cout << "RecordLoaderTest passed" << std::endl;
+    return 0;
+}
@@ -0,0 +1,84 @@
+/**
+ * @file RingBufferTest.cpp
+ * @author Kofi Boateng
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * Build and run: g++ -std=c++17 Tests/RingBufferTest.cpp -o RingBufferTest && ./RingBufferTest
+ *
+ */
+
+#include <cassert>  // for assert
+#include <iostream> // for cout
+#include <memory>   // for unique_ptr
+#include <string>   // for string elements
+#include "../Queue/RingBuffer.h"
+
+// Pushing one of the buffer's own elements while it is full copies the element
+// before the old array is released.
+static void testPushOwnElementWhileFull()
+{
+    RingBuffer<std::string> ring(4);
+    for (int i = 0; i < 4; i++)
+    {
+        ring.pushBack(std::string(40, (char)('a' + i)));
+    }
+    assert(ring.size() == ring.capacity());
+    ring.pushBack(ring.front());
+    assert(ring.size() == 5 && ring.back() == std::string(40, 'a'));
+
+    while (ring.size() < ring.capacity())
+    {
+        ring.pushBack("filler");
+    }
+    ring.pushFront(ring.back());
+    assert(ring.front() == "filler" && ring[1] == std::string(40, 'a'));
+    assert(ring[5] == std::string(40, 'a'));
+}
+
+// Elements stay in order across growth at both ends, with the front wrapped
+// around the end of the array.
+static void testOrderAcrossGrowth()
+{
+    RingBuffer<int> ring(2);
+    for (int i = 0; i < 100; i++)
+    {
+        if (i % 2 == 0)
+        {
+            ring.pushBack(i);
+        }
+        else
+        {
+            ring.pushFront(-i);
+        }
+    }
+    assert(ring.size() == 100);
+    for (size_t i = 0; i < 50; i++)
+    {
+        assert(ring[i] == -(int)(99 - 2 * i));
+        assert(ring[50 + i] == (int)(2 * i));
+    }
+}
+
+// Move-only elements go through the rvalue overloads.
+static void testMoveOnlyElements()
+{
+    RingBuffer<std::unique_ptr<int>> ring(1);
+    for (int i = 0; i < 10; i++)
+    {
+        ring.pushBack(std::unique_ptr<int>(new int(i)));
+        ring.emplaceFront(new int(-i));
+    }
+    assert(ring.size() == 20 && *ring.front() == -9 && *ring.back() == 9);
+    ring.popFront();
+    assert(*ring.front() == -8);
+}
+
+int main()
+{
+    testPushOwnElementWhileFull();
+    testOrderAcrossGrowth();
+    testMoveOnlyElements();
+    std::cout << "RingBufferTest passed" << std::endl;
+    return 0;
+}
@@ -0,0 +1,164 @@
+/**
+ * @file RoaringBitmapTest.cpp
+ * @author Kofi Boateng
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * Build and run: g++ -std=c++17 -O2 Tests/RoaringBitmapTest.cpp -o RoaringBitmapTest && ./RoaringBitmapTest
+ *
+ */
+
+#include <cassert>  // for assert
+#include <chrono>   // for timing
+#include <cstdint>  // for fixed width integers
+#include <iostream> // for cout
+#include <random>   // for random values
+#include <set>      // for the reference sets
+#include <vector>   // for value lists
+#include "../Succinct/RoaringBitmap.h"
+
+static std::mt19937 gen(5);
+
+static std::vector<uint32_t> toVector(const std::set<uint32_t> &set) { return std::vector<uint32_t>(set.begin(), set.end()); }
+
+// Adds and removes the same values in a bitmap and a std::set. Sparse values
+// stay in array containers, dense ones turn into bitmaps, and consecutive
+// ones become runs once the bitmap is run-optimized.
+static void fill(RoaringBitmap &bitmap, std::set<uint32_t> &set, int mode)
+{
+    int count = gen() % 20000;
+    uint32_t base = (gen() % 4) << 16;
+    for (int i = 0; i < count; i++)
+    {
+        uint32_t value;
+        if (mode == 0)
+        {
+            value = base + gen() % 200000;
+        }
+        else if (mode == 1)
+        {
+            value = base + gen() % 3000;
+        }
+        else
+        {
+            value = base + i;
+            if (gen() % 50 == 0)
+            {
+                continue;
+            }
+        }
+        assert(bitmap.add(value) == set.insert(value).second);
+    }
+    for (int i = 0; i < count / 4; i++)
+    {
+        uint32_t value = base + gen() % 200000;
+        assert(bitmap.remove(value) == (set.erase(value) > 0));
+    }
+    if (gen() % 2)
+    {
+        bitmap.runOptimize();
+    }
+}
+
+// Membership, cardinality and every set operation agree with std::set for
+// each pairing of container kinds.
+static void testSetOperations()
+{
+    for (int round = 0; round < 300; round++)
+    {
+        RoaringBitmap a;
+        RoaringBitmap b;
+        std::set<uint32_t> setA;
+        std::set<uint32_t> setB;
+        fill(a, setA, gen() % 3);
+        fill(b, setB, gen() % 3);
+        assert(a.toVector() == toVector(setA) && a.cardinality() == setA.size());
+        for (int query = 0; query < 200; query++)
+        {
+            uint32_t value = gen() % 400000;
+            assert(a.contains(value) == (setA.count(value) > 0));
+        }
+
+        std::set<uint32_t> unionSet = setA;
+        unionSet.insert(setB.begin(), setB.end());
+        std::set<uint32_t> intersection;
+        std::set<uint32_t> difference;
+        for (uint32_t value : setA)
+        {
+            (setB.count(value) ? intersection : difference).insert(value);
+        }
+        RoaringBitmap both = a | b;
+        RoaringBitmap common = a & b;
+        RoaringBitmap onlyA = a - b;
+        assert(both.toVector() == toVector(unionSet) && both.cardinality() == unionSet.size());
+        assert(common.toVector() == toVector(intersection) && common.cardinality() == intersection.size());
+        assert(onlyA.toVector() == toVector(difference) && onlyA.cardinality() == difference.size());
+        a -= b;
+        assert(a.toVector() == toVector(difference));
+    }
+}
+
+// A long run of consecutive values shrinks from four 8 KB bitmaps to a few runs.
+static void testRunOptimize()
+{
+    RoaringBitmap bitmap;
+    for (uint32_t value = 1000; value < 200000; value++)
+    {
+        bitmap.add(value);
+    }
+    size_t before = bitmap.memoryBytes();
+    bitmap.runOptimize();
+    assert(bitmap.memoryBytes() < before / 50);
+    assert(bitmap.cardinality() == 199000 && bitmap.contains(1000) && !bitmap.contains(999));
+    bitmap.remove(5000);
+    assert(!bitmap.contains(5000) && bitmap.contains(5001) && bitmap.cardinality() == 198999);
+    bitmap.clear();
+    assert(bitmap.isEmpty());
+}
+
+// Intersections of two million-value sets, timed against probing a std::set.
+static void testThroughput()
+{
+    RoaringBitmap a;
+    RoaringBitmap b;
+    std::set<uint32_t> setA;
+    std::set<uint32_t> setB;
+    for (int i = 0; i < 1000000; i++)
+    {
+        uint32_t x = gen() % 10000000;
+        uint32_t y = gen() % 10000000;
+        a.add(x);
+        b.add(y);
+        setA.insert(x);
+        setB.insert(y);
+    }
+    auto start = std::chrono::steady_clock::now();
+    uint64_t roaringCount = 0;
+    for (int round = 0; round < 10; round++)
+    {
+        roaringCount += (a & b).cardinality();
+    }
+    auto middle = std::chrono::steady_clock::now();
+    uint64_t setCount = 0;
+    for (int round = 0; round < 10; round++)
+    {
+        for (uint32_t value : setA)
+        {
+            setCount += setB.count(value);
+        }
+    }
+    auto end = std::chrono::steady_clock::now();
+    assert(roaringCount == setCount);
+    std::cout << "RoaringBitmap: " << (double)a.memoryBytes() / a.cardinality() << " bytes/value, intersection "
+              << std::chrono::duration<double>(middle - start).count() / 10 * 1e3 << " ms (std::set "
+              << std::chrono::duration<double>(end - middle).count() / 10 * 1e3 << " ms)" << std::endl;
+}
+
+int main()
+{
+    testSetOperations();
+    testRunOptimize();
+    testThroughput();
+    std::cout << "RoaringBitmapTest passed" << std::endl;
+    return 0;
+}
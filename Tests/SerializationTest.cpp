@@ -0,0 +1,218 @@
+/**
+ * @file SerializationTest.cpp
+ * @author Kofi Boateng
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * Build and run: g++ -std=c++17 Tests/SerializationTest.cpp -o SerializationTest && ./SerializationTest
+ *
+ */
+
+#include <cassert>   // for assert
+#include <cstdint>   // for fixed width integers
+#include <cstdlib>   // for rand
+#include <iostream>  // for cout
+#include <stdexcept> // for runtime_error
+#include <string>    // for string elements
+#include <vector>    // for serialized bytes
+#include "../LinkedList/LinkedList.h"
+#include "../Stack/Stack.h"
+#include "../Queue/Queue.h"
+#include "../Trees/BinaryTree/BinarySearchTree.h"
+#include "../Trees/M-Ary_Tree/Tree.h"
+#include "../Trees/PrefixTree/PrefixTree.h"
+
+template <typename Container>
+static std::vector<char> toBytes(const Container &container)
+{
+    std::vector<char> bytes;
+    BinaryWriter writer(bytes);
+    container.serialize(writer);
+    writer.flush();
+    return bytes;
+}
+
+// Reads the first size bytes into container and returns whether that threw.
+template <typename Container>
+static bool loadThrows(Container &container, const std::vector<char> &bytes, size_t size)
+{
+    BinaryReader reader(bytes.data(), size);
+    try
+    {
+        container.deserialize(reader);
+    }
+    catch (const std::runtime_error &)
+    {
+        return true;
+    }
+    return false;
+}
+
+// A container reads back to the same bytes, and every truncation of the
+// stream throws and leaves the container it is read into as it was.
+template <typename Container>
+static void checkRoundTripAndTruncation(const Container &original, Container &untouched)
+{
+    std::vector<char> bytes = toBytes(original);
+    Container loaded;
+    assert(!loadThrows(loaded, bytes, bytes.size()));
+    assert(toBytes(loaded) == bytes);
+
+    std::vector<char> before = toBytes(untouched);
+    for (size_t cut = 0; cut < bytes.size(); cut += 1 + bytes.size() / 64)
+    {
+        assert(loadThrows(untouched, bytes, cut));
+        assert(toBytes(untouched) == before);
+    }
+}
+
+static void testSequences()
+{
+    LinkedList<std::string> list;
+    QueueADT<std::string> queue;
+    Stack<int> stack;
+    for (int i = 0; i < 500; i++)
+    {
+        list.pushBack(std::string(i % 50, (char)('a' + i % 26)));
+        queue.enqueue(std::to_string(i));
+        stack.push(i);
+    }
+    LinkedList<std::string> otherList;
+    otherList.pushBack("kept");
+    QueueADT<std::string> otherQueue;
+    otherQueue.enqueue("kept");
+    Stack<int> otherStack;
+    otherStack.push(-1);
+    checkRoundTripAndTruncation(list, otherList);
+    checkRoundTripAndTruncation(queue, otherQueue);
+    checkRoundTripAndTruncation(stack, otherStack);
+    assert(otherList.size() == 1 && otherQueue.size() == 1 && otherStack.peek() == -1);
+}
+
+static void testBinarySearchTree()
+{
+    BinarySearchTree<int> tree;
+    srand(7);
+    for (int i = 0; i < 2000; i++)
+    {
+        tree.insert(rand() % 1000, "DFS");
+    }
+    BinarySearchTree<int> other;
+    other.insert(42, "DFS");
+    checkRoundTripAndTruncation(tree, other);
+    assert(other.size() == 1 && other.contains(42));
+
+    // Sorted input is a chain as deep as it is long, which must neither
+    // take quadratic time nor recurse.
+    const int chain = 300000;
+    std::vector<char> bytes;
+    {
+        BinaryWriter writer(bytes);
+        writer.beginObject("BSTR", 1);
+        writer.writeSize(chain);
+        for (int i = 0; i < chain; i++)
+        {
+            writer.write((int32_t)i);
+        }
+    }
+    BinarySearchTree<int> degenerate;
+    assert(!loadThrows(degenerate, bytes, bytes.size()));
+    assert(degenerate.size() == chain && toBytes(degenerate) == bytes);
+
+    // 10 turns right at 5, so 4 cannot follow it in a pre-order sequence.
+    std::vector<char> invalid;
+    {
+        BinaryWriter writer(invalid);
+        writer.beginObject("BSTR", 1);
+        writer.writeSize(4);
+        for (int32_t value : {5, 3, 10, 4})
+        {
+            writer.write(value);
+        }
+    }
+    assert(loadThrows(other, invalid, invalid.size()));
+    assert(other.size() == 1 && other.contains(42));
+}
+
+static void testMAryTree()
+{
+    Tree<int> tree(3);
+    for (int i = 0; i < 1000; i++)
+    {
+        tree.insert(i);
+    }
+    Tree<int> other(5);
+    other.insert(42);
+    checkRoundTripAndTruncation(tree, other);
+    assert(other.size() == 1 && other.contains(42));
+
+    // The root claims four children in a 3-ary tree.
+    std::vector<char> invalid;
+    {
+        BinaryWriter writer(invalid);
+        writer.beginObject("MTRE", 1);
+        writer.write((int32_t)3);
+        writer.writeSize(5);
+        writer.write((int32_t)0);
+        writer.writeSize(4);
+        for (int32_t value = 1; value <= 4; value++)
+        {
+            writer.write(value);
+            writer.writeSize(0);
+        }
+    }
+    assert(loadThrows(other, invalid, invalid.size()));
+    assert(other.size() == 1 && other.contains(42));
+}
+
+static void testPrefixTree()
+{
+    PrefixTree tree;
+    std::vector<std::string> words = {"a", "an", "and", "ant", "bee", "been", "zebra"};
+    for (const std::string &word : words)
+    {
+        tree.insert(word);
+    }
+    PrefixTree other;
+    other.insert("kept");
+    checkRoundTripAndTruncation(tree, other);
+    assert(other.size() == 1 && other.search("kept"));
+
+    // A word long enough that walking it recursively would exhaust the stack.
+    tree.insert(std::string(300000, 'q'));
+
+    // The stored word count is ignored in favour of the words actually read.
+    std::vector<char> bytes = toBytes(tree);
+    std::vector<char> header;
+    {
+        BinaryWriter writer(header);
+        writer.beginObject("TRIE", 1);
+    }
+    std::vector<char> lying;
+    {
+        BinaryWriter writer(lying);
+        writer.beginObject("TRIE", 1);
+        writer.write((int64_t)1000000);
+    }
+    lying.insert(lying.end(), bytes.begin() + header.size() + sizeof(int64_t), bytes.end());
+    PrefixTree loaded;
+    assert(!loadThrows(loaded, lying, lying.size()));
+    assert(loaded.size() == (int)words.size() + 1);
+    for (const std::string &word : words)
+    {
+        assert(loaded.search(word));
+    }
+    assert(!loaded.search("be"));
+    assert(loadThrows(other, lying, lying.size() - 1));
+    assert(other.size() == 1 && other.search("kept"));
+}
+
+int main()
+{
+    testSequences();
+    testBinarySearchTree();
+    testMAryTree();
+    testPrefixTree();
+    std::cout << "SerializationTest passed" << std::endl;
+    return 0;
+}
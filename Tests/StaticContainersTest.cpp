@@ -0,0 +1,215 @@
+/**
+ * @file StaticContainersTest.cpp
+ * @author Kofi Boateng
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * Build and run: g++ -std=c++17 -O2 Tests/StaticContainersTest.cpp -o StaticContainersTest && ./StaticContainersTest
+ *
+ */
+
+#include <cassert>       // for assert
+#include <chrono>        // for timing
+#include <iostream>      // for cout
+#include <random>        // for random operations
+#include <stdexcept>     // for runtime_error
+#include <unordered_map> // for the reference map
+#include <vector>        // for the lookup keys
+#include "../Stack/StaticStack.h"
+#include "../Queue/StaticQueue.h"
+#include "../Heap/StaticHeap.h"
+#include "../Hashing/StaticHashTable/StaticHashTable.h"
+
+// The static_asserts check each container inside a constant expression.
+
+constexpr auto squares = []()
+{
+    StaticHashTable<int, int, 64> table;
+    for (int i = 0; i < 40; i++)
+    {
+        table.insert(i * 7, i * i);
+    }
+    table.remove(14);
+    return table;
+}();
+static_assert(squares.get(21) == 9 && !squares.containsKey(14) && squares.size() == 39, "constexpr table");
+
+constexpr int heapOrder()
+{
+    StaticHeap<int, 10> heap;
+    int values[] = {5, 3, 9, 1, 7};
+    for (int value : values)
+    {
+        heap.insert(value);
+    }
+    int digits = 0;
+    while (!heap.isEmpty())
+    {
+        digits = digits * 10 + heap.peek();
+        heap.removeMin();
+    }
+    return digits;
+}
+static_assert(heapOrder() == 13579, "constexpr heap");
+
+// Wraps around the queue's array several times.
+constexpr int queueSum()
+{
+    StaticQueue<int, 4> queue;
+    int sum = 0;
+    for (int i = 0; i < 20; i++)
+    {
+        queue.enqueue(i);
+        if (queue.isFull())
+        {
+            sum += queue.front();
+            queue.dequeue();
+            queue.dequeue();
+        }
+    }
+    return sum;
+}
+static_assert(queueSum() == 0 + 2 + 4 + 6 + 8 + 10 + 12 + 14 + 16, "constexpr queue");
+
+constexpr int stackTop()
+{
+    StaticStack<int, 3> stack;
+    stack.push(1);
+    stack.push(2);
+    stack.pop();
+    return stack.top();
+}
+static_assert(stackTop() == 1, "constexpr stack");
+
+// Random inserts, removals and lookups against std::unordered_map, with the
+// keys crowded into a table that stays nearly full.
+static void testHashTableAgainstMap()
+{
+    std::mt19937 gen(1);
+    for (int round = 0; round < 200; round++)
+    {
+        StaticHashTable<int, int, 256> table;
+        std::unordered_map<int, int> map;
+        for (int i = 0; i < 5000; i++)
+        {
+            int key = gen() % 300;
+            int operation = gen() % 3;
+            if (operation == 0 && (map.size() < 256 || map.count(key)))
+            {
+                table.insert(key, i);
+                map[key] = i;
+            }
+            else if (operation == 1)
+            {
+                assert(table.remove(key) == (map.erase(key) == 1));
+            }
+            else
+            {
+                const int *value = table.find(key);
+                assert((value != nullptr) == (map.count(key) == 1));
+                assert(!value || *value == map[key]);
+            }
+            assert(table.size() == map.size());
+        }
+    }
+}
+
+template <typename Body>
+static bool throws(Body body)
+{
+    try
+    {
+        body();
+    }
+    catch (const std::runtime_error &)
+    {
+        return true;
+    }
+    return false;
+}
+
+// Overfilling or underflowing any container throws instead of writing past it.
+static void testBounds()
+{
+    StaticHashTable<int, int, 4> table;
+    for (int i = 0; i < 4; i++)
+    {
+        table.insert(i, i);
+    }
+    table.insert(2, 20);
+    assert(table.get(2) == 20 && table.size() == 4);
+    assert(throws([&table]()
+                  { table.insert(9, 9); }));
+    assert(throws([&table]()
+                  { table.get(9); }));
+
+    StaticStack<int, 2> stack;
+    StaticQueue<int, 2> queue;
+    StaticHeap<int, 2> heap;
+    assert(throws([&stack]()
+                  { stack.pop(); }));
+    assert(throws([&queue]()
+                  { queue.dequeue(); }));
+    assert(throws([&heap]()
+                  { heap.removeMin(); }));
+    for (int i = 0; i < 2; i++)
+    {
+        stack.push(i);
+        queue.enqueue(i);
+        heap.insert(i);
+    }
+    assert(throws([&stack]()
+                  { stack.push(2); }));
+    assert(throws([&queue]()
+                  { queue.enqueue(2); }));
+    assert(throws([&heap]()
+                  { heap.insert(2); }));
+}
+
+// Lookups in the compile-time table against the same pairs in std::unordered_map.
+static void testLookupSpeed()
+{
+    std::unordered_map<int, int> map;
+    for (int i = 0; i < 40; i++)
+    {
+        if (i != 2)
+        {
+            map[i * 7] = i * i;
+        }
+    }
+    const int lookups = 20000000;
+    std::mt19937 gen(3);
+    std::vector<int> keys(1024);
+    for (int &key : keys)
+    {
+        key = (int)(gen() % 300);
+    }
+    long long staticSum = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < lookups; i++)
+    {
+        const int *value = squares.find(keys[i & 1023]);
+        staticSum += value ? *value : 0;
+    }
+    auto middle = std::chrono::steady_clock::now();
+    long long mapSum = 0;
+    for (int i = 0; i < lookups; i++)
+    {
+        auto found = map.find(keys[i & 1023]);
+        mapSum += found != map.end() ? found->second : 0;
+    }
+    auto end = std::chrono::steady_clock::now();
+    assert(staticSum == mapSum);
+    std::cout << "StaticHashTable lookup: " << std::chrono::duration<double>(middle - start).count() / lookups * 1e9
+              << " ns (std::unordered_map " << std::chrono::duration<double>(end - middle).count() / lookups * 1e9
+              << " ns)" << std::endl;
+}
+
+int main()
+{
+    testHashTableAgainstMap();
+    testBounds();
+    testLookupSpeed();
+    std::cout << "StaticContainersTest passed" << std::endl;
+    return 0;
+}
@@ -0,0 +1,162 @@
+/**
+ * @file SuffixArrayTest.cpp
+ * @author Kofi Boateng
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * Build and run: g++ -std=c++17 -O2 Tests/SuffixArrayTest.cpp -o SuffixArrayTest && ./SuffixArrayTest
+ *
+ */
+
+#include <algorithm> // for sort
+#include <cassert>   // for assert
+#include <chrono>    // for timing
+#include <cstdint>   // for fixed width integers
+#include <iostream>  // for cout
+#include <random>    // for random texts
+#include <string>    // for texts and patterns
+#include <vector>    // for positions
+#include "../Strings/FMIndex/FMIndex.h"
+#include "../Trees/WaveletTree/WaveletTree.h"
+
+// A random string over the first sigma letters, or over every byte value
+// when sigma is 256.
+static std::string randomText(std::mt19937 &gen, int length, int sigma)
+{
+    std::string text;
+    for (int i = 0; i < length; i++)
+    {
+        text.push_back((char)(sigma == 256 ? gen() % 256 : 'a' + gen() % sigma));
+    }
+    return text;
+}
+
+// The start of every suffix the pattern prefixes, so an empty pattern
+// matches each of the n suffixes.
+static std::vector<uint32_t> naiveLocate(const std::string &text, const std::string &pattern)
+{
+    std::vector<uint32_t> positions;
+    for (size_t i = 0; i < text.size() && i + pattern.size() <= text.size(); i++)
+    {
+        if (text.compare(i, pattern.size(), pattern) == 0)
+        {
+            positions.push_back((uint32_t)i);
+        }
+    }
+    return positions;
+}
+
+// Small texts over tiny alphabets hit every repeat and boundary case of the
+// construction; the suffix order and LCP array are checked against sorting.
+static void testConstruction()
+{
+    std::mt19937 gen(3);
+    for (int round = 0; round < 3000; round++)
+    {
+        int sigma = round % 7 == 0 ? 256 : 1 + gen() % 4;
+        std::string text = randomText(gen, gen() % 60, sigma);
+        int n = (int)text.size();
+        SuffixArray<> suffixArray(text);
+
+        std::vector<uint32_t> sorted(n);
+        for (int i = 0; i < n; i++)
+        {
+            sorted[i] = i;
+        }
+        std::sort(sorted.begin(), sorted.end(), [&text](uint32_t a, uint32_t b)
+                  { return text.compare(a, std::string::npos, text, b, std::string::npos) < 0; });
+        assert(suffixArray.suffixes() == sorted);
+
+        std::vector<uint32_t> lcp = suffixArray.computeLcp();
+        assert(n == 0 || lcp[0] == 0);
+        for (int i = 1; i < n; i++)
+        {
+            uint32_t a = sorted[i - 1];
+            uint32_t b = sorted[i];
+            uint32_t common = 0;
+            while (a + common < (uint32_t)n && b + common < (uint32_t)n && text[a + common] == text[b + common])
+            {
+                common++;
+            }
+            assert(lcp[i] == common);
+        }
+    }
+}
+
+// Both indexes count and locate every pattern as a scan of the text would,
+// whatever the FM-index's sampling rate.
+static void testSearch()
+{
+    std::mt19937 gen(5);
+    for (int round = 0; round < 2000; round++)
+    {
+        int sigma = round % 7 == 0 ? 256 : 1 + gen() % 4;
+        std::string text = randomText(gen, gen() % 80, sigma);
+        SuffixArray<> suffixArray(text);
+        FMIndex<> fmIndex(text, 1 + gen() % 5);
+        assert(fmIndex.size() == text.size());
+        for (int query = 0; query < 20; query++)
+        {
+            std::string pattern = randomText(gen, gen() % 4, sigma);
+            if (query == 0 && text.size() > 2)
+            {
+                pattern = text.substr(1, 2);
+            }
+            std::vector<uint32_t> expected = naiveLocate(text, pattern);
+            assert(suffixArray.locate(pattern) == expected);
+            assert(suffixArray.count(pattern) == expected.size());
+            assert(fmIndex.locate(pattern) == expected);
+            assert(fmIndex.count(pattern) == expected.size());
+            assert(fmIndex.contains(pattern) == !expected.empty());
+        }
+    }
+}
+
+static void testWaveletTree()
+{
+    std::mt19937 gen(7);
+    std::vector<uint16_t> symbols;
+    for (int i = 0; i < 5000; i++)
+    {
+        symbols.push_back(gen() % 300);
+    }
+    WaveletTree<uint16_t> tree(symbols, 300);
+    for (size_t i = 0; i < symbols.size(); i += 7)
+    {
+        assert(tree.access(i) == symbols[i]);
+        for (uint16_t symbol = 0; symbol < 300; symbol += 37)
+        {
+            assert(tree.rank(symbol, i) == (size_t)std::count(symbols.begin(), symbols.begin() + i, symbol));
+        }
+    }
+}
+
+// Build times and the FM-index footprint on a 4M-character DNA-like text.
+static void testLargeText()
+{
+    std::mt19937 gen(11);
+    std::string text = randomText(gen, 1 << 22, 4);
+    auto start = std::chrono::steady_clock::now();
+    SuffixArray<> suffixArray(text);
+    auto built = std::chrono::steady_clock::now();
+    FMIndex<> fmIndex(suffixArray);
+    auto indexed = std::chrono::steady_clock::now();
+    std::cout << "SuffixArray on " << text.size() << " characters: "
+              << std::chrono::duration<double>(built - start).count() << " s" << std::endl;
+    std::cout << "FMIndex: " << std::chrono::duration<double>(indexed - built).count() << " s, "
+              << (double)fmIndex.memoryBytes() / text.size() << " bytes/character" << std::endl;
+
+    std::string pattern = text.substr(text.size() / 2, 12);
+    std::vector<uint32_t> positions = suffixArray.locate(pattern);
+    assert(!positions.empty() && fmIndex.locate(pattern) == positions);
+}
+
+int main()
+{
+    testConstruction();
+    testSearch();
+    testWaveletTree();
+    testLargeText();
+    std::cout << "SuffixArrayTest passed" << std::endl;
+    return 0;
+}
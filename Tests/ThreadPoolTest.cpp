@@ -0,0 +1,103 @@
+/**
+ * @file ThreadPoolTest.cpp
+ * @author Kofi Boateng
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * Build and run: g++ -std=c++17 -pthread Tests/ThreadPoolTest.cpp -o ThreadPoolTest && ./ThreadPoolTest
+ *
+ */
+
+#include <atomic>    // for counters
+#include <cassert>   // for assert
+#include <chrono>    // for sleeping tasks
+#include <ctime>     // for clock
+#include <iostream>  // for cout
+#include <stdexcept> // for runtime_error
+#include <thread>    // for sleep_for
+#include "../Concurrency/ThreadPool.h"
+
+// Cancelling a group, directly or through a task that throws, leaves the
+// caller's token alone, while cancelling the caller's token reaches the group.
+static void testGroupHasItsOwnToken()
+{
+    ThreadPool pool(4);
+    CancellationToken token;
+    {
+        ThreadPool::TaskGroup group(pool, token);
+        group.cancel();
+        assert(group.token().isCancelled());
+        assert(!token.isCancelled());
+    }
+
+    bool thrown = false;
+    try
+    {
+        pool.parallelFor(1000, [](size_t begin, size_t)
+                         {
+            if (begin == 0)
+            {
+                throw std::runtime_error("piece failed");
+            } }, 1, token);
+    }
+    catch (const std::runtime_error &)
+    {
+        thrown = true;
+    }
+    assert(thrown && !token.isCancelled());
+
+    // The same token still runs every piece of the next loop.
+    std::atomic<size_t> covered(0);
+    pool.parallelFor(1000, [&covered](size_t begin, size_t end)
+                     { covered += end - begin; }, 1, token);
+    assert(covered == 1000);
+
+    ThreadPool::TaskGroup group(pool, token);
+    token.cancel();
+    assert(group.token().isCancelled());
+}
+
+// Parallel loops nested inside tasks all finish.
+static void testNestedLoops()
+{
+    ThreadPool pool(4);
+    std::atomic<size_t> total(0);
+    for (int round = 0; round < 20; round++)
+    {
+        pool.parallelFor(64, [&pool, &total](size_t begin, size_t end)
+                         {
+            for (size_t i = begin; i < end; i++)
+            {
+                pool.parallelFor(256, [&total](size_t first, size_t last)
+                                 { total += last - first; }, 8);
+            } }, 1);
+    }
+    assert(total == (size_t)20 * 64 * 256);
+}
+
+// A thread waiting for a group whose task is busy elsewhere sleeps instead of
+// spinning, so the process uses little CPU while the task sleeps.
+static void testWaitSleeps()
+{
+    ThreadPool pool(4);
+    // Let the idle workers go to sleep first.
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    std::clock_t start = std::clock();
+    {
+        ThreadPool::TaskGroup group(pool);
+        group.run([]()
+                  { std::this_thread::sleep_for(std::chrono::milliseconds(300)); });
+        group.wait();
+    }
+    double seconds = (double)(std::clock() - start) / CLOCKS_PER_SEC;
+    assert(seconds < 0.15);
+}
+
+int main()
+{
+    testGroupHasItsOwnToken();
+    testNestedLoops();
+    testWaitSleeps();
+    std::cout << "ThreadPoolTest passed" << std::endl;
+    return 0;
+}
@@ -13,12 +13,29 @@
 #include <ostream>   // for::ostream
 #include <queue>     //queue used for BFS algorithms
 #include <cmath>
+#include <vector>    // for the serialization walk
+#include "../../Serialization/BinaryStream.h"
 
 // This is an implementation of a AVL Tree (Self-Balancing BST). a AVL Tree
 // follows the same princples of a Binary Search Tree, however upon insertion
 // and deletion, the tree will rebalance itself to keep the tree balanced.
+// Every node can also carry an augmentation, a summary of its subtree (for example the largest
+// interval endpoint below it, see Trees/IntervalTree/IntervalTree.h). The Augmentation policy
+// provides a Value type and an update(node) function that recomputes a node's value from its own
+// data and its children's values. It is refreshed wherever the height is, including inside
+// leftRotation and rightRotation and on the way back up from insert and remove, so it stays correct
+// without any extra passes over the tree.
+
+// The default augmentation, which stores nothing.
+struct NoAugmentation
+{
+    typedef bool Value;
+
+    template <typename Node>
+    static void update(Node *) {}
+};
 
-template <typename T>
+template <typename T, typename Augmentation = NoAugmentation>
 class AVLBinaryTree
 {
 public:
@@ -45,16 +62,19 @@ public:
         // the tree is left heavy, and vice versa.
         int balanceFactor;
 
+        // Summary of this node's subtree, maintained by the Augmentation policy.
+        typename Augmentation::Value augment;
+
         // Default constructor: This lets data be constructed by
         // the default constructor of the T type.
-        Node() : left(nullptr), right(nullptr), height(0), balanceFactor(0) {}
+        Node() : left(nullptr), right(nullptr), height(0), balanceFactor(0), augment() {}
 
         // Argument constructor
-        Node(const T &dataArg) : left(nullptr), right(nullptr), data(dataArg), height(0), balanceFactor(0) {}
+        Node(const T &dataArg) : left(nullptr), right(nullptr), data(dataArg), height(0), balanceFactor(0), augment() {}
 
         // Copy constructor: Constructs a new node to be identical to the node being
         // copied.
-        Node(const Node &other) : left(other.left), right(other.right), data(other.data), height(other.height), balanceFactor(other.balanceFactor) {}
+        Node(const Node &other) : left(other.left), right(other.right), data(other.data), height(other.height), balanceFactor(other.balanceFactor), augment(other.augment) {}
 
         // Copy assignment operator
         Node &operator=(const Node &other)
@@ -64,6 +84,7 @@ public:
             data = other.data;
             height = other.height;
             balanceFactor = other.balanceFactor;
+            augment = other.augment;
             return *this;
         }
 
@@ -74,10 +95,10 @@ public:
     };
 
     // ====================================================================================
-    // Private variables and methods
+    // Protected variables and methods (derived trees such as IntervalTree reuse them)
     // ====================================================================================
 
-private:
+protected:
     Node *root;
     int treeSize;
 
@@ -98,12 +119,22 @@ private:
     // DFS helper for insertions
     Node *DFSInsertHelper(const T &element, Node *node);
 
-    // DFS helper for removals
-    void DFSRemoveHelper(const T &element, Node *node);
+    // Removes one element equal to element from node's subtree and returns
+    // the subtree's new root, setting removed if there was one. Every node on
+    // the path gets its height and augmentation refreshed and is rebalanced on
+    // the way back up.
+    Node *removeNode(Node *node, const T &element, bool &removed);
+
+    // Removes the leftmost node of node's subtree and returns the new root.
+    Node *removeLeftmost(Node *node);
 
-    // A helper function that is called if the element passed
-    // is not the root
-    void removeHelper(const T &element, Node *root);
+    // Refreshes node's height and augmentation, then rebalances it.
+    Node *rebalance(Node *node)
+    {
+        updateHeight(node);
+        Augmentation::update(node);
+        return checkBalanceAndUpdate(node);
+    }
 
     // Retrieves the pointer to the node we are trying to remove.
     // We will use this pointer to find the In-order predecessor
@@ -136,6 +167,8 @@ private:
     // Updates the height of a node
     void updateHeight(Node *node);
 
+    // Both rotations refresh the height and augmentation of the two nodes whose
+    // subtrees changed, lower node first.
     // Performs a right rotation on the parent node. Right rotations are classified
     // as rotating a stick formation in a left subtree. A stick formation will
     // generate a +2 height when doing height calculations in the left subtree.
@@ -166,6 +199,10 @@ private:
     // child will produce a height of -1 meaning there is only a right node available.
     Node *leftRightRotation(Node *node);
 
+    // Builds a balanced subtree from the sorted values [begin, end) by making
+    // the middle value the root and recursing on each half. O(n), no rotations.
+    Node *buildBalancedTree(const std::vector<T> &values, size_t begin, size_t end);
+
     // Prints the tree in order.
     void inorderTreeTraversalPrint(Node *node);
 
@@ -214,6 +251,7 @@ public:
     {
         if (root)
             clearTree(root);
+        root = nullptr;
 
         if (treeSize != 0)
         {
@@ -224,18 +262,25 @@ public:
     // Checks for equality between two list.
     // Two list are equal if they have the same
     // length and same data at each position. O(n).
-    bool equals(const AVLBinaryTree<T> &obj) const;
-    bool operator==(const AVLBinaryTree<T> &obj) const { return equals(obj); }
-    bool operator!=(const AVLBinaryTree<T> &obj) const { return !equals(obj); }
+    bool equals(const AVLBinaryTree<T, Augmentation> &obj) const;
+    bool operator==(const AVLBinaryTree<T, Augmentation> &obj) const { return equals(obj); }
+    bool operator!=(const AVLBinaryTree<T, Augmentation> &obj) const { return !equals(obj); }
 
     // Takes in a request (In,Pre, or Post) and then prints the tree in that order.
     std::ostream &print(std::ostream &os, const std::string &type);
 
+    // Writes the elements to writer in sorted order (Refer to Serialization/BinaryStream.h).
+    void serialize(BinaryWriter &writer) const;
+    // Replaces the contents of the tree with one read from reader. The sorted
+    // elements are built straight into a balanced tree. If reading fails the
+    // tree is left as it was.
+    void deserialize(BinaryReader &reader);
+
     // Default Constructor: creates an empty tree
     AVLBinaryTree() : root(nullptr), treeSize(0) {}
 
     // We will run a BFS algorithm to copy nodes at each level
-    AVLBinaryTree<T> &operator=(const AVLBinaryTree<T> &other)
+    AVLBinaryTree<T, Augmentation> &operator=(const AVLBinaryTree<T, Augmentation> &other)
     {
 
         clear();
@@ -268,7 +313,7 @@ public:
 
     // The copy constructor begins by constructing the default LinkedList,
     // then it does copy assignment from the other list.
-    AVLBinaryTree(const AVLBinaryTree<T> &other) : AVLBinaryTree()
+    AVLBinaryTree(const AVLBinaryTree<T, Augmentation> &other) : AVLBinaryTree()
     {
         *this = other;
     }
@@ -288,8 +333,8 @@ public:
 // Private Helper Functions
 // =========================================================
 
-template <typename T>
-void AVLBinaryTree<T>::clearTree(Node *node)
+template <typename T, typename Augmentation>
+void AVLBinaryTree<T, Augmentation>::clearTree(Node *node)
 {
     if (!node)
     {
@@ -299,13 +344,14 @@ void AVLBinaryTree<T>::clearTree(Node *node)
     clearTree(node->left);
     clearTree(node->right);
 
-    delete node;
     node->right = nullptr;
     node->left = nullptr;
+    delete node;
+    treeSize--;
 }
 
-template <typename T>
-typename AVLBinaryTree<T>::Node *AVLBinaryTree<T>::retrieveNodeDFS(const T &element, Node *node)
+template <typename T, typename Augmentation>
+typename AVLBinaryTree<T, Augmentation>::Node *AVLBinaryTree<T, Augmentation>::retrieveNodeDFS(const T &element, Node *node)
 {
     if (!node)
     {
@@ -331,8 +377,8 @@ typename AVLBinaryTree<T>::Node *AVLBinaryTree<T>::retrieveNodeDFS(const T &elem
     return value;
 }
 
-template <typename T>
-typename AVLBinaryTree<T>::Node *AVLBinaryTree<T>::retrieveNodeBFS(const T &element, Node *node)
+template <typename T, typename Augmentation>
+typename AVLBinaryTree<T, Augmentation>::Node *AVLBinaryTree<T, Augmentation>::retrieveNodeBFS(const T &element, Node *node)
 {
     if (!node || !element)
     {
@@ -364,8 +410,8 @@ typename AVLBinaryTree<T>::Node *AVLBinaryTree<T>::retrieveNodeBFS(const T &elem
     return value;
 }
 
-template <typename T>
-typename AVLBinaryTree<T>::Node *AVLBinaryTree<T>::binarySearchDFS(Node *node, const T &src)
+template <typename T, typename Augmentation>
+typename AVLBinaryTree<T, Augmentation>::Node *AVLBinaryTree<T, Augmentation>::binarySearchDFS(Node *node, const T &src)
 {
     if (!node)
     {
@@ -392,8 +438,8 @@ typename AVLBinaryTree<T>::Node *AVLBinaryTree<T>::binarySearchDFS(Node *node, c
 }
 
 // BFS search algorithm that returns a pointer to a node on the heap.
-template <typename T>
-typename AVLBinaryTree<T>::Node *AVLBinaryTree<T>::binarySearchBFS(Node *node, const T &src)
+template <typename T, typename Augmentation>
+typename AVLBinaryTree<T, Augmentation>::Node *AVLBinaryTree<T, Augmentation>::binarySearchBFS(Node *node, const T &src)
 {
     std::queue<Node *> queue;
     queue.push(node);
@@ -419,8 +465,8 @@ typename AVLBinaryTree<T>::Node *AVLBinaryTree<T>::binarySearchBFS(Node *node, c
     return nullptr;
 }
 
-template <typename T>
-void AVLBinaryTree<T>::inorderTreeTraversalPrint(Node *node)
+template <typename T, typename Augmentation>
+void AVLBinaryTree<T, Augmentation>::inorderTreeTraversalPrint(Node *node)
 {
     if (!node)
     {
@@ -432,8 +478,8 @@ void AVLBinaryTree<T>::inorderTreeTraversalPrint(Node *node)
     inorderTreeTraversalPrint(node->right);
 }
 
-template <typename T>
-void AVLBinaryTree<T>::preorderTreeTraversalPrint(Node *node)
+template <typename T, typename Augmentation>
+void AVLBinaryTree<T, Augmentation>::preorderTreeTraversalPrint(Node *node)
 {
     if (!node)
     {
@@ -444,8 +490,8 @@ void AVLBinaryTree<T>::preorderTreeTraversalPrint(Node *node)
     inorderTreeTraversalPrint(node->right);
 }
 
-template <typename T>
-void AVLBinaryTree<T>::postorderTreeTraversalPrint(Node *node)
+template <typename T, typename Augmentation>
+void AVLBinaryTree<T, Augmentation>::postorderTreeTraversalPrint(Node *node)
 {
     if (!node)
     {
@@ -456,8 +502,8 @@ void AVLBinaryTree<T>::postorderTreeTraversalPrint(Node *node)
     std::cout << node->data << "-";
 }
 
-template <typename T>
-typename AVLBinaryTree<T>::Node *AVLBinaryTree<T>::retrieveFurthestRightNodeDFS(Node *node)
+template <typename T, typename Augmentation>
+typename AVLBinaryTree<T, Augmentation>::Node *AVLBinaryTree<T, Augmentation>::retrieveFurthestRightNodeDFS(Node *node)
 {
     if (!node->right && !node->left)
     {
@@ -476,8 +522,8 @@ typename AVLBinaryTree<T>::Node *AVLBinaryTree<T>::retrieveFurthestRightNodeDFS(
     return value;
 }
 
-template <typename T>
-typename AVLBinaryTree<T>::Node *AVLBinaryTree<T>::retrieveFurthestLeftNodeDFS(Node *node)
+template <typename T, typename Augmentation>
+typename AVLBinaryTree<T, Augmentation>::Node *AVLBinaryTree<T, Augmentation>::retrieveFurthestLeftNodeDFS(Node *node)
 {
     if (!node->left && !node->right)
     {
@@ -496,8 +542,8 @@ typename AVLBinaryTree<T>::Node *AVLBinaryTree<T>::retrieveFurthestLeftNodeDFS(N
     return value;
 }
 
-template <typename T>
-typename AVLBinaryTree<T>::Node *AVLBinaryTree<T>::retrieveFurthestRightNodeBFS(Node *node)
+template <typename T, typename Augmentation>
+typename AVLBinaryTree<T, Augmentation>::Node *AVLBinaryTree<T, Augmentation>::retrieveFurthestRightNodeBFS(Node *node)
 {
     std::queue<Node *> queue;
     Node *value = nullptr;
@@ -528,8 +574,8 @@ typename AVLBinaryTree<T>::Node *AVLBinaryTree<T>::retrieveFurthestRightNodeBFS(
     return value;
 }
 
-template <typename T>
-typename AVLBinaryTree<T>::Node *AVLBinaryTree<T>::retrieveFurthestLeftNodeBFS(Node *node)
+template <typename T, typename Augmentation>
+typename AVLBinaryTree<T, Augmentation>::Node *AVLBinaryTree<T, Augmentation>::retrieveFurthestLeftNodeBFS(Node *node)
 {
     std::queue<Node *> queue;
     Node *value = nullptr;
@@ -560,16 +606,16 @@ typename AVLBinaryTree<T>::Node *AVLBinaryTree<T>::retrieveFurthestLeftNodeBFS(N
     return value;
 }
 
-template <typename T>
-int AVLBinaryTree<T>::calculateHeightOfTree(Node *node) const
+template <typename T, typename Augmentation>
+int AVLBinaryTree<T, Augmentation>::calculateHeightOfTree(Node *node) const
 {
     int left = !node->left ? -1 : node->left->height;
     int right = !node->right ? -1 : node->right->height;
     return right - left;
 }
 
-template <typename T>
-void AVLBinaryTree<T>::updateHeight(Node *node)
+template <typename T, typename Augmentation>
+void AVLBinaryTree<T, Augmentation>::updateHeight(Node *node)
 {
     int left = !node->left ? -1 : node->left->height;
     int right = !node->right ? -1 : node->right->height;
@@ -577,13 +623,12 @@ void AVLBinaryTree<T>::updateHeight(Node *node)
     node->balanceFactor = right - left;
 }
 
-template <typename T>
-typename AVLBinaryTree<T>::Node *AVLBinaryTree<T>::checkBalanceAndUpdate(Node *node)
+template <typename T, typename Augmentation>
+typename AVLBinaryTree<T, Augmentation>::Node *AVLBinaryTree<T, Augmentation>::checkBalanceAndUpdate(Node *node)
 {
     // If the balance factor == +2, then we know the tree is not balanced and is left heavy.
     if (node->balanceFactor == -2)
     {
-        std::cout << "[IN PROGRESS]: Performing reorganizing of a left subtree....." << std::endl;
         // Check for specfic rotation type by grabbing the balance factor of left child
         // Case One: Left-Left || Stick Formation
         if (node->left->balanceFactor <= 0)
@@ -600,7 +645,6 @@ typename AVLBinaryTree<T>::Node *AVLBinaryTree<T>::checkBalanceAndUpdate(Node *n
     // If the balance factor is == +2, then we know the tree is not balanced and is right heavy.
     else if (node->balanceFactor == 2)
     {
-        std::cout << "[IN PROGRESS]: Performing reorganizing of a right subtree....." << std::endl;
         // Check for specfic rotation type by grabbing the balance factor of right child
         // Case One: Right-Right || Stick Formation
         if (node->right->balanceFactor >= 0)
@@ -618,14 +662,15 @@ typename AVLBinaryTree<T>::Node *AVLBinaryTree<T>::checkBalanceAndUpdate(Node *n
 }
 
 // Helper function for Insert
-template <typename T>
-typename AVLBinaryTree<T>::Node *AVLBinaryTree<T>::DFSInsertHelper(const T &element, Node *node)
+template <typename T, typename Augmentation>
+typename AVLBinaryTree<T, Augmentation>::Node *AVLBinaryTree<T, Augmentation>::DFSInsertHelper(const T &element, Node *node)
 {
 
     if (!node)
     {
         treeSize++;
         Node *newNode = new Node(element);
+        Augmentation::update(newNode);
         return newNode;
     }
     if (element > node->data)
@@ -643,159 +688,118 @@ typename AVLBinaryTree<T>::Node *AVLBinaryTree<T>::DFSInsertHelper(const T &elem
         node->left = checkBalanceAndUpdate(node->left);
     }
     updateHeight(node);
+    Augmentation::update(node);
     return checkBalanceAndUpdate(node);
 }
 
-template <typename T>
-void AVLBinaryTree<T>::DFSRemoveHelper(const T &element, Node *node)
-{
-    if (!node)
-    {
-        return;
-    }
-
-    DFSRemoveHelper(element, node->left);
-    DFSRemoveHelper(element, node->right);
-    if (node->left && node->left->data == element)
-    {
-        treeSize--;
-        delete node->left;
-        node->left->left = nullptr;
-        node->left->right = nullptr;
-        node->left = nullptr;
-        return;
-    }
-    else if (node->right && node->right->data == element)
-    {
-        treeSize--;
-        delete node->right;
-        node->right->left = nullptr;
-        node->right->right = nullptr;
-        node->right = nullptr;
-        return;
-    }
-}
-
 // ===============================
 // Height balancing algorithms
 // ===============================
 
-template <typename T>
-typename AVLBinaryTree<T>::Node *AVLBinaryTree<T>::leftRightRotation(Node *node)
+template <typename T, typename Augmentation>
+typename AVLBinaryTree<T, Augmentation>::Node *AVLBinaryTree<T, Augmentation>::leftRightRotation(Node *node)
 {
     node->left = leftRotation(node->left);
     return rightRotation(node);
 }
 
-template <typename T>
-typename AVLBinaryTree<T>::Node *AVLBinaryTree<T>::rightLeftRotation(Node *node)
+template <typename T, typename Augmentation>
+typename AVLBinaryTree<T, Augmentation>::Node *AVLBinaryTree<T, Augmentation>::rightLeftRotation(Node *node)
 {
     node->right = rightRotation(node->right);
     return leftRotation(node);
 }
 
-template <typename T>
-typename AVLBinaryTree<T>::Node *AVLBinaryTree<T>::leftRotation(Node *node)
+template <typename T, typename Augmentation>
+typename AVLBinaryTree<T, Augmentation>::Node *AVLBinaryTree<T, Augmentation>::leftRotation(Node *node)
 {
     Node *newParent = node->right;
     node->right = newParent->left;
     newParent->left = node;
     updateHeight(node);
     updateHeight(newParent);
+    Augmentation::update(node);
+    Augmentation::update(newParent);
     return newParent;
 }
 
-template <typename T>
-typename AVLBinaryTree<T>::Node *AVLBinaryTree<T>::rightRotation(Node *node)
+template <typename T, typename Augmentation>
+typename AVLBinaryTree<T, Augmentation>::Node *AVLBinaryTree<T, Augmentation>::rightRotation(Node *node)
 {
     Node *newParent = node->left;
     node->left = newParent->right;
     newParent->right = node;
     updateHeight(node);
     updateHeight(newParent);
+    Augmentation::update(node);
+    Augmentation::update(newParent);
     return newParent;
 }
 
-template <typename T>
-void AVLBinaryTree<T>::removeHelper(const T &element, Node *node)
+template <typename T, typename Augmentation>
+typename AVLBinaryTree<T, Augmentation>::Node *AVLBinaryTree<T, Augmentation>::removeLeftmost(Node *node)
 {
-    // Phase One: Find the parent node of the node designated for removal;
-    Node *foundNode = retrieveNodeDFS(element, node);
-    // Phase Two: Check which side we can swap the data with.
-    if (!foundNode->left && !foundNode->right)
+    if (!node->left)
     {
-        // We have found a leaf node
-        DFSRemoveHelper(element, node);
+        Node *right = node->right;
+        delete node;
+        treeSize--;
+        return right;
     }
-    else if (!foundNode->left)
-    {
-        Node *biggestRightNode = retrieveFurthestLeftNodeDFS(foundNode->right);
-        if (!biggestRightNode)
-        {
-            throw new std::runtime_error("Error retrieving parent. Check implementation of parent retrieval.");
-        }
-        // Here we are ONLY swapping the data and will not perform pointer manipulation. We only care to remove
-        // the foundNode element from existence while keeping the invariant in tact, therefore swapping foundNode's
-        // data with a leaf node of the biggestLeftNodeParent's right element will allow for use to call a regular
-        // removal function on that element later.
-        T temp = biggestRightNode->data;
-        biggestRightNode->data = foundNode->data;
-        foundNode->data = temp;
+    node->left = removeLeftmost(node->left);
+    return rebalance(node);
+}
 
-        DFSRemoveHelper(biggestRightNode->data, node);
+template <typename T, typename Augmentation>
+typename AVLBinaryTree<T, Augmentation>::Node *AVLBinaryTree<T, Augmentation>::removeNode(Node *node, const T &element, bool &removed)
+{
+    if (!node)
+    {
+        return nullptr;
     }
-    // The right side contains the actuall element
-    else if (!foundNode->right)
+    if (element < node->data)
     {
-
-        Node *biggestLeftNode = retrieveFurthestRightNodeDFS(foundNode->left);
-
-        if (!biggestLeftNode)
-        {
-            throw new std::runtime_error("Error retrieving parent. Check implementation of parent retrieval.");
-        }
-        // Here we are ONLY swapping the data and will not perform pointer manipulation. We only care to remove
-        // the foundNode element from existence while keeping the invariant in tact, therefore swapping foundNode's
-        // data with a leaf node of the biggestLeftNodeParent's right element will allow for use to call a regular
-        // removal function on that element later.
-        T temp = biggestLeftNode->data;
-        biggestLeftNode->data = foundNode->data;
-        foundNode->data = temp;
-
-        DFSRemoveHelper(biggestLeftNode->data, node);
+        node->left = removeNode(node->left, element, removed);
+    }
+    else if (node->data < element)
+    {
+        node->right = removeNode(node->right, element, removed);
     }
-    // Node has two children swap so you can swap from any side.
     else
     {
-        Node *biggestLeftNode = retrieveFurthestLeftNodeDFS(foundNode->right);
-
-        if (!biggestLeftNode)
+        removed = true;
+        // With at most one child, the child takes the node's place.
+        if (!node->left || !node->right)
         {
-            throw new std::runtime_error("Error retrieving parent. Check implementation of parent retrieval.");
+            Node *child = node->left ? node->left : node->right;
+            delete node;
+            treeSize--;
+            return child;
         }
-        // Here we are ONLY swapping the data and will not perform pointer manipulation. We only care to remove
-        // the foundNode element from existence while keeping the invariant in tact, therefore swapping foundNode's
-        // data with a leaf node of the biggestLeftNodeParent's right element will allow for use to call a regular
-        // removal function on that element later.
-        T temp = biggestLeftNode->data;
-        biggestLeftNode->data = foundNode->data;
-        foundNode->data = temp;
-
-        DFSRemoveHelper(biggestLeftNode->data, node);
+        // Two children: take over the in-order successor's data and remove
+        // the successor from the right subtree.
+        Node *successor = node->right;
+        while (successor->left)
+        {
+            successor = successor->left;
+        }
+        node->data = successor->data;
+        node->right = removeLeftmost(node->right);
     }
-    Node *temp = checkBalanceAndUpdate(node);
+    return rebalance(node);
 }
 
 // =========================================================
 // Public Methods
 // =========================================================
-template <typename T>
-void AVLBinaryTree<T>::insert(const T &arg)
+template <typename T, typename Augmentation>
+void AVLBinaryTree<T, Augmentation>::insert(const T &arg)
 {
     std::cout << "[IN PROGRESS]: Inserting: " << arg << " ...." << std::endl;
     if (!root)
     {
         Node *newRoot = new Node(arg);
+        Augmentation::update(newRoot);
         root = newRoot;
         treeSize++;
         return;
@@ -806,29 +810,16 @@ void AVLBinaryTree<T>::insert(const T &arg)
     }
 }
 
-template <typename T>
-void AVLBinaryTree<T>::remove(const T &arg)
+template <typename T, typename Augmentation>
+void AVLBinaryTree<T, Augmentation>::remove(const T &arg)
 {
     std::cout << "[IN PROGRESS]: Removing: " << arg << " ...." << std::endl;
-    if (!root)
-    {
-        return;
-    }
-
-    else if (treeSize == 1)
-    {
-        delete root;
-        treeSize--;
-    }
-
-    else
-    {
-        removeHelper(arg, root);
-    }
+    bool removed = false;
+    root = removeNode(root, arg, removed);
 }
 
-template <typename T>
-bool AVLBinaryTree<T>::binarySearch(const T &src, std::string type)
+template <typename T, typename Augmentation>
+bool AVLBinaryTree<T, Augmentation>::binarySearch(const T &src, std::string type)
 {
     if (!src || !root)
     {
@@ -845,8 +836,8 @@ bool AVLBinaryTree<T>::binarySearch(const T &src, std::string type)
     return prospect != nullptr;
 }
 
-template <typename T>
-bool AVLBinaryTree<T>::isBalanced() const
+template <typename T, typename Augmentation>
+bool AVLBinaryTree<T, Augmentation>::isBalanced() const
 {
     if (!root)
     {
@@ -856,14 +847,14 @@ bool AVLBinaryTree<T>::isBalanced() const
     return calculateHeightOfTree(root) == 0;
 }
 
-template <typename T>
-bool AVLBinaryTree<T>::contains(const T &element)
+template <typename T, typename Augmentation>
+bool AVLBinaryTree<T, Augmentation>::contains(const T &element)
 {
     return binarySearch(element, "DFS");
 }
 
-template <typename T>
-std::ostream &AVLBinaryTree<T>::print(std::ostream &os, const std::string &type)
+template <typename T, typename Augmentation>
+std::ostream &AVLBinaryTree<T, Augmentation>::print(std::ostream &os, const std::string &type)
 {
     // List format will be [1-2-3], etc.
     if (!root)
@@ -893,8 +884,8 @@ std::ostream &AVLBinaryTree<T>::print(std::ostream &os, const std::string &type)
     return os;
 }
 
-template <typename T>
-bool AVLBinaryTree<T>::equals(const AVLBinaryTree<T> &other) const
+template <typename T, typename Augmentation>
+bool AVLBinaryTree<T, Augmentation>::equals(const AVLBinaryTree<T, Augmentation> &other) const
 {
     if (!root || size() != other.size())
     {
@@ -945,4 +936,67 @@ bool AVLBinaryTree<T>::equals(const AVLBinaryTree<T> &other) const
     }
 
     return queueOther.empty() && queueThis.empty();
-}
\ No newline at end of file
+}
+
+template <typename T, typename Augmentation>
+void AVLBinaryTree<T, Augmentation>::serialize(BinaryWriter &writer) const
+{
+    writer.beginObject("AVLT", 1);
+    writer.writeSize(treeSize);
+    // In-order with an explicit stack.
+    std::vector<const Node *> stack;
+    const Node *node = root;
+    while (node || !stack.empty())
+    {
+        while (node)
+        {
+            stack.push_back(node);
+            node = node->left;
+        }
+        node = stack.back();
+        stack.pop_back();
+        writer.write(node->data);
+        node = node->right;
+    }
+}
+
+template <typename T, typename Augmentation>
+typename AVLBinaryTree<T, Augmentation>::Node *AVLBinaryTree<T, Augmentation>::buildBalancedTree(const std::vector<T> &values, size_t begin, size_t end)
+{
+    if (begin >= end)
+    {
+        return nullptr;
+    }
+    size_t middle = begin + (end - begin) / 2;
+    Node *node = new Node(values[middle]);
+    node->left = buildBalancedTree(values, begin, middle);
+    node->right = buildBalancedTree(values, middle + 1, end);
+    updateHeight(node);
+    Augmentation::update(node);
+    return node;
+}
+
+template <typename T, typename Augmentation>
+void AVLBinaryTree<T, Augmentation>::deserialize(BinaryReader &reader)
+{
+    reader.beginObject("AVLT", 1);
+    size_t count = reader.readSize();
+    if (count > (size_t)INT32_MAX)
+    {
+        throw std::runtime_error("Error: serialized AVLBinaryTree is too large.");
+    }
+    // Read everything before touching the tree. The count is not trusted
+    // for the up-front reservation; a short stream fails while reading.
+    std::vector<T> values;
+    values.reserve(count < ((size_t)1 << 16) ? count : ((size_t)1 << 16));
+    for (size_t i = 0; i < count; i++)
+    {
+        T value;
+        reader.read(value);
+        values.push_back(std::move(value));
+    }
+    // The writer went in order, so the values are already sorted.
+    clear();
+    root = buildBalancedTree(values, 0, values.size());
+    treeSize = (int)values.size();
+}
@@ -12,6 +12,9 @@
 #include <stdexcept> // for runtime_error
 #include <ostream>   // for::ostream
 #include <queue>     // For BFS algorithms
+#include <vector>    // for the serialization walk
+#include <utility>   // for swap
+#include "../../Serialization/BinaryStream.h"
 
 // This is an implementation of a BinarySearchTree (BST). A BST is a type
 // of tree which follows the the tree invariant as well as every node to
@@ -64,8 +67,8 @@ private:
     Node *root;
     int treeSize;
 
-    // ClearTree is used to recursively remove elements from the
-    // the tree during deallocation via a Post-Order Traversal.
+    // ClearTree is used to remove elements from the the tree
+    // during deallocation.
     void clearTree(Node *node);
 
     // Searches the tree for an element and will return a bool.
@@ -169,6 +172,7 @@ public:
     {
         if (root)
             clearTree(root);
+        root = nullptr;
 
         if (treeSize != 0)
         {
@@ -186,6 +190,12 @@ public:
     // Takes in a request (In,Pre, or Post) and then prints the tree in that order.
     std::ostream &print(std::ostream &os, const std::string &type);
 
+    // Writes the tree to writer in pre-order (Refer to Serialization/BinaryStream.h).
+    void serialize(BinaryWriter &writer) const;
+    // Replaces the contents of the tree with one read from reader. The
+    // pre-order sequence is linked back into exactly the same shape in O(n).
+    void deserialize(BinaryReader &reader);
+
     // Default Constructor: creates an empty tree
     BinarySearchTree() : root(nullptr), treeSize(0) {}
 
@@ -640,18 +650,27 @@ typename BinarySearchTree<T>::Node *BinarySearchTree<T>::binarySearchBFS(Node *n
 template <typename T>
 void BinarySearchTree<T>::clearTree(Node *node)
 {
-    if (!node->left && !node->right)
-        return;
-
-    clearTree(node->left);
-    clearTree(node->right);
-
-    delete node;
-    node->left = nullptr;
-    node->right = nullptr;
-
-    treeSize--;
-    return;
+    // An explicit stack, since a degenerate tree is as deep as it is large.
+    std::vector<Node *> stack;
+    if (node)
+    {
+        stack.push_back(node);
+    }
+    while (!stack.empty())
+    {
+        Node *curr = stack.back();
+        stack.pop_back();
+        if (curr->left)
+        {
+            stack.push_back(curr->left);
+        }
+        if (curr->right)
+        {
+            stack.push_back(curr->right);
+        }
+        delete curr;
+        treeSize--;
+    }
 }
 
 template <typename T>
@@ -960,4 +979,83 @@ bool BinarySearchTree<T>::equals(const BinarySearchTree<T> &other) const
     }
 
     return queueOther.empty() && queueThis.empty();
-}
\ No newline at end of file
+}
+
+template <typename T>
+void BinarySearchTree<T>::serialize(BinaryWriter &writer) const
+{
+    writer.beginObject("BSTR", 1);
+    writer.writeSize(treeSize);
+    // Pre-order with an explicit stack, since a degenerate tree is as deep as it is large.
+    std::vector<const Node *> stack;
+    if (root)
+    {
+        stack.push_back(root);
+    }
+    while (!stack.empty())
+    {
+        const Node *node = stack.back();
+        stack.pop_back();
+        writer.write(node->data);
+        if (node->right)
+        {
+            stack.push_back(node->right);
+        }
+        if (node->left)
+        {
+            stack.push_back(node->left);
+        }
+    }
+}
+
+template <typename T>
+void BinarySearchTree<T>::deserialize(BinaryReader &reader)
+{
+    reader.beginObject("BSTR", 1);
+    size_t count = reader.readSize();
+    // Decode into a separate tree, so a truncated or corrupt stream leaves
+    // this one as it was.
+    BinarySearchTree<T> fresh;
+    // Rebuilds the pre-order sequence in O(n) instead of inserting each
+    // element from the root. The stack holds the path from the root to the
+    // last node whose right child is still open, and the newest node is
+    // always on top and childless. A value that is not greater than the top
+    // becomes its left child, as insert would place it. Otherwise it is the
+    // right child of the deepest node on the path it is greater than.
+    std::vector<Node *> stack;
+    // Everything after a right turn must be greater than the node turned at.
+    const Node *lowerBound = nullptr;
+    for (size_t i = 0; i < count; i++)
+    {
+        T value;
+        reader.read(value);
+        if (lowerBound && !(value > lowerBound->data))
+        {
+            throw std::runtime_error("Error: serialized BinarySearchTree is not in pre-order.");
+        }
+        Node *node = new Node(value);
+        if (!fresh.root)
+        {
+            fresh.root = node;
+        }
+        else if (!(value > stack.back()->data))
+        {
+            stack.back()->left = node;
+        }
+        else
+        {
+            Node *parent = nullptr;
+            while (!stack.empty() && value > stack.back()->data)
+            {
+                parent = stack.back();
+                stack.pop_back();
+            }
+            parent->right = node;
+            lowerBound = parent;
+        }
+        fresh.treeSize++;
+        stack.push_back(node);
+    }
+    std::swap(root, fresh.root);
+    std::swap(treeSize, fresh.treeSize);
+}
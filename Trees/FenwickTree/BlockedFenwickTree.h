@@ -0,0 +1,127 @@
+/**
+ * @file BlockedFenwickTree.h
+ * @author Kofi Boateng
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ *
+ */
+
+#pragma once
+#include <stdexcept> // for runtime_error
+#include <cstddef>   // for size_t
+#include <vector>    // raw values
+#include "FenwickTree.h"
+
+// This is a Fenwick Tree with wide leaves. The elements are kept as a plain array, split into blocks
+// of BlockSize, and an ordinary FenwickTree holds only the sum of each block. A prefix sum is the
+// FenwickTree prefix over the whole blocks before the index plus a straight sum over the start of the
+// index's own block.
+// That trade pays off for large arrays. The FenwickTree is BlockSize times smaller (about 12 MB of
+// block sums for 10^8 counters with the default 64), so its levels stay in cache. The leftover partial
+// block is one contiguous run of at most BlockSize - 1 elements, which the compiler vectorizes; it is
+// summed with eight independent accumulators so that floating point sums vectorize too. Reading a
+// single element is O(1), since the raw value is stored.
+
+template <typename T, size_t BlockSize = 64>
+class BlockedFenwickTree
+{
+    static_assert(BlockSize >= 8 && (BlockSize & (BlockSize - 1)) == 0, "BlockSize must be a power of two of at least 8");
+
+private:
+    std::vector<T> values_;
+
+    // Sum of each block of values_.
+    FenwickTree<T> blocks_;
+
+    // Returns values_[first] + ... + values_[last - 1].
+    T _sum(size_t first, size_t last) const
+    {
+        const T *data = values_.data();
+        T partial[8] = {T(), T(), T(), T(), T(), T(), T(), T()};
+        size_t i = first;
+        for (; i + 8 <= last; i += 8)
+        {
+            for (int lane = 0; lane < 8; lane++)
+            {
+                partial[lane] += data[i + lane];
+            }
+        }
+        T sum = ((partial[0] + partial[1]) + (partial[2] + partial[3])) + ((partial[4] + partial[5]) + (partial[6] + partial[7]));
+        for (; i < last; i++)
+        {
+            sum += data[i];
+        }
+        return sum;
+    }
+
+    static std::vector<T> _blockSums(const std::vector<T> &values)
+    {
+        std::vector<T> sums((values.size() + BlockSize - 1) / BlockSize, T());
+        for (size_t i = 0; i < values.size(); i++)
+        {
+            sums[i / BlockSize] += values[i];
+        }
+        return sums;
+    }
+
+public:
+    // Adds delta to element index.
+    void add(size_t index, const T &delta)
+    {
+        if (index >= values_.size())
+        {
+            throw std::runtime_error("Error: BlockedFenwickTree index is out of range.");
+        }
+        values_[index] += delta;
+        blocks_.add(index / BlockSize, delta);
+    }
+
+    // Returns the sum of the first count elements, [0, count).
+    T prefixSum(size_t count) const
+    {
+        if (count > values_.size())
+        {
+            throw std::runtime_error("Error: BlockedFenwickTree index is out of range.");
+        }
+        size_t block = count / BlockSize;
+        return blocks_.prefixSum(block) + _sum(block * BlockSize, count);
+    }
+
+    // Returns the sum of elements [first, last).
+    T rangeSum(size_t first, size_t last) const
+    {
+        if (first > last)
+        {
+            throw std::runtime_error("Error: BlockedFenwickTree range is reversed.");
+        }
+        // Short ranges inside one block are summed directly.
+        if (first / BlockSize == last / BlockSize && last <= values_.size())
+        {
+            return _sum(first, last);
+        }
+        return prefixSum(last) - prefixSum(first);
+    }
+
+    // Returns element index.
+    T get(size_t index) const
+    {
+        if (index >= values_.size())
+        {
+            throw std::runtime_error("Error: BlockedFenwickTree index is out of range.");
+        }
+        return values_[index];
+    }
+
+    // Sets element index to value.
+    void set(size_t index, const T &value) { add(index, value - get(index)); }
+
+    // Returns the number of elements.
+    size_t size() const { return values_.size(); }
+
+    // Creates a tree of n zeros.
+    explicit BlockedFenwickTree(size_t n) : values_(n, T()), blocks_((n + BlockSize - 1) / BlockSize) {}
+
+    // Creates a tree over a copy of values, in O(n).
+    explicit BlockedFenwickTree(const std::vector<T> &values) : values_(values), blocks_(_blockSums(values)) {}
+};
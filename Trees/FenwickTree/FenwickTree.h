@@ -0,0 +1,125 @@
+/**
+ * @file FenwickTree.h
+ * @author Kofi Boateng
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ *
+ */
+
+#pragma once
+#include <stdexcept> // for runtime_error
+#include <cstddef>   // for size_t
+#include <vector>    // backing array
+
+// This is an implementation of a Fenwick Tree, also called a Binary Indexed Tree. It stores n numbers
+// and answers prefix sums (a[0] + ... + a[i - 1]) and point updates in O(log n), using nothing but an
+// array of n sums. Slot i (1-based) holds the sum of the lowbit(i) elements that end at i, where
+// lowbit(i) = i & -i. A prefix sum adds up the slots found by repeatedly clearing the lowest set bit
+// of i, and an update walks the other way by repeatedly adding it. There are no pointers and no nodes,
+// just an implicit tree laid over the array.
+// The tree is built in O(n) from an initial array by pushing each slot's sum into its parent once.
+// For very large arrays, the upper levels of the implicit tree are spread across memory and miss the
+// cache on every query; BlockedFenwickTree.h fixes that with wide leaves.
+
+template <typename T>
+class FenwickTree
+{
+private:
+    // 1-based sums. tree_[0] is unused.
+    std::vector<T> tree_;
+
+    // Throws unless index <= limit.
+    void _checkIndex(size_t index, size_t limit) const
+    {
+        if (index > limit)
+        {
+            throw std::runtime_error("Error: FenwickTree index is out of range.");
+        }
+    }
+
+public:
+    // Adds delta to element index.
+    void add(size_t index, const T &delta)
+    {
+        _checkIndex(index + 1, size());
+        for (size_t i = index + 1; i < tree_.size(); i += i & (~i + 1))
+        {
+            tree_[i] += delta;
+        }
+    }
+
+    // Returns the sum of the first count elements, [0, count).
+    T prefixSum(size_t count) const
+    {
+        _checkIndex(count, size());
+        T sum = T();
+        for (size_t i = count; i > 0; i -= i & (~i + 1))
+        {
+            sum += tree_[i];
+        }
+        return sum;
+    }
+
+    // Returns the sum of elements [first, last).
+    T rangeSum(size_t first, size_t last) const
+    {
+        if (first > last)
+        {
+            throw std::runtime_error("Error: FenwickTree range is reversed.");
+        }
+        return prefixSum(last) - prefixSum(first);
+    }
+
+    // Returns element index.
+    T get(size_t index) const { return rangeSum(index, index + 1); }
+
+    // Sets element index to value.
+    void set(size_t index, const T &value) { add(index, value - get(index)); }
+
+    // Returns the smallest count such that prefixSum(count) >= target, or
+    // size() + 1 if there is none. Elements must be non-negative. Runs in
+    // O(log n) by walking down the implicit tree.
+    size_t lowerBound(T target) const
+    {
+        if (!(T() < target))
+        {
+            return 0;
+        }
+        size_t step = 1;
+        while (step * 2 < tree_.size())
+        {
+            step *= 2;
+        }
+        size_t position = 0;
+        for (; step > 0; step /= 2)
+        {
+            if (position + step < tree_.size() && tree_[position + step] < target)
+            {
+                position += step;
+                target -= tree_[position];
+            }
+        }
+        return position + 1;
+    }
+
+    // Returns the number of elements.
+    size_t size() const { return tree_.size() - 1; }
+
+    // Creates a tree of n zeros.
+    explicit FenwickTree(size_t n) : tree_(n + 1, T()) {}
+
+    // Creates a tree over a copy of values, in O(n).
+    explicit FenwickTree(const std::vector<T> &values) : tree_(values.size() + 1, T())
+    {
+        for (size_t i = 1; i < tree_.size(); i++)
+        {
+            tree_[i] += values[i - 1];
+            size_t parent = i + (i & (~i + 1));
+            if (parent < tree_.size())
+            {
+                tree_[parent] += tree_[i];
+            }
+        }
+    }
+};
@@ -0,0 +1,160 @@
+/**
+ * @file IntervalTree.h
+ * @author Kofi Boateng
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ *
+ */
+
+#pragma once
+#include <stdexcept> // for runtime_error
+#include "../AVLTree/AVLTree.h"
+
+// This is an implementation of an Interval Tree built on top of AVLBinaryTree. Each node holds a closed
+// interval [low, high] with a value, ordered by low (then high), and is augmented with the largest high
+// endpoint anywhere in its subtree (maxHigh). The augmentation is maintained by AVLBinaryTree itself:
+// leftRotation and rightRotation refresh it for the two nodes they move, and insertions refresh it on
+// the way back up, so keeping it correct costs O(1) per touched node and no extra passes.
+// overlapping(lo, hi, callback) uses maxHigh to prune. A subtree whose maxHigh is below lo cannot
+// contain an overlapping interval and is skipped, and once a node starts after hi, nothing to its right
+// can overlap either. Only the paths to the matching intervals are walked: the search is O(log n) when
+// nothing matches, and O(k log n) in the worst case for k matches, usually much closer to O(log n + k).
+// Duplicate intervals are allowed. remove() deletes one matching interval and rebalances on the way up,
+// updating the heights and augmentation of the same nodes.
+
+// A closed interval [low, high] carrying a value. Intervals are ordered by
+// low, then by high; the value does not take part in comparisons.
+template <typename K, typename V>
+struct Interval
+{
+    K low;
+    K high;
+    V value;
+
+    bool operator<(const Interval &other) const { return low < other.low || (!(other.low < low) && high < other.high); }
+    bool operator>(const Interval &other) const { return other < *this; }
+    bool operator==(const Interval &other) const { return !(*this < other) && !(other < *this); }
+    bool operator!=(const Interval &other) const { return !(*this == other); }
+};
+
+// Augmentation policy storing the largest high endpoint in a subtree.
+template <typename K>
+struct MaxEndpointAugmentation
+{
+    typedef K Value;
+
+    template <typename Node>
+    static void update(Node *node)
+    {
+        K maxHigh = node->data.high;
+        if (node->left && maxHigh < node->left->augment)
+        {
+            maxHigh = node->left->augment;
+        }
+        if (node->right && maxHigh < node->right->augment)
+        {
+            maxHigh = node->right->augment;
+        }
+        node->augment = maxHigh;
+    }
+};
+
+template <typename K, typename V>
+class IntervalTree : private AVLBinaryTree<Interval<K, V>, MaxEndpointAugmentation<K>>
+{
+private:
+    typedef AVLBinaryTree<Interval<K, V>, MaxEndpointAugmentation<K>> Base;
+    typedef typename Base::Node Node;
+
+    // Calls callback on every interval under node that overlaps [lo, hi].
+    template <typename Callback>
+    void _overlapping(const Node *node, const K &lo, const K &hi, Callback &callback) const;
+
+public:
+    // Inserts the interval [low, high] with value. Throws if low > high.
+    void insert(const K &low, const K &high, const V &value = V())
+    {
+        if (high < low)
+        {
+            throw std::runtime_error("Error: An interval cannot end before it starts.");
+        }
+        Interval<K, V> interval{low, high, value};
+        if (!this->root)
+        {
+            this->root = new Node(interval);
+            MaxEndpointAugmentation<K>::update(this->root);
+            this->treeSize++;
+            return;
+        }
+        this->root = this->DFSInsertHelper(interval, this->root);
+    }
+
+    // Removes one interval with these endpoints. Returns false if there was none.
+    bool remove(const K &low, const K &high)
+    {
+        bool removed = false;
+        this->root = this->removeNode(this->root, Interval<K, V>{low, high, V()}, removed);
+        return removed;
+    }
+
+    // Calls callback(const Interval<K, V> &) on every interval that overlaps
+    // [lo, hi], in order of low endpoint.
+    template <typename Callback>
+    void overlapping(const K &lo, const K &hi, Callback callback) const
+    {
+        _overlapping(this->root, lo, hi, callback);
+    }
+
+    // Calls callback on every interval that contains point.
+    template <typename Callback>
+    void containing(const K &point, Callback callback) const
+    {
+        _overlapping(this->root, point, point, callback);
+    }
+
+    // Returns the largest high endpoint in the tree. Throws if it is empty.
+    const K &maxEndpoint() const
+    {
+        if (!this->root)
+        {
+            throw std::runtime_error("Error: maxEndpoint() called on an empty IntervalTree.");
+        }
+        return this->root->augment;
+    }
+
+    using Base::isBalanced;
+    using Base::isEmpty;
+    using Base::size;
+
+    IntervalTree() : Base() {}
+
+    IntervalTree(const IntervalTree &) = delete;
+    IntervalTree &operator=(const IntervalTree &) = delete;
+};
+
+// ===================================================================================
+// Implementation Section
+// ===================================================================================
+
+template <typename K, typename V>
+template <typename Callback>
+void IntervalTree<K, V>::_overlapping(const Node *node, const K &lo, const K &hi, Callback &callback) const
+{
+    // Nothing under this node reaches lo.
+    if (!node || node->augment < lo)
+    {
+        return;
+    }
+    _overlapping(node->left, lo, hi, callback);
+    // This node and everything to its right start after hi.
+    if (hi < node->data.low)
+    {
+        return;
+    }
+    if (!(node->data.high < lo))
+    {
+        callback(node->data);
+    }
+    _overlapping(node->right, lo, hi, callback);
+}
@@ -0,0 +1,288 @@
+/**
+ * @file KDTree.h
+ * @author Kofi Boateng
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ *
+ */
+
+#pragma once
+#include <stdexcept>  // for runtime_error
+#include <cstdint>    // for fixed width integers
+#include <vector>     // flat point array and results
+#include <array>      // for points
+#include <algorithm>  // for nth_element and reverse
+#include <functional> // for std::greater
+#include <memory>     // for allocator_traits
+#include "../../Heap/PriorityQueue.h"
+#include "../../Concurrency/ParallelRanges.h"
+
+// This is an implementation of a k-d tree, a binary space partitioning tree for Dims-dimensional points
+// that answers nearest neighbour and radius queries in about O(log n) instead of scanning every point.
+// Each level splits the points by one coordinate, cycling through the dimensions, at the median.
+// The tree is implicit and flat: the points live in one array, reordered so that every subrange
+// [lo, hi) stores its splitting point at the middle, with smaller coordinates before it and larger ones
+// after. There are no node objects or pointers at all, and the build is O(n log n) using nth_element
+// for the median at each level. Subranges of leafSize points or fewer are scanned directly.
+// The top levels of the build split into independent halves, so with several threads the two halves
+// of each split are built as parallel tasks on the shared ThreadPool.
+// kNearest keeps the k best candidates found so far in a PriorityQueueADT max heap (ordered with
+// std::greater), so the current worst candidate is always at the top and is the one evicted by a
+// closer point. A subtree is only entered if the splitting plane is closer than that worst candidate.
+// Distances are squared Euclidean distances, and points keep the index they had in the input.
+// The point array comes from Allocator, so a tree over hundreds of millions of points can keep it in the
+// huge pages of a HugePageArena by passing an ArenaAllocator (Refer to Memory/ArenaAllocator.h).
+
+template <typename T = float, int Dims = 2, typename Allocator = std::allocator<T>>
+class KDTree
+{
+    static_assert(Dims >= 1, "A KDTree needs at least one dimension");
+
+public:
+    typedef std::array<T, Dims> Point;
+
+    // A query result: the point's index in the input and its squared distance.
+    struct Neighbor
+    {
+        uint32_t index;
+        T distanceSquared;
+
+        bool operator<(const Neighbor &other) const { return distanceSquared < other.distanceSquared; }
+        bool operator>(const Neighbor &other) const { return other < *this; }
+    };
+
+private:
+    // A point and its index in the input, in tree order.
+    struct Entry
+    {
+        Point point;
+        uint32_t index;
+    };
+
+    // Subranges this small are scanned instead of split further.
+    static const size_t leafSize = 8;
+
+    std::vector<Entry, typename std::allocator_traits<Allocator>::template rebind_alloc<Entry>> entries_;
+
+    static T _distanceSquared(const Point &a, const Point &b)
+    {
+        T sum = T();
+        for (int d = 0; d < Dims; d++)
+        {
+            T diff = a[d] - b[d];
+            sum += diff * diff;
+        }
+        return sum;
+    }
+
+    // Arranges entries_[lo, hi) into a subtree split on depth % Dims.
+    void _build(size_t lo, size_t hi, int depth, int threads);
+
+    typedef PriorityQueueADT<Neighbor, std::greater<Neighbor>> MaxHeap;
+
+    // Offers a candidate to the k-best heap.
+    static void _offer(MaxHeap &best, size_t k, const Neighbor &candidate)
+    {
+        if ((size_t)best.size() < k)
+        {
+            best.insert(candidate);
+        }
+        else if (candidate.distanceSquared < best.peek().distanceSquared)
+        {
+            best.removeMin();
+            best.insert(candidate);
+        }
+    }
+
+    void _nearest(size_t lo, size_t hi, int depth, const Point &query, size_t k, MaxHeap &best) const;
+
+    void _radius(size_t lo, size_t hi, int depth, const Point &query, T radiusSquared, std::vector<Neighbor> &out) const;
+
+public:
+    // Returns the k points closest to query, closest first. Returns fewer
+    // if the tree holds fewer than k points.
+    std::vector<Neighbor> kNearest(const Point &query, size_t k) const
+    {
+        std::vector<Neighbor> result;
+        if (k == 0 || entries_.empty())
+        {
+            return result;
+        }
+        MaxHeap best;
+        _nearest(0, entries_.size(), 0, query, k, best);
+        while (!best.isEmpty())
+        {
+            result.push_back(best.peek());
+            best.removeMin();
+        }
+        std::reverse(result.begin(), result.end());
+        return result;
+    }
+
+    // Returns the point closest to query. Throws if the tree is empty.
+    Neighbor nearest(const Point &query) const
+    {
+        if (entries_.empty())
+        {
+            throw std::runtime_error("Error: nearest() called on an empty KDTree.");
+        }
+        return kNearest(query, 1)[0];
+    }
+
+    // Returns every point within radius of query, in no particular order.
+    std::vector<Neighbor> withinRadius(const Point &query, T radius) const
+    {
+        std::vector<Neighbor> result;
+        _radius(0, entries_.size(), 0, query, radius * radius, result);
+        return result;
+    }
+
+    // Answers kNearest for every query, split across threads.
+    std::vector<std::vector<Neighbor>> kNearestBatch(const std::vector<Point> &queries, size_t k,
+                                                     int threads = defaultThreadCount()) const
+    {
+        std::vector<std::vector<Neighbor>> results(queries.size());
+        parallelRanges(queries.size(), threads, [&](size_t begin, size_t end, int)
+                       {
+            for (size_t i = begin; i < end; i++)
+            {
+                results[i] = kNearest(queries[i], k);
+            } });
+        return results;
+    }
+
+    // Returns the number of points.
+    size_t size() const { return entries_.size(); }
+
+    // Returns a boolean signifying if the tree is empty or not.
+    bool isEmpty() const { return entries_.empty(); }
+
+    // Builds a tree over a copy of points, using up to threads threads.
+    explicit KDTree(const std::vector<Point> &points, int threads = 1, const Allocator &allocator = Allocator())
+        : entries_(allocator)
+    {
+        if (points.size() > UINT32_MAX)
+        {
+            throw std::runtime_error("Error: KDTree supports at most 2^32 - 1 points.");
+        }
+        entries_.resize(points.size());
+        for (size_t i = 0; i < points.size(); i++)
+        {
+            entries_[i] = Entry{points[i], (uint32_t)i};
+        }
+        _build(0, entries_.size(), 0, threads);
+    }
+};
+
+// ===================================================================================
+// Implementation Section
+// ===================================================================================
+
+template <typename T, int Dims, typename Allocator>
+void KDTree<T, Dims, Allocator>::_build(size_t lo, size_t hi, int depth, int threads)
+{
+    if (hi - lo <= leafSize)
+    {
+        return;
+    }
+    int dimension = depth % Dims;
+    size_t mid = lo + (hi - lo) / 2;
+    std::nth_element(entries_.begin() + lo, entries_.begin() + mid, entries_.begin() + hi,
+                     [dimension](const Entry &a, const Entry &b)
+                     { return a.point[dimension] < b.point[dimension]; });
+
+    // Build the halves in parallel while threads remain.
+    if (threads > 1)
+    {
+        ThreadPool::global().parallelInvoke([this, lo, mid, depth, threads]()
+                                            { _build(lo, mid, depth + 1, threads / 2); },
+                                            [this, mid, hi, depth, threads]()
+                                            { _build(mid + 1, hi, depth + 1, threads - threads / 2); });
+    }
+    else
+    {
+        _build(lo, mid, depth + 1, 1);
+        _build(mid + 1, hi, depth + 1, 1);
+    }
+}
+
+template <typename T, int Dims, typename Allocator>
+void KDTree<T, Dims, Allocator>::_nearest(size_t lo, size_t hi, int depth, const Point &query, size_t k, MaxHeap &best) const
+{
+    if (hi - lo <= leafSize)
+    {
+        for (size_t i = lo; i < hi; i++)
+        {
+            _offer(best, k, Neighbor{entries_[i].index, _distanceSquared(query, entries_[i].point)});
+        }
+        return;
+    }
+
+    int dimension = depth % Dims;
+    size_t mid = lo + (hi - lo) / 2;
+    const Entry &split = entries_[mid];
+    _offer(best, k, Neighbor{split.index, _distanceSquared(query, split.point)});
+
+    // Search the side of the plane that holds the query first; the other side
+    // only matters if the plane is closer than the current k-th best.
+    T diff = query[dimension] - split.point[dimension];
+    bool leftFirst = diff < T();
+    if (leftFirst)
+    {
+        _nearest(lo, mid, depth + 1, query, k, best);
+    }
+    else
+    {
+        _nearest(mid + 1, hi, depth + 1, query, k, best);
+    }
+    if ((size_t)best.size() < k || diff * diff < best.peek().distanceSquared)
+    {
+        if (leftFirst)
+        {
+            _nearest(mid + 1, hi, depth + 1, query, k, best);
+        }
+        else
+        {
+            _nearest(lo, mid, depth + 1, query, k, best);
+        }
+    }
+}
+
+template <typename T, int Dims, typename Allocator>
+void KDTree<T, Dims, Allocator>::_radius(size_t lo, size_t hi, int depth, const Point &query, T radiusSquared,
+                              std::vector<Neighbor> &out) const
+{
+    if (hi - lo <= leafSize)
+    {
+        for (size_t i = lo; i < hi; i++)
+        {
+            T distance = _distanceSquared(query, entries_[i].point);
+            if (!(radiusSquared < distance))
+            {
+                out.push_back(Neighbor{entries_[i].index, distance});
+            }
+        }
+        return;
+    }
+
+    int dimension = depth % Dims;
+    size_t mid = lo + (hi - lo) / 2;
+    const Entry &split = entries_[mid];
+    T distance = _distanceSquared(query, split.point);
+    if (!(radiusSquared < distance))
+    {
+        out.push_back(Neighbor{split.index, distance});
+    }
+
+    T diff = query[dimension] - split.point[dimension];
+    // The left side holds coordinates <= the split, the right side >= it.
+    if (diff < T() || diff * diff <= radiusSquared)
+    {
+        _radius(lo, mid, depth + 1, query, radiusSquared, out);
+    }
+    if (!(diff < T()) || diff * diff <= radiusSquared)
+    {
+        _radius(mid + 1, hi, depth + 1, query, radiusSquared, out);
+    }
+}
@@ -15,6 +15,8 @@
 #include <vector>    // used to hold pointers to new nodes.
 #include <queue>     // used for BFS algorithms.
 #include <stack>     // used for clearing the tree.
+#include <utility>   // for pair & swap
+#include "../../Serialization/BinaryStream.h"
 
 // This is the implementation of a M-ary tree. An M-ary tree is tree graph that has at least two child nodes
 // and up to M child nodes, where M is the number of children each node can have. For example, A binary tree
@@ -139,12 +141,10 @@ public:
     {
         if (root)
             clearTree(root);
+        root = nullptr;
 
-        std::cout << "CURRENT SIZE: " << size_ << std::endl;
-        print(std::cout, "pre");
         if (size_ != 0)
         {
-            std::cout << "FOUND IT" << std::endl;
             throw new std::runtime_error("Error in clear: elements still exist on the heap... please check");
         }
     }
@@ -159,6 +159,12 @@ public:
     // Takes in a request (In,Pre, or Post) and then prints the tree in that order.
     std::ostream &print(std::ostream &os, const std::string &type);
 
+    // Writes the tree to writer in pre-order, with each node's number of
+    // children, so the exact shape comes back (Refer to Serialization/BinaryStream.h).
+    void serialize(BinaryWriter &writer) const;
+    // Replaces the contents and order of the tree with one read from reader.
+    void deserialize(BinaryReader &reader);
+
     // Default constructor. The default order will always be two.
     Tree() : root(nullptr), size_(0), order_(2) {}
 
@@ -302,9 +308,11 @@ bool Tree<T>::insertionHelperDFS(const T &element, TreeNode *node)
 
     for (int i{}; i < node->values_.size(); i++)
     {
+        // Stop at the first subtree that took the element, or the next
+        // sibling would get a second copy.
         if (insertionHelperDFS(element, node->values_[i]))
         {
-            break;
+            return true;
         }
     }
     return false;
@@ -396,7 +404,9 @@ void Tree<T>::clearTree(TreeNode *node)
 
         // We can safely call delete on all nodes because we are going
         // bottom up on deletes, therefore all previous nodes will
-        // already be deleted.
+        // already be deleted. The children are forgotten first so the
+        // node's destructor does not delete them a second time.
+        nodeToDelete->values_.clear();
         delete nodeToDelete;
         size_--;
     }
@@ -528,4 +538,83 @@ std::ostream &Tree<T>::print(std::ostream &os, const std::string &type)
     os << "]\n";
 
     return os;
-}
\ No newline at end of file
+}
+
+template <typename T>
+void Tree<T>::serialize(BinaryWriter &writer) const
+{
+    writer.beginObject("MTRE", 1);
+    writer.write((int32_t)order_);
+    writer.writeSize(root ? (size_t)size_ : 0);
+    std::stack<const TreeNode *> stack;
+    if (root)
+    {
+        stack.push(root);
+    }
+    while (!stack.empty())
+    {
+        const TreeNode *node = stack.top();
+        stack.pop();
+        writer.write(node->data_);
+        writer.writeSize(node->values_.size());
+        // Pushed in reverse so the first child is written first.
+        for (size_t i = node->values_.size(); i > 0; i--)
+        {
+            stack.push(node->values_[i - 1]);
+        }
+    }
+}
+
+template <typename T>
+void Tree<T>::deserialize(BinaryReader &reader)
+{
+    reader.beginObject("MTRE", 1);
+    int32_t order = reader.read<int32_t>();
+    size_t count = reader.readSize();
+    if (order < 1)
+    {
+        throw std::runtime_error("Error: serialized Tree has an invalid order.");
+    }
+    // Decode into a separate tree, so a truncated or corrupt stream leaves
+    // this one as it was. Nodes are linked in and counted before their data
+    // is read, so the separate tree frees whatever was built on a read error.
+    // The size is the number of nodes read, whatever the header says.
+    Tree<T> fresh(order);
+    auto readChildren = [&reader, order]()
+    {
+        size_t children = reader.readSize();
+        if (children > (size_t)order)
+        {
+            throw std::runtime_error("Error: serialized Tree has a node with more children than its order.");
+        }
+        return children;
+    };
+    if (count != 0)
+    {
+        fresh.root = new TreeNode(fresh.order_);
+        fresh.size_ = 1;
+        reader.read(fresh.root->data_);
+        // Each entry is a node and how many of its children are still to
+        // be read, so a deep tree does not recurse.
+        std::stack<std::pair<TreeNode *, size_t>> pending;
+        pending.push(std::make_pair(fresh.root, readChildren()));
+        while (!pending.empty())
+        {
+            std::pair<TreeNode *, size_t> &top = pending.top();
+            if (top.second == 0)
+            {
+                pending.pop();
+                continue;
+            }
+            top.second--;
+            TreeNode *child = new TreeNode(fresh.order_);
+            top.first->values_.push_back(child);
+            fresh.size_++;
+            reader.read(child->data_);
+            pending.push(std::make_pair(child, readChildren()));
+        }
+    }
+    std::swap(root, fresh.root);
+    std::swap(size_, fresh.size_);
+    std::swap(order_, fresh.order_);
+}
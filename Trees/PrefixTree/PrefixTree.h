@@ -14,6 +14,9 @@
 #include <map>       // used to map characters to nodes
 #include <vector>    // used to return multiple words built from prefixes
 #include <queue>
+#include <algorithm> // for sort
+#include <utility>   // for pair
+#include "../../Serialization/BinaryStream.h"
 
 // This is an implementation of a Prefix Tree, or Trie Tree. A Prefix tree
 // is a type of tree that is used to store alphabetical words into nodes.
@@ -61,7 +64,10 @@ private:
 
     // ClearTree is used to recursively remove elements from the
     // the tree during deallocation.
-    void clearTree(Node *node);
+    static void clearTree(Node *node);
+
+    // Returns a copy of node and its subtree, leaving out null children.
+    static Node *copyTree(const Node *node);
 
     // A DFS function that will find a word in the tree "delete" each of its node representations.
     void wordRemoverDFS(Node *node, const int &index, const std::string &word);
@@ -78,6 +84,14 @@ private:
     // A DFS helper function that will return whether the word is in the tree or not.
     bool wordSearchHelper(const int &index, Node *node, const std::string &word) const;
 
+    // Writes node and its subtree: the end-of-word flag, the number of
+    // children, then each child's character and subtree.
+    static void serializeNode(const Node *node, BinaryWriter &writer);
+
+    // Reads a subtree written by serializeNode into node and returns how
+    // many words it holds.
+    static int64_t deserializeNode(Node *node, BinaryReader &reader);
+
 public:
     // Returns size of the tree;
     int size() const { return wordCount_; }
@@ -88,6 +102,11 @@ public:
     // Inserts a word into the tree.
     void insert(const std::string &word);
 
+    // Inserts every word of a batch. The batch is sorted first, so each word
+    // continues from where its path leaves the previous word's path instead
+    // of walking down from the root.
+    void insertBatch(std::vector<std::string> words);
+
     // Searches for the existence of a word in the tree.
     // This function will also account for wildcards as well.
     // Wildcards will only match any character per wildcard.
@@ -113,20 +132,33 @@ public:
     // no words present.
     void wordBuilder(std::string &prefix, std::vector<std::string> &wordCollection);
 
+    // Writes the tree to writer (Refer to Serialization/BinaryStream.h).
+    void serialize(BinaryWriter &writer) const;
+    // Replaces the contents of the tree with one read from reader.
+    void deserialize(BinaryReader &reader);
+
     PrefixTree() : root(new Node()), wordCount_(0) {}
 
-    PrefixTree(const PrefixTree &other) : PrefixTree()
-    {
-        *this = other;
-    }
+    // The copy constructor copies every node, so that both trees can be
+    // destroyed independently.
+    PrefixTree(const PrefixTree &other) : root(copyTree(other.root)), wordCount_(other.wordCount_) {}
 
+    // The copy assignment operator replaces this tree with a copy of the other one.
     PrefixTree &operator=(const PrefixTree &other)
     {
-        root = other.root;
+        if (this == &other)
+        {
+            return *this;
+        }
+        Node *copy = copyTree(other.root);
+        clearTree(root);
+        root = copy;
         wordCount_ = other.wordCount_;
 
         return *this;
     }
+
+    ~PrefixTree() { clearTree(root); }
 };
 
 // ===============================================================================================================================
@@ -137,7 +169,7 @@ public:
 // Helper Functions
 // ===========================================================================================================
 
-void PrefixTree::wordRemoverDFS(Node *node, const int &index, const std::string &word)
+inline void PrefixTree::wordRemoverDFS(Node *node, const int &index, const std::string &word)
 {
     // Instead of deallocating the word from the tree, we will change the flag to false,
     // signifying the word no longer "exists in the tree".
@@ -159,7 +191,7 @@ void PrefixTree::wordRemoverDFS(Node *node, const int &index, const std::string
     wordRemoverDFS(node->children[word[index]], index + 1, word);
 }
 
-bool PrefixTree::wordSearchHelper(const int &index, Node *node, const std::string &word) const
+inline bool PrefixTree::wordSearchHelper(const int &index, Node *node, const std::string &word) const
 {
     Node *currNode = node;
 
@@ -196,7 +228,7 @@ bool PrefixTree::wordSearchHelper(const int &index, Node *node, const std::strin
     return currNode->endOfWord;
 }
 
-void PrefixTree::wordBuilderHelperDFS(Node *node, std::string &word, std::vector<std::string> &wordCollection)
+inline void PrefixTree::wordBuilderHelperDFS(Node *node, std::string &word, std::vector<std::string> &wordCollection)
 {
     // Check to see if we can add the word
     // This is essentially our first base case, however
@@ -231,7 +263,7 @@ void PrefixTree::wordBuilderHelperDFS(Node *node, std::string &word, std::vector
 // Public Methods
 // ============================================================================================================
 
-void PrefixTree::insert(const std::string &word)
+inline void PrefixTree::insert(const std::string &word)
 {
     Node *currNode = root;
     for (char const &ch : word)
@@ -247,13 +279,54 @@ void PrefixTree::insert(const std::string &word)
             currNode = newNode;
         }
     }
-    currNode->endOfWord = true;
-    wordCount_++;
+    // Inserting a word twice does not count it twice.
+    if (!currNode->endOfWord)
+    {
+        currNode->endOfWord = true;
+        wordCount_++;
+    }
+}
+
+inline void PrefixTree::insertBatch(std::vector<std::string> words)
+{
+    std::sort(words.begin(), words.end());
+    // path[i] is the node reached after the first i characters of the previous word.
+    std::vector<Node *> path(1, root);
+    const std::string *previous = nullptr;
+    for (const std::string &word : words)
+    {
+        size_t common = 0;
+        if (previous)
+        {
+            while (common < previous->size() && common < word.size() && (*previous)[common] == word[common])
+            {
+                common++;
+            }
+        }
+        path.resize(common + 1);
+        Node *currNode = path.back();
+        for (size_t i = common; i < word.size(); i++)
+        {
+            Node *&child = currNode->children[word[i]];
+            if (!child)
+            {
+                child = new Node();
+            }
+            currNode = child;
+            path.push_back(currNode);
+        }
+        if (!currNode->endOfWord)
+        {
+            currNode->endOfWord = true;
+            wordCount_++;
+        }
+        previous = &word;
+    }
 }
 
-bool PrefixTree::search(const std::string &word) const { return wordSearchHelper(0, root, word); }
+inline bool PrefixTree::search(const std::string &word) const { return wordSearchHelper(0, root, word); }
 
-void PrefixTree::remove(const std::string &word)
+inline void PrefixTree::remove(const std::string &word)
 {
     if (!root)
     {
@@ -263,7 +336,7 @@ void PrefixTree::remove(const std::string &word)
     wordCount_--;
 }
 
-void PrefixTree::wordBuilder(std::string &prefix, std::vector<std::string> &wordCollection)
+inline void PrefixTree::wordBuilder(std::string &prefix, std::vector<std::string> &wordCollection)
 {
 
     Node *currNode = root;
@@ -304,7 +377,7 @@ void PrefixTree::wordBuilder(std::string &prefix, std::vector<std::string> &word
     }
 }
 
-bool PrefixTree::equals(const PrefixTree &other) const
+inline bool PrefixTree::equals(const PrefixTree &other) const
 {
     if (!root || size() != other.size())
     {
@@ -367,4 +440,158 @@ bool PrefixTree::equals(const PrefixTree &other) const
     }
 
     return queueOther.empty() && queueThis.empty();
-}
\ No newline at end of file
+}
+
+inline void PrefixTree::clearTree(Node *node)
+{
+    // A word is a path as deep as it is long, so the nodes are freed with an
+    // explicit stack rather than by recursion.
+    std::vector<Node *> stack;
+    if (node)
+    {
+        stack.push_back(node);
+    }
+    while (!stack.empty())
+    {
+        Node *current = stack.back();
+        stack.pop_back();
+        for (auto &entry : current->children)
+        {
+            if (entry.second)
+            {
+                stack.push_back(entry.second);
+            }
+        }
+        delete current;
+    }
+}
+
+inline PrefixTree::Node *PrefixTree::copyTree(const Node *node)
+{
+    Node *copy = new Node();
+    copy->endOfWord = node->endOfWord;
+    // Pairs of a source node and its copy whose children are still to be copied.
+    std::vector<std::pair<const Node *, Node *>> stack(1, std::make_pair(node, copy));
+    try
+    {
+        while (!stack.empty())
+        {
+            std::pair<const Node *, Node *> current = stack.back();
+            stack.pop_back();
+            for (const auto &entry : current.first->children)
+            {
+                if (entry.second)
+                {
+                    Node *&child = current.second->children[entry.first];
+                    child = new Node();
+                    child->endOfWord = entry.second->endOfWord;
+                    stack.push_back(std::make_pair(entry.second, child));
+                }
+            }
+        }
+    }
+    catch (...)
+    {
+        clearTree(copy);
+        throw;
+    }
+    return copy;
+}
+
+inline void PrefixTree::serializeNode(const Node *node, BinaryWriter &writer)
+{
+    // Pre-order with an explicit stack, since a long word makes the tree as
+    // deep as the word. Each entry is a child and the character leading to it.
+    std::vector<std::pair<char, const Node *>> stack;
+    const Node *curr = node;
+    while (true)
+    {
+        // Lookups can leave null children behind; they are not part of the tree.
+        size_t children = 0;
+        for (const auto &entry : curr->children)
+        {
+            children += entry.second ? 1 : 0;
+        }
+        writer.write(curr->endOfWord);
+        writer.writeSize(children);
+        // Pushed in reverse so the children are written in character order.
+        for (auto it = curr->children.rbegin(); it != curr->children.rend(); ++it)
+        {
+            if (it->second)
+            {
+                stack.push_back(std::make_pair(it->first, it->second));
+            }
+        }
+        if (stack.empty())
+        {
+            break;
+        }
+        writer.write(stack.back().first);
+        curr = stack.back().second;
+        stack.pop_back();
+    }
+}
+
+inline int64_t PrefixTree::deserializeNode(Node *node, BinaryReader &reader)
+{
+    int64_t words = 0;
+    // Each entry is a node and how many of its children are still to be read.
+    std::vector<std::pair<Node *, size_t>> pending;
+    reader.read(node->endOfWord);
+    words += node->endOfWord ? 1 : 0;
+    pending.push_back(std::make_pair(node, reader.readSize()));
+    while (!pending.empty())
+    {
+        if (pending.back().second == 0)
+        {
+            pending.pop_back();
+            continue;
+        }
+        pending.back().second--;
+        char ch = reader.read<char>();
+        Node *&child = pending.back().first->children[ch];
+        if (!child)
+        {
+            child = new Node();
+        }
+        bool endOfWord = reader.read<bool>();
+        // A repeated character reaches the same node, which counts once.
+        if (endOfWord && !child->endOfWord)
+        {
+            child->endOfWord = true;
+            words++;
+        }
+        pending.push_back(std::make_pair(child, reader.readSize()));
+    }
+    return words;
+}
+
+inline void PrefixTree::serialize(BinaryWriter &writer) const
+{
+    writer.beginObject("TRIE", 1);
+    writer.write((int64_t)wordCount_);
+    serializeNode(root, writer);
+}
+
+inline void PrefixTree::deserialize(BinaryReader &reader)
+{
+    reader.beginObject("TRIE", 1);
+    // The stored count is not trusted; the words are counted as they are read.
+    reader.read<int64_t>();
+    // Decode into a separate tree, so a truncated or corrupt stream leaves
+    // this one as it was.
+    Node *fresh = new Node();
+    int64_t words;
+    try
+    {
+        words = deserializeNode(fresh, reader);
+    }
+    catch (...)
+    {
+        clearTree(fresh);
+        throw;
+    }
+    clearTree(root);
+    root = fresh;
+    wordCount_ = (int)words;
+}
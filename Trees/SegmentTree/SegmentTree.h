@@ -0,0 +1,388 @@
+/**
+ * @file SegmentTree.h
+ * @author Kofi Boateng
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ *
+ */
+
+#pragma once
+#include <stdexcept> // for runtime_error
+#include <cstddef>   // for size_t
+#include <vector>    // values, tree and lazy arrays
+#include <limits>    // for the min and max identities
+
+// This is an implementation of a Segment Tree with lazy propagation. It answers range aggregate queries
+// (sum, min or max over [first, last)) and applies range updates (add a value to every element of
+// [first, last)) in O(log n) each.
+// The tree is stored as a flat array with the root at 1 and the children of node p at 2p and 2p + 1, and
+// every operation is iterative and bottom-up: it starts at the leaves of the range and climbs, touching
+// only O(log n) nodes and never recursing. A range add tags the O(log n) nodes that exactly cover the
+// range with a pending ("lazy") addend instead of visiting every element under them. Before a query
+// reads a node, the pending addends of its ancestors are pushed down to it, top to bottom.
+// The leaves are LeafWidth elements wide. With LeafWidth = 1 this is the textbook tree with 2n nodes.
+// With wider leaves the tree only covers n / LeafWidth blocks, so it is LeafWidth times smaller and stays
+// in cache, and the parts of a range that fall inside a leaf are handled by a straight loop over the
+// raw elements, which the compiler vectorizes (Aggregate::reduce uses eight independent accumulators
+// for that reason). For 10^8 counters, a LeafWidth of 32 or 64 keeps the tree itself at a few megabytes.
+// The aggregate is a policy class. SumAggregate, MinAggregate and MaxAggregate are provided; any type
+// with the same four static members works, provided that adding v to each of k elements changes the
+// aggregate in a way apply() can compute from the old aggregate alone.
+
+// Aggregate policy for range sums.
+template <typename T>
+struct SumAggregate
+{
+    static T identity() { return T(); }
+    static T combine(const T &a, const T &b) { return a + b; }
+    // The aggregate of count elements after adding addend to each.
+    static T apply(const T &aggregate, const T &addend, size_t count) { return aggregate + addend * (T)count; }
+    static T reduce(const T *values, size_t count)
+    {
+        T partial[8] = {T(), T(), T(), T(), T(), T(), T(), T()};
+        size_t i = 0;
+        for (; i + 8 <= count; i += 8)
+        {
+            for (int lane = 0; lane < 8; lane++)
+            {
+                partial[lane] += values[i + lane];
+            }
+        }
+        T sum = ((partial[0] + partial[1]) + (partial[2] + partial[3])) + ((partial[4] + partial[5]) + (partial[6] + partial[7]));
+        for (; i < count; i++)
+        {
+            sum += values[i];
+        }
+        return sum;
+    }
+};
+
+// Aggregate policy for range minimums.
+template <typename T>
+struct MinAggregate
+{
+    static T identity() { return std::numeric_limits<T>::max(); }
+    static T combine(const T &a, const T &b) { return b < a ? b : a; }
+    static T apply(const T &aggregate, const T &addend, size_t) { return aggregate + addend; }
+    static T reduce(const T *values, size_t count)
+    {
+        T partial[8] = {identity(), identity(), identity(), identity(), identity(), identity(), identity(), identity()};
+        size_t i = 0;
+        for (; i + 8 <= count; i += 8)
+        {
+            for (int lane = 0; lane < 8; lane++)
+            {
+                partial[lane] = combine(partial[lane], values[i + lane]);
+            }
+        }
+        T result = identity();
+        for (int lane = 0; lane < 8; lane++)
+        {
+            result = combine(result, partial[lane]);
+        }
+        for (; i < count; i++)
+        {
+            result = combine(result, values[i]);
+        }
+        return result;
+    }
+};
+
+// Aggregate policy for range maximums.
+template <typename T>
+struct MaxAggregate
+{
+    static T identity() { return std::numeric_limits<T>::lowest(); }
+    static T combine(const T &a, const T &b) { return a < b ? b : a; }
+    static T apply(const T &aggregate, const T &addend, size_t) { return aggregate + addend; }
+    static T reduce(const T *values, size_t count)
+    {
+        T partial[8] = {identity(), identity(), identity(), identity(), identity(), identity(), identity(), identity()};
+        size_t i = 0;
+        for (; i + 8 <= count; i += 8)
+        {
+            for (int lane = 0; lane < 8; lane++)
+            {
+                partial[lane] = combine(partial[lane], values[i + lane]);
+            }
+        }
+        T result = identity();
+        for (int lane = 0; lane < 8; lane++)
+        {
+            result = combine(result, partial[lane]);
+        }
+        for (; i < count; i++)
+        {
+            result = combine(result, values[i]);
+        }
+        return result;
+    }
+};
+
+template <typename T, typename Aggregate = SumAggregate<T>, size_t LeafWidth = 1>
+class SegmentTree
+{
+    static_assert(LeafWidth >= 1, "LeafWidth must be at least 1");
+
+private:
+    // Number of elements.
+    size_t size_;
+
+    // Number of leaves, a power of two, and the height of the tree above them.
+    size_t leaves_;
+    int height_;
+
+    // The raw elements. The pending addend of leaf node p applies to every
+    // element of its block and is not yet included here.
+    std::vector<T> values_;
+
+    // tree_[p] is the aggregate of node p's elements, including the pending
+    // addends of p and of its descendants, but not those of its ancestors.
+    std::vector<T> tree_;
+
+    // lazy_[p] is an addend that still has to be applied to p's children
+    // (or, for a leaf, to its raw elements).
+    std::vector<T> lazy_;
+
+    // Returns the number of raw elements in block b.
+    size_t _blockCount(size_t block) const
+    {
+        size_t first = block * LeafWidth;
+        return first >= size_ ? 0 : (size_ - first < LeafWidth ? size_ - first : LeafWidth);
+    }
+
+    // Adds addend to every element under node p, which holds count elements.
+    void _apply(size_t p, const T &addend, size_t count)
+    {
+        tree_[p] = Aggregate::apply(tree_[p], addend, count);
+        lazy_[p] += addend;
+    }
+
+    // Pushes the pending addends of every ancestor of p down to p.
+    void _pushDown(size_t p)
+    {
+        for (int shift = height_; shift > 0; shift--)
+        {
+            size_t node = p >> shift;
+            if (lazy_[node] != T())
+            {
+                size_t childCount = LeafWidth << (shift - 1);
+                _apply(2 * node, lazy_[node], childCount);
+                _apply(2 * node + 1, lazy_[node], childCount);
+                lazy_[node] = T();
+            }
+        }
+    }
+
+    // Recomputes the aggregates of every ancestor of p.
+    void _rebuild(size_t p)
+    {
+        size_t count = LeafWidth;
+        while (p > 1)
+        {
+            p >>= 1;
+            count <<= 1;
+            tree_[p] = Aggregate::apply(Aggregate::combine(tree_[2 * p], tree_[2 * p + 1]), lazy_[p], count);
+        }
+    }
+
+    // Adds addend to elements [first, last), which lie inside one block.
+    void _addInsideBlock(size_t first, size_t last, const T &addend)
+    {
+        size_t block = first / LeafWidth;
+        size_t leaf = leaves_ + block;
+        _pushDown(leaf);
+
+        // Fold the leaf's pending addend into its raw elements first.
+        size_t start = block * LeafWidth;
+        size_t count = _blockCount(block);
+        T pending = lazy_[leaf];
+        lazy_[leaf] = T();
+        for (size_t i = start; i < start + count; i++)
+        {
+            values_[i] += pending;
+        }
+        for (size_t i = first; i < last; i++)
+        {
+            values_[i] += addend;
+        }
+        tree_[leaf] = Aggregate::reduce(values_.data() + start, count);
+        _rebuild(leaf);
+    }
+
+    // Returns the aggregate of elements [first, last) inside one block.
+    T _queryInsideBlock(size_t first, size_t last)
+    {
+        size_t leaf = leaves_ + first / LeafWidth;
+        _pushDown(leaf);
+        return Aggregate::apply(Aggregate::reduce(values_.data() + first, last - first), lazy_[leaf], last - first);
+    }
+
+    void _checkRange(size_t first, size_t last) const
+    {
+        if (first > last || last > size_)
+        {
+            throw std::runtime_error("Error: SegmentTree range is out of bounds.");
+        }
+    }
+
+    // Builds the leaves and internal nodes from values_.
+    void _build()
+    {
+        size_t blocks = (size_ + LeafWidth - 1) / LeafWidth;
+        leaves_ = 1;
+        height_ = 0;
+        while (leaves_ < blocks)
+        {
+            leaves_ <<= 1;
+            height_++;
+        }
+        tree_.assign(2 * leaves_, Aggregate::identity());
+        lazy_.assign(2 * leaves_, T());
+        for (size_t block = 0; block < blocks; block++)
+        {
+            tree_[leaves_ + block] = Aggregate::reduce(values_.data() + block * LeafWidth, _blockCount(block));
+        }
+        for (size_t p = leaves_ - 1; p > 0; p--)
+        {
+            tree_[p] = Aggregate::combine(tree_[2 * p], tree_[2 * p + 1]);
+        }
+    }
+
+public:
+    // Adds addend to every element of [first, last).
+    void rangeAdd(size_t first, size_t last, const T &addend);
+
+    // Returns the aggregate of elements [first, last), or
+    // Aggregate::identity() for an empty range.
+    T query(size_t first, size_t last);
+
+    // Returns element index.
+    T get(size_t index) { return query(index, index + 1); }
+
+    // Adds addend to element index.
+    void add(size_t index, const T &addend) { rangeAdd(index, index + 1, addend); }
+
+    // Returns the number of elements.
+    size_t size() const { return size_; }
+
+    // Creates a tree of n copies of initial.
+    explicit SegmentTree(size_t n, const T &initial = T()) : size_(n), values_(n, initial) { _build(); }
+
+    // Creates a tree over a copy of values, in O(n).
+    explicit SegmentTree(const std::vector<T> &values) : size_(values.size()), values_(values) { _build(); }
+};
+
+// ===================================================================================
+// Implementation Section
+// ===================================================================================
+
+template <typename T, typename Aggregate, size_t LeafWidth>
+void SegmentTree<T, Aggregate, LeafWidth>::rangeAdd(size_t first, size_t last, const T &addend)
+{
+    _checkRange(first, last);
+    if (first == last)
+    {
+        return;
+    }
+
+    // Blocks [firstFull, endFull) are covered completely; the pieces of the
+    // range before and after them are updated element by element.
+    size_t firstFull = (first + LeafWidth - 1) / LeafWidth;
+    size_t endFull = last / LeafWidth;
+    if (firstFull >= endFull)
+    {
+        size_t split = firstFull * LeafWidth < last ? firstFull * LeafWidth : last;
+        if (first < split)
+        {
+            _addInsideBlock(first, split, addend);
+        }
+        if (split < last)
+        {
+            _addInsideBlock(split, last, addend);
+        }
+        return;
+    }
+    if (first < firstFull * LeafWidth)
+    {
+        _addInsideBlock(first, firstFull * LeafWidth, addend);
+    }
+    if (endFull * LeafWidth < last)
+    {
+        _addInsideBlock(endFull * LeafWidth, last, addend);
+    }
+
+    // Tag the nodes that exactly cover the full blocks, climbing from both ends.
+    size_t left = firstFull + leaves_;
+    size_t right = endFull + leaves_;
+    size_t count = LeafWidth;
+    for (; left < right; left >>= 1, right >>= 1, count <<= 1)
+    {
+        if (left & 1)
+        {
+            _apply(left++, addend, count);
+        }
+        if (right & 1)
+        {
+            _apply(--right, addend, count);
+        }
+    }
+    _rebuild(firstFull + leaves_);
+    _rebuild(endFull - 1 + leaves_);
+}
+
+template <typename T, typename Aggregate, size_t LeafWidth>
+T SegmentTree<T, Aggregate, LeafWidth>::query(size_t first, size_t last)
+{
+    _checkRange(first, last);
+    if (first == last)
+    {
+        return Aggregate::identity();
+    }
+
+    size_t firstFull = (first + LeafWidth - 1) / LeafWidth;
+    size_t endFull = last / LeafWidth;
+    if (firstFull >= endFull)
+    {
+        size_t split = firstFull * LeafWidth < last ? firstFull * LeafWidth : last;
+        T result = Aggregate::identity();
+        if (first < split)
+        {
+            result = _queryInsideBlock(first, split);
+        }
+        if (split < last)
+        {
+            result = Aggregate::combine(result, _queryInsideBlock(split, last));
+        }
+        return result;
+    }
+
+    T leftResult = Aggregate::identity();
+    T rightResult = Aggregate::identity();
+    if (first < firstFull * LeafWidth)
+    {
+        leftResult = _queryInsideBlock(first, firstFull * LeafWidth);
+    }
+    if (endFull * LeafWidth < last)
+    {
+        rightResult = _queryInsideBlock(endFull * LeafWidth, last);
+    }
+
+    size_t left = firstFull + leaves_;
+    size_t right = endFull + leaves_;
+    _pushDown(left);
+    _pushDown(right - 1);
+    for (; left < right; left >>= 1, right >>= 1)
+    {
+        if (left & 1)
+        {
+            leftResult = Aggregate::combine(leftResult, tree_[left++]);
+        }
+        if (right & 1)
+        {
+            rightResult = Aggregate::combine(tree_[--right], rightResult);
+        }
+    }
+    return Aggregate::combine(leftResult, rightResult);
+}
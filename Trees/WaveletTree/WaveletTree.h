@@ -0,0 +1,154 @@
+/**
+ * @file WaveletTree.h
+ * @author Kofi Boateng
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ *
+ */
+
+#pragma once
+#include <stdexcept> // for runtime_error
+#include <cstdint>   // for fixed width integers
+#include <vector>    // levels and build buffers
+#include "../../Succinct/BitVector.h"
+
+// This is an implementation of a Wavelet Tree, which stores a sequence of n symbols from an alphabet of
+// size sigma in about n * log2(sigma) bits and answers access(i) (the i-th symbol) and rank(c, i) (how
+// many times c occurs before position i) in O(log sigma), independent of n. It is the rank structure
+// behind FMIndex.h.
+// A wavelet tree splits the alphabet in half at every level and records one bit per symbol saying which
+// half it went to. This implementation stores the tree level by level (the "wavelet matrix" layout):
+// each level is a single BitVector over all n positions, and the symbols are stably reordered between
+// levels so that those with a 0 bit come first. That removes the per-node pointers and offsets of the
+// classic layout while keeping the same bounds, and each query touches exactly one bit vector per level.
+
+template <typename Symbol = uint16_t>
+class WaveletTree
+{
+private:
+    size_t size_;
+    int levels_;
+
+    // bits_[l] holds bit (levels_ - 1 - l) of every symbol in that level's
+    // order; zeros_[l] is how many of those bits are 0.
+    std::vector<BitVector> bits_;
+    std::vector<size_t> zeros_;
+
+public:
+    // Returns the symbol at position i.
+    Symbol access(size_t i) const
+    {
+        if (i >= size_)
+        {
+            throw std::runtime_error("Error: WaveletTree position is out of range.");
+        }
+        Symbol symbol = 0;
+        for (int l = 0; l < levels_; l++)
+        {
+            bool bit = bits_[l].get(i);
+            symbol = (Symbol)((symbol << 1) | (bit ? 1 : 0));
+            i = bit ? zeros_[l] + bits_[l].rank1(i) : bits_[l].rank0(i);
+        }
+        return symbol;
+    }
+
+    // Returns the number of occurrences of symbol in [0, i).
+    size_t rank(Symbol symbol, size_t i) const
+    {
+        if (i > size_)
+        {
+            throw std::runtime_error("Error: WaveletTree position is out of range.");
+        }
+        if (levels_ < (int)(sizeof(Symbol) * 8) && (symbol >> levels_) != 0)
+        {
+            return 0;
+        }
+        // Follow [start, i) down the levels; it always holds the positions
+        // whose symbols share the prefix of symbol seen so far.
+        size_t start = 0;
+        for (int l = 0; l < levels_; l++)
+        {
+            if ((symbol >> (levels_ - 1 - l)) & 1)
+            {
+                start = zeros_[l] + bits_[l].rank1(start);
+                i = zeros_[l] + bits_[l].rank1(i);
+            }
+            else
+            {
+                start = bits_[l].rank0(start);
+                i = bits_[l].rank0(i);
+            }
+        }
+        return i - start;
+    }
+
+    // Returns the number of symbols.
+    size_t size() const { return size_; }
+
+    // Returns the memory used by the bit vectors, in bytes.
+    size_t memoryBytes() const
+    {
+        size_t bytes = 0;
+        for (const BitVector &level : bits_)
+        {
+            bytes += level.memoryBytes();
+        }
+        return bytes;
+    }
+
+    // Builds the tree over symbols, which must all be below alphabetSize.
+    WaveletTree(const std::vector<Symbol> &symbols, uint64_t alphabetSize) : size_(symbols.size()), levels_(1)
+    {
+        while (levels_ < 64 && ((uint64_t)1 << levels_) < alphabetSize)
+        {
+            levels_++;
+        }
+        std::vector<Symbol> current(symbols);
+        std::vector<Symbol> next(symbols.size());
+        for (size_t i = 0; i < current.size(); i++)
+        {
+            if ((uint64_t)current[i] >= alphabetSize)
+            {
+                throw std::runtime_error("Error: WaveletTree symbol is outside the alphabet.");
+            }
+        }
+
+        for (int l = 0; l < levels_; l++)
+        {
+            int shift = levels_ - 1 - l;
+            BitVector level(size_);
+            size_t zeros = 0;
+            for (size_t i = 0; i < size_; i++)
+            {
+                if ((current[i] >> shift) & 1)
+                {
+                    level.set(i);
+                }
+                else
+                {
+                    zeros++;
+                }
+            }
+            level.build();
+
+            // Stable partition: zeros first, then ones.
+            size_t zeroPosition = 0;
+            size_t onePosition = zeros;
+            for (size_t i = 0; i < size_; i++)
+            {
+                if ((current[i] >> shift) & 1)
+                {
+                    next[onePosition++] = current[i];
+                }
+                else
+                {
+                    next[zeroPosition++] = current[i];
+                }
+            }
+            current.swap(next);
+            bits_.push_back(std::move(level));
+            zeros_.push_back(zeros);
+        }
+    }
+};